@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+// Minimal self-contained benchmark harness. A benchmark is a function which
+// runs its body the given number of times; the runner grows the iteration
+// count until a run takes long enough to be measured reliably.
+using Function = void (*)(std::size_t iterations);
+
+struct Result {
+    std::string name;
+    std::size_t iterations;
+    double nanosecondsPerIteration;
+};
+
+class Registry {
+  public:
+    static bool add(std::string name, Function function);
+    static std::vector<Result> run(const std::string &filter);
+
+  private:
+    struct Entry {
+        std::string name;
+        Function function;
+    };
+
+    static std::vector<Entry> &entries();
+};
+
+template <class T> inline void doNotOptimize(T const &value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+inline void clobberMemory() { asm volatile("" : : : "memory"); }
+
+} // namespace bench
+
+#define BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_IMPL(a, b)
+
+#define BENCHMARK_REGISTER(name, function)                                     \
+    static const bool BENCHMARK_CONCAT(gBenchmarkRegistered, __LINE__) =       \
+        ::bench::Registry::add(name, function)
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <bench/Benchmark.hxx>
+
+#include <hal/BinaryValue.hxx>
+#include <hal/IBinaryValueReader.hxx>
+#include <hal/IBinaryValueWriter.hxx>
+#include <hal/Timing.hxx>
+
+#include <staircase/BasicLight.hxx>
+#include <staircase/IBasicLight.hxx>
+#include <staircase/IProximitySensor.hxx>
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+namespace bench {
+
+class NullValueWriter final : public hal::IBinaryValueWriter {
+  public:
+    void writeValue(hal::BinaryValue value) noexcept final {
+        doNotOptimize(value);
+    }
+};
+
+class ConstantValueReader final : public hal::IBinaryValueReader {
+  public:
+    hal::BinaryValue readValue() noexcept final { return mValue; }
+
+    void setValue(hal::BinaryValue value) noexcept { mValue = value; }
+
+  private:
+    hal::BinaryValue mValue{hal::BinaryValue::LOW};
+};
+
+// A memory mapped GPIO bit, as a concrete pin type for the Static*
+// components: reading and writing it is a single volatile load or store.
+class RegisterPin {
+  public:
+    RegisterPin(volatile std::uint32_t &reg, std::uint32_t mask) noexcept
+        : mRegister{&reg}, mMask{mask} {}
+
+    hal::BinaryValue readValue() noexcept {
+        return (*mRegister & mMask) ? hal::BinaryValue::HIGH
+                                    : hal::BinaryValue::LOW;
+    }
+
+    void writeValue(hal::BinaryValue value) noexcept {
+        *mRegister = (value == hal::BinaryValue::HIGH) ? mMask : 0;
+    }
+
+  private:
+    volatile std::uint32_t *mRegister;
+    std::uint32_t mMask;
+};
+
+// Proximity sensor whose state change is set by the benchmark, so the
+// looper can be driven without waiting for debounces.
+class ScriptedSensor final : public staircase::IProximitySensor {
+  public:
+    bool hasStateChanged() const noexcept final { return mChanged; }
+    bool isClose() const noexcept final { return true; }
+    bool isFar() const noexcept final { return false; }
+    void update(hal::Milliseconds) noexcept final {}
+    hal::Milliseconds nextDeadline() const noexcept final {
+        return hal::kForever;
+    }
+
+    void trigger(bool changed) noexcept { mChanged = changed; }
+
+  private:
+    bool mChanged{false};
+};
+
+// The staircase lights as StaircaseLooper sees them on a device.
+class Lights {
+  public:
+    static constexpr std::size_t kLightsNum =
+        staircase::IBasicLight::kLightsNum;
+
+    Lights() noexcept
+        : mLights{makeLights(std::make_index_sequence<kLightsNum>{})},
+          mLightRefs{makeLightRefs(std::make_index_sequence<kLightsNum>{})} {}
+
+    Lights(const Lights &) = delete;
+    Lights(Lights &&) noexcept = delete;
+    Lights &operator=(const Lights &) = delete;
+    Lights &operator=(Lights &&) noexcept = delete;
+
+    ~Lights() = default;
+
+    staircase::BasicLights &get() noexcept { return mLightRefs; }
+
+  private:
+    template <std::size_t... I>
+    std::array<staircase::BasicLight, kLightsNum>
+    makeLights(std::index_sequence<I...>) noexcept {
+        return {staircase::BasicLight{((void)I, mWriter)}...};
+    }
+
+    template <std::size_t... I>
+    staircase::BasicLights makeLightRefs(std::index_sequence<I...>) noexcept {
+        return {mLights[I]...};
+    }
+
+    NullValueWriter mWriter;
+    std::array<staircase::BasicLight, kLightsNum> mLights;
+    staircase::BasicLights mLightRefs;
+};
+
+} // namespace bench
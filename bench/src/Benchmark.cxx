@@ -0,0 +1,60 @@
+#include <bench/Benchmark.hxx>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace bench;
+
+namespace {
+
+constexpr std::chrono::nanoseconds kMinimalRunTime =
+    std::chrono::milliseconds{100};
+constexpr std::size_t kMaximalIterations = std::size_t{1} << 30;
+
+std::chrono::nanoseconds measure(Function function, std::size_t iterations) {
+    auto start = std::chrono::steady_clock::now();
+    function(iterations);
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+}
+
+} // namespace
+
+bool Registry::add(std::string name, Function function) {
+    entries().push_back(Entry{std::move(name), function});
+    return true;
+}
+
+std::vector<Result> Registry::run(const std::string &filter) {
+    std::vector<Result> results;
+
+    for (const auto &entry : entries()) {
+        if (entry.name.find(filter) == std::string::npos) {
+            continue;
+        }
+
+        std::size_t iterations = 1;
+        auto elapsed = measure(entry.function, iterations);
+
+        while ((elapsed < kMinimalRunTime) &&
+               (iterations < kMaximalIterations)) {
+            iterations *= 2;
+            elapsed = measure(entry.function, iterations);
+        }
+
+        results.push_back(Result{entry.name, iterations,
+                                 static_cast<double>(elapsed.count()) /
+                                     static_cast<double>(iterations)});
+    }
+
+    return results;
+}
+
+std::vector<Registry::Entry> &Registry::entries() {
+    static std::vector<Entry> sEntries;
+    return sEntries;
+}
@@ -0,0 +1,124 @@
+#include <bench/Benchmark.hxx>
+#include <bench/Fixtures.hxx>
+
+#include <hal/BinaryValue.hxx>
+#include <hal/Timing.hxx>
+
+#include <staircase/BasicLight.hxx>
+#include <staircase/EWMAMovingTimeFilter.hxx>
+#include <staircase/IBasicLight.hxx>
+#include <staircase/IMovingTimeFilter.hxx>
+#include <staircase/IProximitySensor.hxx>
+#include <staircase/MTAMovingTimeFilter.hxx>
+#include <staircase/ProximitySensor.hxx>
+#include <staircase/SlidingMedianMovingTimeFilter.hxx>
+#include <staircase/StaticBasicLight.hxx>
+#include <staircase/StaticProximitySensor.hxx>
+
+#include <cstdint>
+#include <memory>
+
+namespace {
+
+constexpr hal::Milliseconds kTick = 10;
+
+void basicLightUpdate(std::size_t iterations) {
+    bench::NullValueWriter writer;
+    auto basicLight = std::make_unique<staircase::BasicLight>(writer);
+    staircase::IBasicLight &light = *basicLight;
+
+    light.turnOn(1 << 30);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        light.update(kTick);
+        bench::clobberMemory();
+    }
+}
+
+void proximitySensorUpdateSteady(std::size_t iterations) {
+    bench::ConstantValueReader reader;
+    auto proximitySensor = std::make_unique<staircase::ProximitySensor>(reader);
+    staircase::IProximitySensor &sensor = *proximitySensor;
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sensor.update(kTick);
+        bench::doNotOptimize(sensor.hasStateChanged());
+    }
+}
+
+// A new level on every update, so each one runs the debounce path.
+void proximitySensorUpdateToggling(std::size_t iterations) {
+    bench::ConstantValueReader reader;
+    auto proximitySensor = std::make_unique<staircase::ProximitySensor>(reader);
+    staircase::IProximitySensor &sensor = *proximitySensor;
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        reader.setValue((i & 1) ? hal::BinaryValue::HIGH
+                                : hal::BinaryValue::LOW);
+        sensor.update(DEBOUNCE_PERIOD);
+        bench::doNotOptimize(sensor.hasStateChanged());
+    }
+}
+
+void staticBasicLightUpdate(std::size_t iterations) {
+    volatile std::uint32_t reg = 0;
+    auto light = std::make_unique<
+        staircase::StaticBasicLight<bench::RegisterPin>>(
+        bench::RegisterPin{reg, 1});
+
+    light->turnOn(1 << 30);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        light->update(kTick);
+        bench::clobberMemory();
+    }
+}
+
+void staticProximitySensorUpdateToggling(std::size_t iterations) {
+    volatile std::uint32_t reg = 0;
+    auto sensor = std::make_unique<
+        staircase::StaticProximitySensor<bench::RegisterPin>>(
+        bench::RegisterPin{reg, 1});
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        reg = i & 1;
+        sensor->update(DEBOUNCE_PERIOD);
+        bench::doNotOptimize(sensor->hasStateChanged());
+    }
+}
+
+template <class Filter>
+void filterProcessNewMovingTime(std::size_t iterations) {
+    auto timeFilter = std::make_unique<Filter>(INITIAL_MOVING_DURATION);
+    staircase::IMovingTimeFilter &filter = *timeFilter;
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        filter.processNewMovingTime(10000 + static_cast<hal::Milliseconds>(
+                                                i & 1023));
+        bench::doNotOptimize(filter.getCurrentMovingTime());
+    }
+}
+
+BENCHMARK_REGISTER("BasicLight/update", &basicLightUpdate);
+BENCHMARK_REGISTER("ProximitySensor/update/steady",
+                   &proximitySensorUpdateSteady);
+BENCHMARK_REGISTER("ProximitySensor/update/toggling",
+                   &proximitySensorUpdateToggling);
+BENCHMARK_REGISTER("StaticBasicLight/update", &staticBasicLightUpdate);
+BENCHMARK_REGISTER("StaticProximitySensor/update/toggling",
+                   &staticProximitySensorUpdateToggling);
+BENCHMARK_REGISTER("MTAMovingTimeFilter/processNewMovingTime",
+                   &filterProcessNewMovingTime<staircase::MTAMovingTimeFilter>);
+BENCHMARK_REGISTER(
+    "MTAMovingTimeFilter/processNewMovingTime/window_64",
+    &filterProcessNewMovingTime<staircase::WindowedMTAMovingTimeFilter<64>>);
+BENCHMARK_REGISTER(
+    "EWMAMovingTimeFilter/processNewMovingTime",
+    &filterProcessNewMovingTime<staircase::EWMAMovingTimeFilter<>>);
+BENCHMARK_REGISTER(
+    "SlidingMedianMovingTimeFilter/processNewMovingTime",
+    &filterProcessNewMovingTime<staircase::SlidingMedianMovingTimeFilter<>>);
+BENCHMARK_REGISTER(
+    "SlidingMedianMovingTimeFilter/processNewMovingTime/window_15",
+    &filterProcessNewMovingTime<
+        staircase::SlidingMedianMovingTimeFilter<15>>);
+
+} // namespace
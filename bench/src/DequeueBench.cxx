@@ -0,0 +1,49 @@
+#include <bench/Benchmark.hxx>
+
+#include <util/StaticDequeue.hxx>
+
+#include <cstdint>
+#include <memory>
+
+namespace {
+
+constexpr std::size_t kSize = MAX_MOVINGS;
+
+using Dequeue = util::StaticDequeue<std::uint32_t, kSize>;
+
+void dequeuePushPop(std::size_t iterations) {
+    auto dequeue = std::make_unique<Dequeue>();
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        dequeue->pushBack(static_cast<std::uint32_t>(i));
+        if (dequeue->full()) {
+            bench::doNotOptimize(dequeue->front());
+            dequeue->popFront();
+        }
+        bench::clobberMemory();
+    }
+}
+
+void dequeueIterate(std::size_t iterations) {
+    auto dequeue = std::make_unique<Dequeue>();
+    // Leaves the first element away from index zero so iteration wraps.
+    dequeue->pushBack(0);
+    dequeue->popFront();
+    while (!dequeue->full()) {
+        dequeue->pushBack(static_cast<std::uint32_t>(dequeue->size()));
+    }
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::uint32_t sum = 0;
+        for (auto value : *dequeue) {
+            sum += value;
+        }
+        bench::doNotOptimize(sum);
+        bench::clobberMemory();
+    }
+}
+
+BENCHMARK_REGISTER("StaticDequeue/push_pop", &dequeuePushPop);
+BENCHMARK_REGISTER("StaticDequeue/iterate", &dequeueIterate);
+
+} // namespace
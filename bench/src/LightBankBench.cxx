@@ -0,0 +1,91 @@
+#include <bench/Benchmark.hxx>
+#include <bench/Fixtures.hxx>
+
+#include <hal/IBinaryPortWriter.hxx>
+#include <hal/Timing.hxx>
+
+#include <staircase/BasicLight.hxx>
+#include <staircase/IBasicLight.hxx>
+#include <staircase/LightBank.hxx>
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <memory>
+#include <span>
+
+namespace {
+
+constexpr hal::Milliseconds kOnPeriod = 1 << 30;
+constexpr hal::Milliseconds kTick = 1;
+
+class NullPortWriter final : public hal::IBinaryPortWriter {
+  public:
+    void writePort(std::span<const Word> values) noexcept final {
+        bench::doNotOptimize(values.data());
+    }
+};
+
+// The current design: separately allocated BasicLights updated one virtual
+// call at a time, exactly like InterfaceStaircaseLooper::updateLights.
+template <std::size_t N> void basicLightsUpdate(std::size_t iterations) {
+    bench::NullValueWriter writer;
+    std::array<std::unique_ptr<staircase::BasicLight>, N> lights;
+    std::array<std::reference_wrapper<staircase::IBasicLight>, N> lightRefs{
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            ((lights[I] = std::make_unique<staircase::BasicLight>(writer)),
+             ...);
+            return std::array<std::reference_wrapper<staircase::IBasicLight>,
+                              N>{*lights[I]...};
+        }(std::make_index_sequence<N>{})};
+
+    for (auto &light : lightRefs) {
+        light.get().turnOn(kOnPeriod);
+    }
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::for_each(std::begin(lightRefs), std::end(lightRefs),
+                      [](auto light) { light.get().update(kTick); });
+        bench::clobberMemory();
+    }
+}
+
+template <std::size_t N> void lightBankUpdate(std::size_t iterations) {
+    NullPortWriter writer;
+    auto bank = std::make_unique<staircase::LightBank<N>>(writer);
+
+    for (std::size_t index = 0; index < N; ++index) {
+        bank->turnOn(index, kOnPeriod);
+    }
+
+    staircase::ILightBank &lightBank = *bank;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        lightBank.update(kTick);
+        bench::clobberMemory();
+    }
+}
+
+// A moving's worth of traffic: one light is (re)armed every tick and about
+// one expires, the rest stay off.
+template <std::size_t N> void lightBankMoving(std::size_t iterations) {
+    NullPortWriter writer;
+    auto bank = std::make_unique<staircase::LightBank<N>>(writer);
+
+    staircase::ILightBank &lightBank = *bank;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        bank->turnOn(i % N, 30 * kTick);
+        lightBank.update(kTick);
+        bench::clobberMemory();
+    }
+}
+
+BENCHMARK_REGISTER("BasicLights/update/8", &basicLightsUpdate<8>);
+BENCHMARK_REGISTER("BasicLights/update/64", &basicLightsUpdate<64>);
+BENCHMARK_REGISTER("BasicLights/update/512", &basicLightsUpdate<512>);
+BENCHMARK_REGISTER("LightBank/update/8", &lightBankUpdate<8>);
+BENCHMARK_REGISTER("LightBank/update/64", &lightBankUpdate<64>);
+BENCHMARK_REGISTER("LightBank/update/512", &lightBankUpdate<512>);
+BENCHMARK_REGISTER("LightBank/moving/64", &lightBankMoving<64>);
+BENCHMARK_REGISTER("LightBank/moving/512", &lightBankMoving<512>);
+
+} // namespace
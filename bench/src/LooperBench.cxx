@@ -0,0 +1,152 @@
+#include <bench/Benchmark.hxx>
+#include <bench/Fixtures.hxx>
+
+#include <hal/ICycleCounter.hxx>
+#include <hal/Timing.hxx>
+
+#include <staircase/ClippedSquaredMovingDurationCalculator.hxx>
+#include <staircase/IMoving.hxx>
+#include <staircase/MTAMovingTimeFilter.hxx>
+#include <staircase/StaircaseLooper.hxx>
+#include <staircase/StaticMovingFactory.hxx>
+#include <staircase/TickProfile.hxx>
+#include <staircase/TraceRing.hxx>
+
+#include <cstdint>
+#include <memory>
+
+namespace {
+
+constexpr hal::Milliseconds kTick = 10;
+// Long enough that no moving finishes or goes stale while being measured.
+constexpr hal::Milliseconds kMovingTime = 1 << 30;
+// Past IMoving::kCloseFinishDiff, so the next trigger starts a new moving.
+constexpr hal::Milliseconds kBetweenTriggers = MOVING_FINISH_DELTA + kTick;
+
+struct Staircase {
+    Staircase()
+        : downFilter{kMovingTime}, upFilter{kMovingTime},
+          looper{lights.get(),    downSensor,         upSensor,
+                 movingFactory,   durationCalculator, downFilter,
+                 upFilter} {}
+
+    // Starts movings in the given directions and lets them age so that the
+    // looper accepts the next ones.
+    void start(std::size_t count, bool up, bool down) {
+        for (std::size_t i = 0; i < count; ++i) {
+            downSensor.trigger(up);
+            upSensor.trigger(down);
+            looper.update(kTick);
+
+            downSensor.trigger(false);
+            upSensor.trigger(false);
+            looper.update(kBetweenTriggers);
+        }
+    }
+
+    bench::Lights lights;
+    bench::ScriptedSensor downSensor;
+    bench::ScriptedSensor upSensor;
+    staircase::StaticMovingFactory<2 * staircase::IMoving::kMaxMovings>
+        movingFactory;
+    staircase::ClippedSquaredMovingDurationCalculator durationCalculator;
+    staircase::MTAMovingTimeFilter downFilter;
+    staircase::MTAMovingTimeFilter upFilter;
+    staircase::StaircaseLooper looper;
+};
+
+void run(Staircase &staircase, std::size_t iterations) {
+    staircase::IStaircaseLooper &looper = staircase.looper;
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        looper.update(kTick);
+        bench::clobberMemory();
+    }
+}
+
+void looperIdle(std::size_t iterations) {
+    auto staircase = std::make_unique<Staircase>();
+    run(*staircase, iterations);
+}
+
+void looperOneMoving(std::size_t iterations) {
+    auto staircase = std::make_unique<Staircase>();
+    staircase->start(1, true, false);
+    run(*staircase, iterations);
+}
+
+void looperMaxMovings(std::size_t iterations) {
+    auto staircase = std::make_unique<Staircase>();
+    staircase->start(staircase::IMoving::kMaxMovings, true, true);
+    run(*staircase, iterations);
+}
+
+// Same as one_moving with the trace attached and drained after every tick,
+// so it costs nothing unless built with STAIRCASE_TRACE.
+void looperOneMovingTraced(std::size_t iterations) {
+    auto staircase = std::make_unique<Staircase>();
+    auto trace = std::make_unique<staircase::TraceRing>();
+    staircase->looper.setTrace(trace.get());
+    staircase->start(1, true, false);
+
+    staircase::IStaircaseLooper &looper = staircase->looper;
+    staircase::TraceRecord record;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        looper.update(kTick);
+        while (trace->pop(record)) {
+            bench::doNotOptimize(record);
+        }
+        bench::clobberMemory();
+    }
+}
+
+// Stands in for a cycle counter register, which is a single read on the
+// target, so that the benchmark shows the bookkeeping rather than the cost of
+// the host clock.
+class CountingCycles final : public hal::ICycleCounter {
+  public:
+    std::uint32_t cycles() const noexcept override { return ++mNow; }
+    std::uint32_t frequency() const noexcept override { return 1000000; }
+
+  private:
+    mutable std::uint32_t mNow = 0;
+};
+
+// Same as one_moving with every phase recorded into a TickProfile.
+void looperOneMovingProfiled(std::size_t iterations) {
+    auto staircase = std::make_unique<Staircase>();
+    CountingCycles counter;
+    auto profile = std::make_unique<staircase::TickProfile>(counter);
+    staircase->looper.setProfile(profile.get());
+    staircase->start(1, true, false);
+    run(*staircase, iterations);
+    bench::doNotOptimize(profile->summary(staircase::TickPhase::TICK));
+}
+
+void traceRecord(std::size_t iterations) {
+    auto trace = std::make_unique<staircase::TraceRing>();
+    staircase::TraceRecord record;
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        trace->record(staircase::TraceEvent::LIGHT_ON,
+                      static_cast<std::uint16_t>(i), 0);
+        if ((i & 63) == 63) {
+            while (trace->pop(record)) {
+                bench::doNotOptimize(record);
+            }
+        }
+        bench::clobberMemory();
+    }
+}
+
+BENCHMARK_REGISTER("StaircaseLooper/update/idle", &looperIdle);
+BENCHMARK_REGISTER("StaircaseLooper/update/one_moving", &looperOneMoving);
+BENCHMARK_REGISTER("StaircaseLooper/update/max_movings_both_directions",
+                   &looperMaxMovings);
+BENCHMARK_REGISTER("StaircaseLooper/update/one_moving/traced",
+                   &looperOneMovingTraced);
+BENCHMARK_REGISTER("StaircaseLooper/update/one_moving/profiled",
+                   &looperOneMovingProfiled);
+BENCHMARK_REGISTER("TraceRing/record", &traceRecord);
+
+} // namespace
@@ -0,0 +1,71 @@
+#include <bench/Benchmark.hxx>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+void usage(const char *name) {
+    std::printf("usage: %s [--format=table|json] [filter]\n", name);
+}
+
+void printTable(const std::vector<bench::Result> &results) {
+    std::printf("%-52s %14s %14s\n", "benchmark", "iterations", "ns/iteration");
+    for (const auto &result : results) {
+        std::printf("%-52s %14zu %14.2f\n", result.name.c_str(),
+                    result.iterations, result.nanosecondsPerIteration);
+    }
+}
+
+// One JSON document with the build context next to the results, so runs of
+// different builds or configurations can be diffed by a script.
+void printJson(const std::vector<bench::Result> &results) {
+    std::printf("{\n");
+    std::printf("  \"context\": {\n");
+    std::printf("    \"compiler\": \"%s\",\n", __VERSION__);
+    std::printf("    \"build_type\": \"%s\",\n", STAIRCASE_BUILD_TYPE);
+    std::printf("    \"lights_num\": %d,\n", LIGHTS_NUM);
+    std::printf("    \"max_movings\": %d\n", MAX_MOVINGS);
+    std::printf("  },\n");
+    std::printf("  \"benchmarks\": [");
+    for (std::size_t index = 0; index < results.size(); ++index) {
+        const auto &result = results[index];
+        std::printf("%s\n    {\"name\": \"%s\", \"iterations\": %zu, "
+                    "\"ns_per_iteration\": %.3f}",
+                    (index == 0) ? "" : ",", result.name.c_str(),
+                    result.iterations, result.nanosecondsPerIteration);
+    }
+    std::printf("\n  ]\n}\n");
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    std::string filter;
+    bool json = false;
+
+    for (int index = 1; index < argc; ++index) {
+        if (std::strcmp(argv[index], "--format=json") == 0) {
+            json = true;
+        } else if (std::strcmp(argv[index], "--format=table") == 0) {
+            json = false;
+        } else if (argv[index][0] == '-') {
+            usage(argv[0]);
+            return 1;
+        } else {
+            filter = argv[index];
+        }
+    }
+
+    auto results = bench::Registry::run(filter);
+
+    if (json) {
+        printJson(results);
+    } else {
+        printTable(results);
+    }
+
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include <bench/Benchmark.hxx>
+#include <bench/Fixtures.hxx>
+
+#include <hal/Timing.hxx>
+
+#include <staircase/BasicMovingFactory.hxx>
+#include <staircase/ClippedSquaredMovingDurationCalculator.hxx>
+#include <staircase/IMoving.hxx>
+#include <staircase/Moving.hxx>
+#include <staircase/StaticMovingFactory.hxx>
+
+#include <cstdint>
+#include <memory>
+#include <new>
+
+namespace {
+
+constexpr hal::Milliseconds kMovingTime = 12000;
+constexpr hal::Milliseconds kSmallDelta = 10;
+constexpr hal::Milliseconds kHugeDelta = 1 << 20;
+
+// Small deltas, restarting the moving in place whenever it completes.
+void movingUpdateSmallDelta(std::size_t iterations) {
+    auto lights = std::make_unique<bench::Lights>();
+    staircase::ClippedSquaredMovingDurationCalculator calculator;
+    staircase::Moving::Timeline timeline{calculator, kMovingTime};
+    auto moving = std::make_unique<staircase::Moving>(
+        lights->get(), timeline, staircase::IMoving::Direction::UP);
+    staircase::IMoving *current = moving.get();
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        current->update(kSmallDelta);
+        if (current->isCompleted()) {
+            moving->~Moving();
+            current = new (moving.get())
+                staircase::Moving{lights->get(), timeline,
+                                  staircase::IMoving::Direction::UP};
+        }
+        bench::clobberMemory();
+    }
+}
+
+// One delta which runs a fresh moving through every light at once.
+void movingUpdateHugeDelta(std::size_t iterations) {
+    auto lights = std::make_unique<bench::Lights>();
+    staircase::ClippedSquaredMovingDurationCalculator calculator;
+    staircase::Moving::Timeline timeline{calculator, kMovingTime};
+    auto moving = std::make_unique<staircase::Moving>(
+        lights->get(), timeline, staircase::IMoving::Direction::UP);
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        moving->~Moving();
+        staircase::IMoving *current = new (moving.get())
+            staircase::Moving{lights->get(), timeline,
+                              staircase::IMoving::Direction::UP};
+        current->update(kHugeDelta);
+        bench::clobberMemory();
+    }
+}
+
+template <class Factory> void factoryCreate(std::size_t iterations) {
+    auto lights = std::make_unique<bench::Lights>();
+    staircase::ClippedSquaredMovingDurationCalculator calculator;
+    auto factory = std::make_unique<Factory>();
+    staircase::IMovingFactory &movingFactory = *factory;
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto moving =
+            movingFactory.create(lights->get(), calculator,
+                                 staircase::IMoving::Direction::UP,
+                                 kMovingTime);
+        bench::doNotOptimize(moving.get());
+    }
+}
+
+BENCHMARK_REGISTER("Moving/update/small_delta", &movingUpdateSmallDelta);
+BENCHMARK_REGISTER("Moving/update/huge_delta", &movingUpdateHugeDelta);
+BENCHMARK_REGISTER("BasicMovingFactory/create",
+                   &factoryCreate<staircase::BasicMovingFactory>);
+BENCHMARK_REGISTER(
+    "StaticMovingFactory/create",
+    &factoryCreate<
+        staircase::StaticMovingFactory<staircase::IMoving::kMaxMovings>>);
+
+} // namespace
@@ -0,0 +1,112 @@
+#include <bench/Benchmark.hxx>
+
+#include <hal/IPersistence.hxx>
+
+#include <sim/MappedFileStorage.hxx>
+
+#include <staircase/LogStore.hxx>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include <unistd.h>
+
+namespace {
+
+constexpr std::size_t kStorageSize = 16 * 4096;
+
+std::string scratchPath() {
+    auto path = "/tmp/staircase_bench_" + std::to_string(::getpid());
+    std::remove(path.c_str());
+    return path;
+}
+
+// LogStore over a scratch file, mounted with the four keys the persistence
+// runnable keeps.
+class MappedStore {
+  public:
+    MappedStore()
+        : mPath{scratchPath()}, mStorage{mPath, kStorageSize},
+          mStore{mStorage} {
+        mStore.mount();
+        for (auto &entry : mEntries) {
+            mStore.setValue(entry.key, 1);
+        }
+    }
+
+    ~MappedStore() { std::remove(mPath.c_str()); }
+
+    staircase::LogStore &store() { return mStore; }
+    std::array<hal::IPersistence::Entry, 4> &entries() { return mEntries; }
+
+  private:
+    std::string mPath;
+    sim::MappedFileStorage mStorage;
+    staircase::LogStore mStore;
+    std::array<hal::IPersistence::Entry, 4> mEntries{{
+        {"down_time", 0, false},
+        {"up_time", 0, false},
+        {"down_walks", 0, false},
+        {"up_walks", 0, false},
+    }};
+};
+
+void logStoreTryGet(std::size_t iterations) {
+    auto store = std::make_unique<MappedStore>();
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        bench::doNotOptimize(store->store().tryGet("up_walks"));
+        bench::clobberMemory();
+    }
+}
+
+void logStoreGetValues(std::size_t iterations) {
+    auto store = std::make_unique<MappedStore>();
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        store->store().getValues(store->entries());
+        bench::clobberMemory();
+    }
+}
+
+void logStoreSetValues(std::size_t iterations) {
+    auto store = std::make_unique<MappedStore>();
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (auto &entry : store->entries()) {
+            entry.value = static_cast<std::int32_t>(i);
+        }
+        store->store().setValues(store->entries());
+        bench::clobberMemory();
+    }
+}
+
+void logStoreSetUnchanged(std::size_t iterations) {
+    auto store = std::make_unique<MappedStore>();
+    store->store().setValues(store->entries());
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        store->store().setValues(store->entries());
+        bench::clobberMemory();
+    }
+}
+
+void logStoreMount(std::size_t iterations) {
+    auto store = std::make_unique<MappedStore>();
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        bench::doNotOptimize(store->store().mount());
+        bench::clobberMemory();
+    }
+}
+
+BENCHMARK_REGISTER("LogStore/try_get", &logStoreTryGet);
+BENCHMARK_REGISTER("LogStore/get_values/4", &logStoreGetValues);
+BENCHMARK_REGISTER("LogStore/set_values/4", &logStoreSetValues);
+BENCHMARK_REGISTER("LogStore/set_values/unchanged", &logStoreSetUnchanged);
+BENCHMARK_REGISTER("LogStore/mount", &logStoreMount);
+
+} // namespace
\ No newline at end of file
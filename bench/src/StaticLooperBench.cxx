@@ -0,0 +1,96 @@
+#include <bench/Benchmark.hxx>
+#include <bench/Fixtures.hxx>
+
+#include <hal/Timing.hxx>
+
+#include <staircase/BasicLight.hxx>
+#include <staircase/IMoving.hxx>
+#include <staircase/MTAMovingTimeFilter.hxx>
+#include <staircase/StaircaseConfig.hxx>
+#include <staircase/StaticClippedSquaredMovingDurationCalculator.hxx>
+#include <staircase/StaticStaircaseLooper.hxx>
+
+#include <cstdint>
+#include <memory>
+
+// Same scenarios as LooperBench, over the concrete types, so the two can be
+// compared side by side.
+namespace {
+
+constexpr hal::Milliseconds kTick = 10;
+constexpr hal::Milliseconds kMovingTime = 1 << 30;
+constexpr hal::Milliseconds kBetweenTriggers = MOVING_FINISH_DELTA + kTick;
+
+using Calculator = staircase::StaticClippedSquaredMovingDurationCalculator<
+    staircase::kDefaultConfig.lightsNum>;
+using Looper = staircase::StaticStaircaseLooper<
+    staircase::kDefaultConfig, staircase::BasicLight, bench::ScriptedSensor,
+    Calculator, staircase::MTAMovingTimeFilter>;
+
+struct Staircase {
+    Staircase()
+        : lightRefs{makeLightRefs(
+              std::make_index_sequence<staircase::kDefaultConfig.lightsNum>{})},
+          downFilter{kMovingTime}, upFilter{kMovingTime},
+          looper{lightRefs,          downSensor, upSensor,
+                 durationCalculator, downFilter, upFilter} {}
+
+    void start(std::size_t count, bool up, bool down) {
+        for (std::size_t i = 0; i < count; ++i) {
+            downSensor.trigger(up);
+            upSensor.trigger(down);
+            looper.update(kTick);
+
+            downSensor.trigger(false);
+            upSensor.trigger(false);
+            looper.update(kBetweenTriggers);
+        }
+    }
+
+    template <std::size_t... I>
+    Looper::Lights makeLightRefs(std::index_sequence<I...>) {
+        return {static_cast<staircase::BasicLight &>(
+            lights.get()[I].get())...};
+    }
+
+    bench::Lights lights;
+    Looper::Lights lightRefs;
+    bench::ScriptedSensor downSensor;
+    bench::ScriptedSensor upSensor;
+    Calculator durationCalculator;
+    staircase::MTAMovingTimeFilter downFilter;
+    staircase::MTAMovingTimeFilter upFilter;
+    Looper looper;
+};
+
+void run(Staircase &staircase, std::size_t iterations) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        staircase.looper.update(kTick);
+        bench::clobberMemory();
+    }
+}
+
+void staticLooperIdle(std::size_t iterations) {
+    auto staircase = std::make_unique<Staircase>();
+    run(*staircase, iterations);
+}
+
+void staticLooperOneMoving(std::size_t iterations) {
+    auto staircase = std::make_unique<Staircase>();
+    staircase->start(1, true, false);
+    run(*staircase, iterations);
+}
+
+void staticLooperMaxMovings(std::size_t iterations) {
+    auto staircase = std::make_unique<Staircase>();
+    staircase->start(staircase::kDefaultConfig.maxMovings, true, true);
+    run(*staircase, iterations);
+}
+
+BENCHMARK_REGISTER("StaticStaircaseLooper/update/idle", &staticLooperIdle);
+BENCHMARK_REGISTER("StaticStaircaseLooper/update/one_moving",
+                   &staticLooperOneMoving);
+BENCHMARK_REGISTER("StaticStaircaseLooper/update/max_movings_both_directions",
+                   &staticLooperMaxMovings);
+
+} // namespace
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <hal/BinaryValue.hxx>
+#include <hal/Concepts.hxx>
+#include <hal/IBinaryValueReader.hxx>
+#include <hal/IBinaryValueWriter.hxx>
+#include <hal/IPowerManager.hxx>
+#include <hal/IRTC.hxx>
+#include <hal/Timing.hxx>
+
+namespace hal {
+
+// Copyable handles over the virtual interfaces, so that components templated
+// on the hal concepts can still be built over any implementation of them,
+// the test mocks included.
+
+class BinaryReaderAdapter {
+  public:
+    BinaryReaderAdapter(IBinaryValueReader &reader) noexcept
+        : mReader{&reader} {}
+
+    BinaryValue readValue() noexcept { return mReader->readValue(); }
+
+  private:
+    IBinaryValueReader *mReader;
+};
+
+class BinaryWriterAdapter {
+  public:
+    BinaryWriterAdapter(IBinaryValueWriter &writer) noexcept
+        : mWriter{&writer} {}
+
+    void writeValue(BinaryValue value) noexcept { mWriter->writeValue(value); }
+
+  private:
+    IBinaryValueWriter *mWriter;
+};
+
+class ClockAdapter {
+  public:
+    ClockAdapter(IRTC &rtc) noexcept : mRtc{&rtc} {}
+
+    Milliseconds getCurrentTimeOfDay() const noexcept {
+        return mRtc->getCurrentTimeOfDay();
+    }
+
+    void adjustCurrentTime(Milliseconds diff) noexcept {
+        mRtc->adjustCurrentTime(diff);
+    }
+
+  private:
+    IRTC *mRtc;
+};
+
+class PowerManagerAdapter {
+  public:
+    PowerManagerAdapter(IPowerManager &powerManager) noexcept
+        : mPowerManager{&powerManager} {}
+
+    void hibernateFor(Milliseconds milliseconds) noexcept {
+        mPowerManager->hibernateFor(milliseconds);
+    }
+
+  private:
+    IPowerManager *mPowerManager;
+};
+
+static_assert(BinaryReader<BinaryReaderAdapter>);
+static_assert(BinaryWriter<BinaryWriterAdapter>);
+static_assert(Clock<ClockAdapter>);
+static_assert(PowerManager<PowerManagerAdapter>);
+
+} // namespace hal
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <hal/BinaryValue.hxx>
+#include <hal/Timing.hxx>
+
+namespace hal {
+
+// Level of an input right after it changed, stamped with the monotonic
+// millisecond clock by the interrupt which observed it.
+struct BinaryEdge {
+    BinaryValue value;
+    Timestamp timestamp;
+};
+
+} // namespace hal
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <hal/BinaryValue.hxx>
+#include <hal/Timing.hxx>
+
+#include <concepts>
+
+namespace hal {
+
+// Compile-time counterparts of the hal interfaces. A concrete pin type which
+// satisfies them lets the components read and write the pin without a
+// virtual call; Adapters.hxx turns the interfaces into such types.
+
+template <class T>
+concept BinaryReader = requires(T &reader) {
+    { reader.readValue() } -> std::same_as<BinaryValue>;
+};
+
+template <class T>
+concept BinaryWriter = requires(T &writer, BinaryValue value) {
+    writer.writeValue(value);
+};
+
+template <class T>
+concept Clock = requires(T &clock, const T &constClock, Milliseconds diff) {
+    { constClock.getCurrentTimeOfDay() } -> std::same_as<Milliseconds>;
+    clock.adjustCurrentTime(diff);
+};
+
+template <class T>
+concept PowerManager = requires(T &powerManager, Milliseconds milliseconds) {
+    powerManager.hibernateFor(milliseconds);
+};
+
+} // namespace hal
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <hal/ITask.hxx>
+#include <hal/Timing.hxx>
+
+#include <staircase/IRunnable.hxx>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace hal {
+
+// Runs any number of runnables cooperatively on one thread, so they share a
+// single stack instead of each needing a task of their own. Timers are kept
+// in a hashed wheel of one millisecond slots; of the runnables which are due
+// the one with the highest priority always runs first, and the due set is
+// looked at again after every run so housekeeping never holds the tick back
+// by more than one run of its own.
+//
+// Each runnable gets an ITask of its own, so nothing changes for it: delta()
+// is the time since it last ran, nextDeadline() decides when it runs again
+// and the task's wake() makes it due at once. When no timer is armed and
+// every runnable is idle the thread parks on the sensor edge instead.
+class Executor {
+  public:
+    enum class Priority : std::uint8_t {
+        CONTROL,
+        NORMAL,
+        BACKGROUND,
+    };
+
+    static constexpr std::size_t kMaxTasks = 8;
+    static constexpr std::size_t kWheelSize = 256;
+
+    Executor() noexcept;
+    virtual ~Executor() = default;
+
+    Executor(const Executor &) = delete;
+    Executor(Executor &&) noexcept = delete;
+    Executor &operator=(const Executor &) = delete;
+    Executor &operator=(Executor &&) noexcept = delete;
+
+    // Registers a runnable, due straight away. Returns its task or nullptr
+    // when kMaxTasks are taken. Call before loop().
+    ITask *add(staircase::IRunnable &runnable, Milliseconds period,
+               Priority priority) noexcept;
+
+    void loop() noexcept;
+    // Runs the highest priority runnable which is due, if any. Returns
+    // whether one ran.
+    bool runOnce() noexcept;
+    // Makes loop() return once the current run is done.
+    void stop() noexcept;
+
+    // Ends a sleepFor() early. Called by the tasks' wake().
+    virtual void wake() noexcept {}
+
+  protected:
+    virtual Timestamp now() const noexcept = 0;
+    // Sleeps for at most millis or until wake(); kForever means only wake()
+    // ends the sleep. A wake() since the last sleep has to end the next one
+    // at once, e.g. a binary semaphore.
+    virtual void sleepFor(Milliseconds millis) noexcept = 0;
+    // Waits for a sensor edge or wake() while every runnable is idle, see
+    // ITask::park(). Defaults to sleepFor(kForever).
+    virtual void park() noexcept { sleepFor(kForever); }
+
+  private:
+    class Task final : public ITask {
+      public:
+        Task(Executor &executor, staircase::IRunnable &runnable,
+             Milliseconds period, Priority priority) noexcept;
+
+        Milliseconds getDelta() const noexcept final { return mDelta; }
+        void wake() noexcept final;
+
+      private:
+        friend class Executor;
+
+        void sleep() noexcept final {}
+        Timestamp now() const noexcept final { return mExecutor.now(); }
+
+        Executor &mExecutor;
+        staircase::IRunnable &mRunnable;
+        Priority mPriority;
+        Timestamp mExpiry;
+        Timestamp mLastRun;
+        Milliseconds mDelta;
+        // In the wheel, in the due set, or neither when waiting for wake().
+        bool mArmed;
+        bool mDue;
+        // Due because its timer expired, so mExpiry is its release time.
+        bool mTimed;
+        std::atomic_bool mWoken;
+        Task *mNext;
+    };
+
+    // Moves the timers which expired by time and the woken tasks to the
+    // due set.
+    void advance(Timestamp time) noexcept;
+    Task *highestDue() noexcept;
+    bool isIdle() const noexcept;
+    void parkTasks() noexcept;
+    void run(Task &task, Timestamp start) noexcept;
+    void arm(Task &task, Timestamp expiry) noexcept;
+    void unlink(Task &task) noexcept;
+    // Time until the earliest timer, kForever when none is armed.
+    Milliseconds nextTimeout(Timestamp time) const noexcept;
+
+    static std::size_t slotOf(Timestamp time) noexcept {
+        return time % kWheelSize;
+    }
+
+    std::array<std::optional<Task>, kMaxTasks> mTasks;
+    std::size_t mTasksNum;
+    std::array<Task *, kWheelSize> mWheel;
+    // Last time the wheel was advanced to.
+    Timestamp mCursor;
+    bool mStarted;
+    std::atomic_bool mRunning;
+};
+
+} // namespace hal
\ No newline at end of file
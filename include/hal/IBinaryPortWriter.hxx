@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+namespace hal {
+
+// Writes a whole bank of binary outputs (shift register chain, GPIO expander,
+// port register) in one transaction. Output i lives in bit (i % 32) of word
+// (i / 32).
+class IBinaryPortWriter {
+  public:
+    using Word = std::uint32_t;
+    static constexpr std::size_t kWordBits = 32;
+
+    IBinaryPortWriter() = default;
+
+    IBinaryPortWriter(const IBinaryPortWriter &) = delete;
+    IBinaryPortWriter(IBinaryPortWriter &&) = delete;
+    IBinaryPortWriter &operator=(const IBinaryPortWriter &) = delete;
+    IBinaryPortWriter &operator=(IBinaryPortWriter &&) = delete;
+
+    virtual ~IBinaryPortWriter() = default;
+
+    virtual void writePort(std::span<const Word> values) noexcept = 0;
+};
+
+} // namespace hal
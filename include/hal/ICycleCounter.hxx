@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+namespace hal {
+
+// Free running counter for measuring short intervals, e.g. the CPU cycle
+// counter. Differences are taken modulo 2^32, so an interval is correct as
+// long as it is shorter than one wrap.
+class ICycleCounter {
+  public:
+    virtual ~ICycleCounter() = default;
+    virtual std::uint32_t cycles() const noexcept = 0;
+    // Counts per second.
+    virtual std::uint32_t frequency() const noexcept = 0;
+};
+
+} // namespace hal
\ No newline at end of file
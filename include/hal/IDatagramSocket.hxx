@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+namespace hal {
+
+// Connected datagram socket, e.g. UDP to a time server. Neither call
+// blocks; platforms wake the task using it when a datagram arrives.
+class IDatagramSocket {
+  public:
+    virtual ~IDatagramSocket() = default;
+    // Returns false when the datagram could not be queued.
+    virtual bool send(std::span<const std::byte> datagram) noexcept = 0;
+    // Copies the oldest received datagram into buffer, cut to its size, and
+    // returns the length of the datagram; 0 when none is waiting.
+    virtual std::size_t receive(std::span<std::byte> buffer) noexcept = 0;
+};
+
+} // namespace hal
\ No newline at end of file
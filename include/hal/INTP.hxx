@@ -4,11 +4,37 @@
 
 namespace hal {
 
+// Time of day from a network time server. Exchanges are asynchronous: the
+// task asking never waits for the network, it is told the outcome from a
+// later update().
 class INTP {
   public:
+    struct Sample {
+        // Server time of day minus the local one, within half a day either
+        // way.
+        Milliseconds offset;
+        // Round trip spent on the network. The offset is off by up to half
+        // of it when the two ways take different times.
+        Milliseconds delay;
+    };
+
+    class IListener {
+      public:
+        virtual ~IListener() = default;
+        virtual void onSample(const Sample &sample) noexcept = 0;
+        // No valid reply before the timeout.
+        virtual void onFailure() noexcept = 0;
+    };
+
     virtual ~INTP() = default;
 
-    hal::Milliseconds obtainCurrentTimeOfDay() noexcept;
+    // Sends a request and returns at once. Returns false, and never tells
+    // listener, when a request is still in flight or could not be sent.
+    virtual bool request(IListener &listener) noexcept = 0;
+    // Takes in the reply or times the request out, calling the listener.
+    virtual void update(Milliseconds delta) noexcept = 0;
+    // Time until the request in flight times out, kForever when none is.
+    virtual Milliseconds nextDeadline() const noexcept = 0;
 };
 
 } // namespace hal
\ No newline at end of file
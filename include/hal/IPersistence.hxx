@@ -1,18 +1,59 @@
 #pragma once
 
 #include <cstdint>
-#include <string>
+#include <optional>
+#include <span>
+#include <string_view>
 
 namespace hal {
 
 class IPersistence {
   public:
+    // One key of a batched read or write. found is only set by getValues().
+    struct Entry {
+        std::string_view key;
+        std::int32_t value;
+        bool found;
+    };
+
     virtual ~IPersistence() = default;
 
-    virtual bool keyExists(const std::string &key) const noexcept = 0;
-    virtual std::int32_t getValue(const std::string &key) const noexcept = 0;
-    virtual void setValue(const std::string &key,
+    virtual bool keyExists(std::string_view key) const noexcept = 0;
+    virtual std::int32_t getValue(std::string_view key) const noexcept = 0;
+    virtual void setValue(std::string_view key,
                           std::int32_t value) noexcept = 0;
+
+    // keyExists() and getValue() in a single lookup.
+    virtual std::optional<std::int32_t>
+    tryGet(std::string_view key) const noexcept {
+        if (!keyExists(key)) {
+            return std::nullopt;
+        }
+
+        return getValue(key);
+    }
+
+    // Batched counterparts of tryGet() and setValue(). Backends which can
+    // read or commit several keys in one go override them; the defaults go
+    // key by key.
+    virtual void getValues(std::span<Entry> entries) const noexcept {
+        for (auto &entry : entries) {
+            auto value = tryGet(entry.key);
+            entry.found = value.has_value();
+            entry.value = value.value_or(0);
+        }
+    }
+
+    virtual void setValues(std::span<const Entry> entries) noexcept {
+        for (const auto &entry : entries) {
+            setValue(entry.key, entry.value);
+        }
+    }
+
+    // Housekeeping such as compaction which the backend would rather not do
+    // while writing. Called from a low priority task when it has nothing
+    // else to do.
+    virtual void maintain() noexcept {}
 };
 
 } // namespace hal
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+namespace hal {
+
+// Flash-like byte medium. erase() sets whole sectors to kErased and write()
+// may only program erased bytes, so every byte is written at most once
+// between two erases.
+class IStorage {
+  public:
+    static constexpr std::byte kErased{0xFF};
+
+    virtual ~IStorage() = default;
+
+    virtual std::size_t size() const noexcept = 0;
+    // Erase granularity, offsets and lengths passed to erase() are multiples
+    // of it.
+    virtual std::size_t sectorSize() const noexcept = 0;
+    virtual bool read(std::size_t offset,
+                      std::span<std::byte> data) const noexcept = 0;
+    virtual bool write(std::size_t offset,
+                       std::span<const std::byte> data) noexcept = 0;
+    virtual bool erase(std::size_t offset, std::size_t length) noexcept = 0;
+    // Makes the writes so far durable.
+    virtual bool sync() noexcept { return true; }
+};
+
+} // namespace hal
\ No newline at end of file
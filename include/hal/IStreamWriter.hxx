@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+namespace hal {
+
+// Byte stream out of the device, e.g. a UART or a file.
+class IStreamWriter {
+  public:
+    virtual ~IStreamWriter() = default;
+    // Returns how many bytes were taken, which is less than data.size()
+    // when the stream is full.
+    virtual std::size_t write(std::span<const std::byte> data) noexcept = 0;
+};
+
+} // namespace hal
\ No newline at end of file
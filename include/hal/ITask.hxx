@@ -5,24 +5,109 @@
 #include <staircase/IRunnable.hxx>
 
 #include <atomic>
+#include <cstdint>
 
 namespace hal {
 
 class ITask {
   public:
+    // What deadline mode does with releases which passed while the runnable
+    // was still busy or the task was not scheduled.
+    enum class OverrunPolicy : std::uint8_t {
+        // One run whose delta covers all the missed time.
+        COALESCE,
+        // One run per missed period, up to kMaxReplays, then the rest
+        // coalesced into the last one.
+        REPLAY,
+        // One run whose delta leaves the missed periods out.
+        SKIP,
+    };
+
+    struct Stats {
+        std::uint32_t runs;
+        // Releases with at least one whole period missed, and how many
+        // periods that was in total.
+        std::uint32_t overruns;
+        std::uint32_t missedPeriods;
+        // Worst start of a run after its release.
+        Milliseconds maxLateness;
+        // Waits on the sensor edge while the runnable was idle.
+        std::uint32_t parks;
+    };
+
+    static constexpr std::uint32_t kMaxReplays = 16;
+
     ITask(staircase::IRunnable &runnable, hal::Milliseconds period);
     virtual ~ITask() = default;
 
     virtual Milliseconds getDelta() const noexcept = 0;
+    Milliseconds getPeriod() const noexcept;
+    // Time the current run() has to account for: getDelta(), or in deadline
+    // mode the share of elapsed time the overrun policy hands to this run.
+    Milliseconds delta() const noexcept;
     void loop() noexcept;
+    // Makes loop() return once the current run() is done, waking the task
+    // if it sleeps. Safe to call from any task.
+    void stop() noexcept;
+    bool isRunning() const noexcept;
+
+    // Switches loop() from sleeping a relative time after each run to
+    // releasing the runnable on a fixed grid of absolute deadlines, so the
+    // run time and the wake-up jitter do not add up to drift. Call before
+    // loop().
+    void setDeadlineMode(OverrunPolicy policy) noexcept;
+    Stats getStats() const noexcept;
+
+    // Cuts a sleepFor() short. Platforms call this from the sensor edge
+    // interrupt so a task sleeping until its next deadline still reacts to
+    // input immediately.
+    virtual void wake() noexcept {}
 
   protected:
     virtual void sleep() noexcept = 0;
+    // Sleeps for at most millis or until wake(); kForever means only wake()
+    // ends the sleep. Defaults to the fixed period sleep().
+    virtual void sleepFor(Milliseconds millis) noexcept;
+    // Monotonic time, needed by deadline mode.
+    virtual Timestamp now() const noexcept = 0;
+    // Sleeps until the deadline or wake(), returning at once if it has
+    // passed. Defaults to sleepFor() the time left.
+    virtual void sleepUntil(Timestamp deadline) noexcept;
+    // Waits for a sensor edge or wake() while the runnable is idle. Platforms
+    // override this with a light sleep only the edge interrupts end, and the
+    // delta of the next run has to include the time parked. Defaults to
+    // sleepFor(kForever).
+    virtual void park() noexcept;
+    // Stats bookkeeping for loops other than loop(). Returns the number of
+    // whole periods the release was late by.
+    std::uint32_t recordRelease(Milliseconds late) noexcept;
+    void recordRun() noexcept;
+    void recordPark() noexcept;
     hal::Milliseconds mPeriod;
 
   private:
+    void loopRelative() noexcept;
+    void loopDeadlines() noexcept;
+    void release(Timestamp start) noexcept;
+    void runWith(Milliseconds delta) noexcept;
+    void schedule() noexcept;
+    bool parkIfIdle() noexcept;
+
     staircase::IRunnable &mRunnable;
     std::atomic_bool mRunning;
+    bool mDeadlineMode;
+    OverrunPolicy mPolicy;
+    // Deadline mode state, only touched by loop().
+    bool mHasRelease;
+    Timestamp mRelease;
+    Timestamp mAccounted;
+    Milliseconds mDelta;
+    // Written by loop() only, readable from anywhere.
+    std::atomic<std::uint32_t> mRuns;
+    std::atomic<std::uint32_t> mOverruns;
+    std::atomic<std::uint32_t> mMissedPeriods;
+    std::atomic<Milliseconds> mMaxLateness;
+    std::atomic<std::uint32_t> mParks;
 };
 
 } // namespace hal
\ No newline at end of file
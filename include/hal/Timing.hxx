@@ -5,6 +5,27 @@
 namespace hal {
 
 using Milliseconds = std::int32_t;
+using Timestamp = std::uint32_t;
 constexpr Milliseconds kForever = -1;
 
-} // namespace hal
\ No newline at end of file
+// Milliseconds from one monotonic timestamp to another, correct across the
+// wrap of the 32-bit counter as long as they are less than ~24 days apart.
+constexpr Milliseconds elapsed(Timestamp from, Timestamp to) noexcept {
+    return static_cast<Milliseconds>(to - from);
+}
+
+// Earlier of two relative deadlines, where kForever means "no deadline".
+constexpr Milliseconds earliestDeadline(Milliseconds first,
+                                        Milliseconds second) noexcept {
+    if (first == kForever) {
+        return second;
+    }
+
+    if (second == kForever) {
+        return first;
+    }
+
+    return (first < second) ? first : second;
+}
+
+} // namespace hal
@@ -1,10 +1,11 @@
 #pragma once
 
-#include <hal/BinaryValue.hxx>
+#include <hal/Adapters.hxx>
 #include <hal/IBinaryValueWriter.hxx>
 #include <hal/Timing.hxx>
 
 #include <staircase/IBasicLight.hxx>
+#include <staircase/StaticBasicLight.hxx>
 
 namespace staircase {
 
@@ -25,16 +26,10 @@ class BasicLight final : public IBasicLight {
 
     bool isOn() const noexcept final;
     bool isOff() const noexcept final;
+    hal::Milliseconds nextDeadline() const noexcept final;
 
   private:
-    enum class LightState { OFF, ON };
-
-    void setState(LightState state, hal::Milliseconds millis) noexcept;
-    void writeState() noexcept;
-
-    hal::IBinaryValueWriter &mBinaryValueWriter;
-    LightState mState;
-    hal::Milliseconds mTimeLeft;
+    StaticBasicLight<hal::BinaryWriterAdapter> mLight;
 };
 
-} // namespace staircase
\ No newline at end of file
+} // namespace staircase
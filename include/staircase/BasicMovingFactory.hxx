@@ -26,9 +26,13 @@ class BasicMovingFactory final : public IMovingFactory {
                      IMoving::Direction direction,
                      hal::Milliseconds duration) noexcept final {
         return MovingPtr{
-            new Moving{lights, durationCalculator, direction, duration},
+            new Moving{lights, mTimelines.get(durationCalculator, duration),
+                       direction},
             [](IMoving *moving) { delete moving; }};
     }
+
+  private:
+    Moving::TimelineCache mTimelines;
 };
 
 } // namespace staircase
\ No newline at end of file
@@ -13,10 +13,5 @@ class ClippedSquaredMovingDurationCalculator final
     hal::Milliseconds
     calculateDelta(std::size_t lightIndex,
                    hal::Milliseconds totalDuration) const noexcept override;
-
-  private:
-    static constexpr hal::Milliseconds kFirstLightDelta = 500;
-    static constexpr hal::Milliseconds kSecondLightDelta = 750;
-    static constexpr hal::Milliseconds kThirdLightDelta = 1200;
 };
 } // namespace staircase
\ No newline at end of file
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <hal/INTP.hxx>
+#include <hal/Timing.hxx>
+
+#include <cstdint>
+
+namespace staircase {
+
+// Turns time server samples into RTC corrections. The first sample and any
+// offset past kStepThreshold are stepped; smaller offsets are slewed out at
+// kMaxSlewPpm so the lights never see the time jump. The frequency error of
+// the RTC is learnt from what each sample shows the previous corrections
+// missed, and is compensated continuously in between. The poll interval
+// doubles once samples keep agreeing with that prediction and halves when
+// one does not.
+class ClockDiscipline {
+  public:
+    static constexpr hal::Milliseconds kStepThreshold = 1000;
+    static constexpr std::int32_t kMaxSlewPpm = 500;
+    static constexpr std::int32_t kMaxDriftPpm = 500;
+    static constexpr hal::Milliseconds kMinPollInterval = 64 * 1000;
+    static constexpr hal::Milliseconds kMaxPollInterval = 4096 * 1000;
+    static constexpr hal::Milliseconds kRetryInterval = 16 * 1000;
+    // Samples in a row within tolerance before the poll interval doubles.
+    static constexpr std::uint32_t kAgreeingSamples = 4;
+
+    ClockDiscipline() noexcept;
+
+    ClockDiscipline(const ClockDiscipline &) = delete;
+    ClockDiscipline(ClockDiscipline &&) noexcept = delete;
+    ClockDiscipline &operator=(const ClockDiscipline &) = delete;
+    ClockDiscipline &operator=(ClockDiscipline &&) noexcept = delete;
+
+    ~ClockDiscipline() = default;
+
+    void addSample(const hal::INTP::Sample &sample) noexcept;
+    // Returns the milliseconds to adjust the RTC by after delta passed.
+    hal::Milliseconds update(hal::Milliseconds delta) noexcept;
+    // Time until update() has another millisecond to hand out, kForever
+    // when nothing is being corrected.
+    hal::Milliseconds nextDeadline() const noexcept;
+
+    bool isSynchronised() const noexcept { return mSynchronised; }
+    hal::Milliseconds getPollInterval() const noexcept {
+        return mPollInterval;
+    }
+    // Positive when the RTC runs slow.
+    std::int32_t getDriftPpm() const noexcept { return mDriftPpm; }
+
+  private:
+    static constexpr std::int64_t kNanosPerMilli = 1000 * 1000;
+    // Least time between two samples to learn the frequency from, and the
+    // share of the measured frequency error taken over per sample.
+    static constexpr hal::Milliseconds kMinFrequencyInterval = 16 * 1000;
+    static constexpr std::int32_t kFrequencyGain = 2;
+    static constexpr hal::Milliseconds kMinTolerance = 2;
+
+    void step(hal::Milliseconds offset) noexcept;
+    void adaptPollInterval(std::int64_t error,
+                           hal::Milliseconds tolerance) noexcept;
+    std::int64_t rate() const noexcept;
+
+    bool mSynchronised;
+    std::int32_t mDriftPpm;
+    hal::Milliseconds mPollInterval;
+    std::uint32_t mAgreeing;
+    std::int64_t mSinceSample;
+    hal::Milliseconds mStep;
+    // Offset still to be slewed out and the correction below a millisecond
+    // not handed out yet, in nanoseconds.
+    std::int64_t mPending;
+    std::int64_t mResidue;
+};
+
+} // namespace staircase
\ No newline at end of file
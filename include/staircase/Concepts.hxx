@@ -0,0 +1,49 @@
+#pragma once
+
+#include <hal/Timing.hxx>
+
+#include <concepts>
+#include <cstdint>
+
+namespace staircase {
+
+// Compile-time counterparts of the I* interfaces. The interfaces satisfy them
+// as well, so a Static* component instantiated over an interface behaves like
+// the virtual build and accepts the test mocks.
+
+template <class T>
+concept Light = requires(T &light, const T &constLight,
+                         hal::Milliseconds millis) {
+    light.turnOn(millis);
+    light.turnOff();
+    light.update(millis);
+    { constLight.isOn() } -> std::convertible_to<bool>;
+    { constLight.nextDeadline() } -> std::same_as<hal::Milliseconds>;
+};
+
+template <class T>
+concept Sensor = requires(T &sensor, const T &constSensor,
+                          hal::Milliseconds millis) {
+    sensor.update(millis);
+    { constSensor.hasStateChanged() } -> std::convertible_to<bool>;
+    { constSensor.isClose() } -> std::convertible_to<bool>;
+    { constSensor.nextDeadline() } -> std::same_as<hal::Milliseconds>;
+};
+
+template <class T>
+concept DurationCalculator = requires(const T &calculator, std::size_t index,
+                                      hal::Milliseconds millis) {
+    {
+        calculator.calculateDelta(index, millis)
+    } -> std::same_as<hal::Milliseconds>;
+};
+
+template <class T>
+concept MovingTimeFilter = requires(T &filter, const T &constFilter,
+                                    hal::Milliseconds millis) {
+    { constFilter.getCurrentMovingTime() } -> std::same_as<hal::Milliseconds>;
+    filter.processNewMovingTime(millis);
+    filter.reset(millis);
+};
+
+} // namespace staircase
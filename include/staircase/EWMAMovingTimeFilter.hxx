@@ -0,0 +1,50 @@
+#pragma once
+
+#include <hal/Timing.hxx>
+
+#include <staircase/IMovingTimeFilter.hxx>
+
+#include <cstdint>
+
+namespace staircase {
+
+// Exponentially weighted moving average with a smoothing factor of
+// 2^-AlphaShift, in fixed point with kFractionBits fractional bits. It keeps
+// no history, so it follows a slowly drifting walking speed without a window
+// to fill, while a single outlier still moves it by only its share.
+template <std::size_t AlphaShift = 2>
+class EWMAMovingTimeFilter final : public IMovingTimeFilter {
+  public:
+    static constexpr std::size_t kFractionBits = 16;
+
+    static_assert(AlphaShift < kFractionBits,
+                  "smoothing factor below the fixed point resolution");
+
+    EWMAMovingTimeFilter(hal::Milliseconds initialFilterValue) noexcept {
+        reset(initialFilterValue);
+    }
+
+    hal::Milliseconds getCurrentMovingTime() const noexcept override {
+        return static_cast<hal::Milliseconds>(
+            (mValue + (std::int64_t{1} << (kFractionBits - 1))) >>
+            kFractionBits);
+    }
+
+    void processNewMovingTime(hal::Milliseconds timeElapsed) noexcept override {
+        mValue += (toFixed(timeElapsed) - mValue) >> AlphaShift;
+    }
+
+    void reset(hal::Milliseconds timeElapsed) noexcept override {
+        mValue = toFixed(timeElapsed);
+    }
+
+  private:
+    static constexpr std::int64_t toFixed(hal::Milliseconds value) noexcept {
+        return static_cast<std::int64_t>(value) * (std::int64_t{1}
+                                                   << kFractionBits);
+    }
+
+    std::int64_t mValue;
+};
+
+} // namespace staircase
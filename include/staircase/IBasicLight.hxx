@@ -20,6 +20,8 @@ class IBasicLight {
     virtual void update(hal::Milliseconds delta) noexcept = 0;
     virtual bool isOn() const noexcept = 0;
     virtual bool isOff() const noexcept = 0;
+    // Time until the light switches itself off, kForever if it never will.
+    virtual hal::Milliseconds nextDeadline() const noexcept = 0;
 };
 
 using BasicLights =
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <hal/Timing.hxx>
+
+#include <staircase/ILightPort.hxx>
+
+#include <cstdint>
+#include <span>
+
+namespace staircase {
+
+class ILightBank : public ILightPort {
+  public:
+    virtual void update(hal::Milliseconds delta) noexcept = 0;
+    // Time until the first light switches itself off, kForever if none will.
+    virtual hal::Milliseconds nextDeadline() const noexcept = 0;
+    // Copies the on/off state, light i into bit (i % 32) of word (i / 32).
+    // Words past the bank are left alone.
+    virtual void copyState(std::span<std::uint32_t> words) const noexcept = 0;
+};
+
+} // namespace staircase
@@ -0,0 +1,11 @@
+#pragma once
+
+namespace staircase {
+
+class ILightPort {
+  public:
+    virtual ~ILightPort() = default;
+    virtual void flush() noexcept = 0;
+};
+
+} // namespace staircase
@@ -2,9 +2,11 @@
 
 #include <hal/Timing.hxx>
 
-#include <deque>
-#include <functional>
+#include <util/StaticDequeue.hxx>
+
+#include <cstdint>
 #include <memory>
+#include <type_traits>
 
 namespace staircase {
 
@@ -21,9 +23,49 @@ class IMoving {
     virtual bool isNearEnd() const noexcept = 0;
     virtual bool isNearBegin() const noexcept = 0;
     virtual bool isTooOld() const noexcept = 0;
+    // Time until the next light is turned on, kForever once completed.
+    virtual hal::Milliseconds nextDeadline() const noexcept = 0;
+};
+
+// Deleter for MovingPtr that never allocates: it is either a plain function
+// with an opaque context and handle (used by pooled factories) or a
+// captureless callable which is re-created through a trampoline when the
+// moving is released.
+class MovingDeleter {
+  public:
+    using Function = void (*)(IMoving *moving, void *context,
+                              std::uint32_t handle);
+
+    constexpr MovingDeleter() noexcept = default;
+
+    constexpr MovingDeleter(Function function, void *context,
+                            std::uint32_t handle = 0) noexcept
+        : mFunction{function}, mContext{context}, mHandle{handle} {}
+
+    template <typename F>
+        requires std::is_empty_v<F> && std::is_default_constructible_v<F> &&
+                 std::is_invocable_v<F, IMoving *>
+    constexpr MovingDeleter(F) noexcept
+        : mFunction{&trampoline<F>}, mContext{nullptr} {}
+
+    void operator()(IMoving *moving) const noexcept {
+        if (mFunction) {
+            mFunction(moving, mContext, mHandle);
+        }
+    }
+
+  private:
+    template <typename F>
+    static void trampoline(IMoving *moving, void *, std::uint32_t) {
+        F{}(moving);
+    }
+
+    Function mFunction{nullptr};
+    void *mContext{nullptr};
+    std::uint32_t mHandle{0};
 };
 
-using MovingPtr = std::unique_ptr<IMoving, std::function<void(IMoving *)>>;
-using Movings = std::deque<MovingPtr>;
+using MovingPtr = std::unique_ptr<IMoving, MovingDeleter>;
+using Movings = util::StaticDequeue<MovingPtr, IMoving::kMaxMovings>;
 
-} // namespace staircase
\ No newline at end of file
+} // namespace staircase
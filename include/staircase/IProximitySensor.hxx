@@ -11,6 +11,10 @@ class IProximitySensor {
     virtual bool isClose() const noexcept = 0;
     virtual bool isFar() const noexcept = 0;
     virtual void update(hal::Milliseconds delta) noexcept = 0;
+    // Time until a pending state change is debounced or, for a sensor which
+    // polls its pin, until the pin is to be read again. kForever only when
+    // an edge will wake the caller.
+    virtual hal::Milliseconds nextDeadline() const noexcept = 0;
 };
 
 } // namespace staircase
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <hal/Timing.hxx>
+
 namespace hal {
 class ITask;
 }
@@ -12,6 +14,12 @@ class IRunnable {
     virtual ~IRunnable() = default;
 
     virtual void run() noexcept = 0;
+    // How long the parent task may sleep before calling run() again.
+    // Defaults to the task period.
+    virtual hal::Milliseconds nextDeadline() const noexcept;
+    // Whether run() has nothing to do until a sensor edge or wake(), so the
+    // parent task may park. Defaults to false.
+    virtual bool isIdle() const noexcept;
     void setParentTask(hal::ITask *task) noexcept;
 
   protected:
@@ -2,6 +2,9 @@
 
 #include <hal/Timing.hxx>
 
+#include <staircase/LooperCommand.hxx>
+#include <staircase/LooperSnapshot.hxx>
+
 #include <mutex>
 
 namespace staircase {
@@ -10,6 +13,25 @@ class IStaircaseLooper {
   public:
     virtual ~IStaircaseLooper() = default;
     virtual void update(hal::Milliseconds delta) noexcept = 0;
+    // Time until the looper has something to do on its own (a light expiring,
+    // a moving stepping, a sensor finishing its debounce). kForever means it
+    // only needs to run again on a sensor edge.
+    virtual hal::Milliseconds nextDeadline() const noexcept = 0;
+    // No movings, every light off and both sensors waiting for an edge which
+    // will wake the task: nothing happens until such an edge or a posted
+    // command, so the task may park on the sensor edge wait rather than sleep
+    // until a deadline. Never true on a sensor which polls its pin, as only
+    // an edge-queue sensor is woken by the pin interrupt.
+    virtual bool isIdle() const noexcept = 0;
+    // Queues a command for the next update. Safe to call from any thread and
+    // never blocks; returns false when the queue is full. Wake the task
+    // afterwards if it may be sleeping until nextDeadline().
+    virtual bool post(const LooperCommand &command) noexcept = 0;
+    // Consistent copy of the state published by the last update. Safe to
+    // call from any thread and never delays the update.
+    virtual LooperSnapshot snapshot() const noexcept = 0;
+    // Deprecated, use post(). Updates taken while the guard is held are
+    // deferred rather than waited for.
     virtual std::lock_guard<std::mutex> block() noexcept = 0;
 };
 
@@ -0,0 +1,244 @@
+#pragma once
+
+#include <hal/IBinaryPortWriter.hxx>
+#include <hal/Timing.hxx>
+
+#include <staircase/IBasicLight.hxx>
+#include <staircase/ILightBank.hxx>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <utility>
+
+namespace staircase {
+
+// Structure-of-arrays storage for a whole staircase of lights. The bank keeps
+// its own clock and every light with a running timer stores its absolute
+// expiry, so turning a light on or re-arming it is O(1). Lights with a timer
+// form an active set bitmask next to the on/off state, and the earliest
+// expiry is cached: a tick on which nothing expires is a single comparison,
+// and the others visit only the active lights. The state is pushed to the
+// port writer on flush(). getLights() exposes thin IBasicLight views which
+// Moving uses to turn single lights on.
+template <std::size_t N> class LightBank final : public ILightBank {
+  public:
+    using Word = hal::IBinaryPortWriter::Word;
+
+    static constexpr std::size_t kLightsNum = N;
+    static constexpr std::size_t kWordBits = hal::IBinaryPortWriter::kWordBits;
+    static constexpr std::size_t kWordsNum = (N + kWordBits - 1) / kWordBits;
+
+    using Lights = std::array<std::reference_wrapper<IBasicLight>, N>;
+    using Words = std::array<Word, kWordsNum>;
+
+    class Light final : public IBasicLight {
+      public:
+        Light(LightBank &bank, std::size_t index) noexcept
+            : mBank{bank}, mIndex{index} {}
+
+        void
+        turnOn(hal::Milliseconds millis = kDefaultOnPeriod) noexcept final {
+            mBank.turnOn(mIndex, millis);
+        }
+        void turnOff() noexcept final { mBank.turnOff(mIndex); }
+        void update(hal::Milliseconds delta) noexcept final {
+            mBank.update(mIndex, delta);
+        }
+        bool isOn() const noexcept final { return mBank.isOn(mIndex); }
+        bool isOff() const noexcept final { return !mBank.isOn(mIndex); }
+        hal::Milliseconds nextDeadline() const noexcept final {
+            return mBank.nextDeadline(mIndex);
+        }
+
+      private:
+        LightBank &mBank;
+        std::size_t mIndex;
+    };
+
+    LightBank(hal::IBinaryPortWriter &portWriter) noexcept
+        : mPortWriter{portWriter},
+          mLights{makeLights(std::make_index_sequence<N>{})},
+          mLightRefs{makeLightRefs(std::make_index_sequence<N>{})},
+          mExpiry{}, mNow{0}, mEarliest{0}, mState{}, mWritten{}, mForever{},
+          mTimed{} {
+        mPortWriter.writePort(mWritten);
+    }
+
+    LightBank(const LightBank &) = delete;
+    LightBank(LightBank &&) noexcept = delete;
+    LightBank &operator=(const LightBank &) = delete;
+    LightBank &operator=(LightBank &&) noexcept = delete;
+
+    ~LightBank() = default;
+
+    Lights &getLights() noexcept { return mLightRefs; }
+
+    void turnOn(std::size_t index, hal::Milliseconds millis =
+                                       IBasicLight::kDefaultOnPeriod) noexcept {
+        if (millis == hal::kForever) {
+            mForever[index / kWordBits] |= bit(index);
+        } else {
+            arm(index, mNow + static_cast<hal::Timestamp>(millis));
+        }
+
+        mState[index / kWordBits] |= bit(index);
+    }
+
+    void turnOff(std::size_t index) noexcept {
+        mTimed[index / kWordBits] &= ~bit(index);
+        mForever[index / kWordBits] &= ~bit(index);
+        mState[index / kWordBits] &= ~bit(index);
+    }
+
+    bool isOn(std::size_t index) const noexcept {
+        return (mState[index / kWordBits] & bit(index)) != 0;
+    }
+
+    void update(hal::Milliseconds delta) noexcept final {
+        mNow += static_cast<hal::Timestamp>(delta);
+
+        if (hal::elapsed(mNow, mEarliest) > 0 || isIdle()) {
+            return;
+        }
+
+        expire();
+    }
+
+    // Only this light's timer moves on, the bank clock stays where it is.
+    void update(std::size_t index, hal::Milliseconds delta) noexcept {
+        if (!isTimed(index)) {
+            return;
+        }
+
+        if (delta >= hal::elapsed(mNow, mExpiry[index])) {
+            clearTimer(index);
+        } else {
+            mExpiry[index] -= static_cast<hal::Timestamp>(delta);
+            mEarliest = earlier(mEarliest, mExpiry[index]);
+        }
+    }
+
+    // Never late, but may be early after the earliest light was re-armed;
+    // the update at that time then finds the real earliest expiry.
+    hal::Milliseconds nextDeadline() const noexcept final {
+        if (isIdle()) {
+            return hal::kForever;
+        }
+
+        return std::max(hal::elapsed(mNow, mEarliest), 0);
+    }
+
+    hal::Milliseconds nextDeadline(std::size_t index) const noexcept {
+        if (!isTimed(index)) {
+            return hal::kForever;
+        }
+
+        return hal::elapsed(mNow, mExpiry[index]);
+    }
+
+    void flush() noexcept final {
+        if (mState == mWritten) {
+            return;
+        }
+
+        mWritten = mState;
+        mPortWriter.writePort(mWritten);
+    }
+
+    const Words &getState() const noexcept { return mState; }
+
+    void copyState(std::span<std::uint32_t> words) const noexcept final {
+        std::copy_n(std::begin(mState), std::min(kWordsNum, words.size()),
+                    std::begin(words));
+    }
+
+  private:
+    static constexpr Word bit(std::size_t index) noexcept {
+        return Word{1} << (index % kWordBits);
+    }
+
+    static hal::Timestamp earlier(hal::Timestamp first,
+                                  hal::Timestamp second) noexcept {
+        return (hal::elapsed(first, second) < 0) ? second : first;
+    }
+
+    static hal::Timestamp later(hal::Timestamp first,
+                                hal::Timestamp second) noexcept {
+        return (hal::elapsed(first, second) > 0) ? second : first;
+    }
+
+    bool isTimed(std::size_t index) const noexcept {
+        return (mTimed[index / kWordBits] & bit(index)) != 0;
+    }
+
+    bool isIdle() const noexcept {
+        return std::all_of(std::begin(mTimed), std::end(mTimed),
+                           [](Word word) { return word == 0; });
+    }
+
+    void arm(std::size_t index, hal::Timestamp expiry) noexcept {
+        if (isTimed(index)) {
+            mExpiry[index] = later(mExpiry[index], expiry);
+        } else {
+            mEarliest = isIdle() ? expiry : earlier(mEarliest, expiry);
+            mExpiry[index] = expiry;
+            mTimed[index / kWordBits] |= bit(index);
+        }
+    }
+
+    void clearTimer(std::size_t index) noexcept {
+        mTimed[index / kWordBits] &= ~bit(index);
+        mState[index / kWordBits] &= ~bit(index) | mForever[index / kWordBits];
+    }
+
+    // Switches off every active light which is due and finds the next
+    // expiry among the remaining ones.
+    void expire() noexcept {
+        bool found = false;
+
+        for (std::size_t word = 0; word < kWordsNum; ++word) {
+            Word timed = mTimed[word];
+
+            while (timed != 0) {
+                std::size_t index =
+                    word * kWordBits + std::countr_zero(timed);
+                timed &= timed - 1;
+
+                if (hal::elapsed(mNow, mExpiry[index]) <= 0) {
+                    clearTimer(index);
+                } else {
+                    mEarliest = found ? earlier(mEarliest, mExpiry[index])
+                                      : mExpiry[index];
+                    found = true;
+                }
+            }
+        }
+    }
+
+    template <std::size_t... I>
+    std::array<Light, N> makeLights(std::index_sequence<I...>) noexcept {
+        return {Light{*this, I}...};
+    }
+
+    template <std::size_t... I>
+    Lights makeLightRefs(std::index_sequence<I...>) noexcept {
+        return {mLights[I]...};
+    }
+
+    hal::IBinaryPortWriter &mPortWriter;
+    std::array<Light, N> mLights;
+    Lights mLightRefs;
+    alignas(64) std::array<hal::Timestamp, N> mExpiry;
+    hal::Timestamp mNow;
+    hal::Timestamp mEarliest;
+    Words mState;
+    Words mWritten;
+    Words mForever;
+    Words mTimed;
+};
+
+} // namespace staircase
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <hal/BinaryValue.hxx>
+#include <hal/IBinaryPortWriter.hxx>
+#include <hal/IBinaryValueWriter.hxx>
+
+#include <staircase/IBasicLight.hxx>
+#include <staircase/ILightPort.hxx>
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+namespace staircase {
+
+// Batches light outputs into a single port write. Every light gets a Pin which
+// a BasicLight writes into; a pin only marks its bit, and flush() pushes the
+// whole bank to the hardware if anything differs from the last write. A light
+// that turns off and on again within one tick therefore costs no transaction.
+class LightPort final : public ILightPort {
+  public:
+    using Word = hal::IBinaryPortWriter::Word;
+
+    static constexpr std::size_t kWordBits = hal::IBinaryPortWriter::kWordBits;
+    static constexpr std::size_t kWordsNum =
+        (IBasicLight::kLightsNum + kWordBits - 1) / kWordBits;
+
+    using Words = std::array<Word, kWordsNum>;
+
+    class Pin final : public hal::IBinaryValueWriter {
+      public:
+        Pin(LightPort &port, std::size_t index) noexcept;
+
+        void writeValue(hal::BinaryValue value) noexcept final;
+
+      private:
+        LightPort &mPort;
+        std::size_t mIndex;
+    };
+
+    LightPort(hal::IBinaryPortWriter &portWriter) noexcept;
+
+    LightPort(const LightPort &) = delete;
+    LightPort(LightPort &&) noexcept = delete;
+    LightPort &operator=(const LightPort &) = delete;
+    LightPort &operator=(LightPort &&) noexcept = delete;
+
+    ~LightPort() = default;
+
+    void flush() noexcept final;
+
+    Pin &getPin(std::size_t index) noexcept;
+    void set(std::size_t index, bool on) noexcept;
+    bool isSet(std::size_t index) const noexcept;
+    bool isDirty() const noexcept;
+
+  private:
+    template <std::size_t... I>
+    std::array<Pin, IBasicLight::kLightsNum>
+    makePins(std::index_sequence<I...>) noexcept {
+        return {Pin{*this, I}...};
+    }
+
+    hal::IBinaryPortWriter &mPortWriter;
+    std::array<Pin, IBasicLight::kLightsNum> mPins;
+    Words mState;
+    Words mWritten;
+};
+
+} // namespace staircase
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <hal/IPersistence.hxx>
+#include <hal/IStorage.hxx>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace staircase {
+
+// Log-structured IPersistence over a flash-like storage. The storage is split
+// into two banks; the active one holds a header and an append-only log of
+// CRC-checked records, each of them a whole setValues() batch, so a batch is
+// either applied completely or not at all. mount() replays the log into a RAM
+// index once and every read is served from it without touching the storage.
+// When the log fills up the live values are compacted into the other bank,
+// which only becomes active once its header is written, so power loss at any
+// point leaves the last committed state readable. maintain() compacts ahead
+// of time so the writes themselves rarely have to.
+class LogStore final : public hal::IPersistence {
+  public:
+    static constexpr std::size_t kMaxKeys = 32;
+    static constexpr std::size_t kMaxKeyLength = 15;
+
+    explicit LogStore(hal::IStorage &storage) noexcept;
+
+    LogStore(const LogStore &) = delete;
+    LogStore(LogStore &&) noexcept = delete;
+    LogStore &operator=(const LogStore &) = delete;
+    LogStore &operator=(LogStore &&) noexcept = delete;
+
+    ~LogStore() = default;
+
+    // Loads the index from the newest valid bank, formatting the storage
+    // when there is none. Returns false when the storage is unusable.
+    bool mount() noexcept;
+
+    bool keyExists(std::string_view key) const noexcept override;
+    std::int32_t getValue(std::string_view key) const noexcept override;
+    void setValue(std::string_view key, std::int32_t value) noexcept override;
+    std::optional<std::int32_t>
+    tryGet(std::string_view key) const noexcept override;
+    void getValues(std::span<Entry> entries) const noexcept override;
+    // Appends the entries whose value differs from the stored one as a single
+    // record. Keys longer than kMaxKeyLength or beyond kMaxKeys are dropped.
+    void setValues(std::span<const Entry> entries) noexcept override;
+    // Compacts once the active bank is three quarters full.
+    void maintain() noexcept override;
+
+    // Rewrites the live values into the other bank and switches to it.
+    bool compact() noexcept;
+    std::size_t keysNum() const noexcept { return mKeysNum; }
+    // Bytes of the active bank in use, header included.
+    std::size_t usedBytes() const noexcept { return mWriteOffset; }
+    std::size_t bankSize() const noexcept { return mBankSize; }
+
+  private:
+    struct Slot {
+        std::uint32_t hash;
+        std::uint8_t keyLength;
+        std::array<char, kMaxKeyLength> key;
+        std::int32_t value;
+
+        std::string_view name() const noexcept {
+            return {key.data(), keyLength};
+        }
+    };
+
+    static constexpr std::size_t kBankHeaderSize = 16;
+    static constexpr std::size_t kRecordHeaderSize = 8;
+    static constexpr std::size_t kEntrySize = 1 + kMaxKeyLength + 4;
+    static constexpr std::size_t kMaxRecordSize =
+        kRecordHeaderSize + kMaxKeys * kEntrySize;
+
+    using Record = std::array<std::byte, kMaxRecordSize>;
+
+    static std::size_t encode(std::byte *out, std::string_view key,
+                              std::int32_t value) noexcept;
+    // Fills in the record header and returns the encoded record.
+    static std::span<const std::byte>
+    seal(Record &record, std::size_t size, std::size_t count) noexcept;
+
+    // Index of key in mSlots, mKeysNum when it is not there.
+    std::size_t indexOf(std::string_view key) const noexcept;
+    // Stores the entries of an encoded record in the index. Returns false if
+    // the record is malformed.
+    bool apply(std::span<const std::byte> record) noexcept;
+    std::size_t bankOffset(std::size_t bank) const noexcept;
+    std::optional<std::uint32_t>
+    readBankHeader(std::size_t bank) const noexcept;
+    // Replays the active bank. Returns false if it ends in a torn record.
+    bool replay() noexcept;
+    bool append(std::span<const std::byte> record) noexcept;
+
+    hal::IStorage &mStorage;
+    std::size_t mBankSize;
+    std::size_t mActiveBank;
+    std::uint32_t mGeneration;
+    std::size_t mWriteOffset;
+    std::array<Slot, kMaxKeys> mSlots;
+    std::size_t mKeysNum;
+};
+
+} // namespace staircase
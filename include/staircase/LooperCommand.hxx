@@ -0,0 +1,49 @@
+#pragma once
+
+#include <hal/Timing.hxx>
+
+#include <staircase/IMoving.hxx>
+
+namespace staircase {
+
+// Request from outside the control task, e.g. a manual override switch or a
+// configuration change, which the looper applies at the start of its next
+// update.
+struct LooperCommand {
+    enum class Type {
+        // Turn every light on for value milliseconds (kForever allowed).
+        FORCE_ON,
+        // Turn every light off and drop all movings.
+        FORCE_OFF,
+        // Reset the moving time filter of direction to value.
+        RESET_FILTER,
+        // Act as if a person started walking in direction.
+        INJECT_TRIGGER
+    };
+
+    static constexpr LooperCommand
+    forceOn(hal::Milliseconds millis = hal::kForever) noexcept {
+        return {Type::FORCE_ON, IMoving::Direction::UP, millis};
+    }
+
+    static constexpr LooperCommand forceOff() noexcept {
+        return {Type::FORCE_OFF, IMoving::Direction::UP, 0};
+    }
+
+    static constexpr LooperCommand
+    resetFilter(IMoving::Direction direction,
+                hal::Milliseconds movingTime) noexcept {
+        return {Type::RESET_FILTER, direction, movingTime};
+    }
+
+    static constexpr LooperCommand
+    injectTrigger(IMoving::Direction direction) noexcept {
+        return {Type::INJECT_TRIGGER, direction, 0};
+    }
+
+    Type type;
+    IMoving::Direction direction;
+    hal::Milliseconds value;
+};
+
+} // namespace staircase
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <hal/Timing.hxx>
+
+#include <staircase/IBasicLight.hxx>
+#include <staircase/IMoving.hxx>
+
+#include <array>
+#include <cstdint>
+
+namespace staircase {
+
+// Copy of the looper state as of the end of an update, for readers outside
+// the control task, sized for a staircase of LightsNum lights.
+template <std::size_t LightsNum, std::size_t MaxMovings>
+struct BasicLooperSnapshot {
+    static constexpr std::size_t kLightWordBits = 32;
+    static constexpr std::size_t kLightWordsNum =
+        (LightsNum + kLightWordBits - 1) / kLightWordBits;
+
+    using Lights = std::array<std::uint32_t, kLightWordsNum>;
+
+    struct Movings {
+        std::uint32_t count;
+        // Time passed since each active moving started, oldest first.
+        std::array<hal::Milliseconds, MaxMovings> timePassed;
+    };
+
+    bool isOn(std::size_t index) const noexcept {
+        return (lights[index / kLightWordBits] >> (index % kLightWordBits)) &
+               1;
+    }
+
+    // Number of updates published so far.
+    std::uint32_t updates;
+    Lights lights;
+    Movings downMovings;
+    Movings upMovings;
+    hal::Milliseconds downMovingTime;
+    hal::Milliseconds upMovingTime;
+    // Movings which reached the other sensor and were fed to the filter.
+    std::uint32_t downWalks;
+    std::uint32_t upWalks;
+    // Sensor activations at either end, walks or not.
+    std::uint32_t triggers;
+};
+
+using LooperSnapshot =
+    BasicLooperSnapshot<IBasicLight::kLightsNum, IMoving::kMaxMovings>;
+
+} // namespace staircase
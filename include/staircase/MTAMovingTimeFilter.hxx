@@ -4,23 +4,57 @@
 
 #include <staircase/IMovingTimeFilter.hxx>
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
 
 namespace staircase {
-class MTAMovingTimeFilter final : public IMovingTimeFilter {
+
+// Moving average over the last WindowSize moving times. The sum of the window
+// is kept up to date as values enter and leave it, so a new moving time costs
+// O(1) whatever the window size; it is 64-bit, so it cannot overflow.
+template <std::size_t WindowSize>
+class WindowedMTAMovingTimeFilter final : public IMovingTimeFilter {
   public:
-    MTAMovingTimeFilter(hal::Milliseconds initialFilterValue);
+    static_assert(WindowSize > 0, "window must hold at least one value");
 
-    hal::Milliseconds getCurrentMovingTime() const noexcept override;
-    void processNewMovingTime(hal::Milliseconds timeElapsed) noexcept override;
-    void reset(hal::Milliseconds timeElapsed) noexcept override;
+    WindowedMTAMovingTimeFilter(hal::Milliseconds initialFilterValue) noexcept {
+        reset(initialFilterValue);
+    }
 
-  private:
-    static constexpr std::size_t kMTASize = 5;
+    hal::Milliseconds getCurrentMovingTime() const noexcept override {
+        return mCurrentMovingTime;
+    }
+
+    void processNewMovingTime(hal::Milliseconds timeElapsed) noexcept override {
+        mSum += static_cast<std::int64_t>(timeElapsed) -
+                static_cast<std::int64_t>(mFilterValues[mCurrentIndex]);
+        mFilterValues[mCurrentIndex] = timeElapsed;
+
+        mCurrentIndex++;
+        if (mCurrentIndex == WindowSize) {
+            mCurrentIndex = 0;
+        }
+
+        mCurrentMovingTime = static_cast<hal::Milliseconds>(
+            mSum / static_cast<std::int64_t>(WindowSize));
+    }
 
-    std::array<hal::Milliseconds, kMTASize> mFilterValues;
+    void reset(hal::Milliseconds timeElapsed) noexcept override {
+        std::fill(std::begin(mFilterValues), std::end(mFilterValues),
+                  timeElapsed);
+        mSum = static_cast<std::int64_t>(timeElapsed) * WindowSize;
+        mCurrentMovingTime = timeElapsed;
+        mCurrentIndex = 0;
+    }
+
+  private:
+    std::array<hal::Milliseconds, WindowSize> mFilterValues;
+    std::int64_t mSum;
     std::size_t mCurrentIndex;
     hal::Milliseconds mCurrentMovingTime;
 };
-} // namespace staircase
\ No newline at end of file
+
+using MTAMovingTimeFilter = WindowedMTAMovingTimeFilter<5>;
+
+} // namespace staircase
@@ -4,7 +4,9 @@
 
 #include <staircase/IBasicLight.hxx>
 #include <staircase/IMoving.hxx>
-#include <staircase/IMovingDurationCalculator.hxx>
+#include <staircase/StaircaseConfig.hxx>
+#include <staircase/StaticMoving.hxx>
+#include <staircase/StepTimeline.hxx>
 
 #include <cstdint>
 
@@ -12,8 +14,12 @@ namespace staircase {
 
 class Moving : public IMoving {
   public:
-    Moving(BasicLights &lights, IMovingDurationCalculator &durationCalculator,
-           Direction direction, hal::Milliseconds duration) noexcept;
+    using Timeline = StepTimeline<kDefaultConfig.lightsNum>;
+    using TimelineCache = StepTimelineCache<kDefaultConfig.lightsNum>;
+
+    // Moves over timeline.getDuration().
+    Moving(BasicLights &lights, const Timeline &timeline,
+           Direction direction) noexcept;
 
     Moving(const Moving &) = delete;
     Moving(Moving &&) noexcept = default;
@@ -28,20 +34,10 @@ class Moving : public IMoving {
     bool isNearEnd() const noexcept final;
     bool isNearBegin() const noexcept final;
     bool isTooOld() const noexcept final;
+    hal::Milliseconds nextDeadline() const noexcept final;
 
   private:
-    void turnCurrentOn() noexcept;
-
-    static constexpr hal::Milliseconds kCloseFinishDiff = MOVING_FINISH_DELTA;
-
-    BasicLights &mLights;
-    IMovingDurationCalculator &mDurationCalculator;
-    std::size_t mCurrentIndex;
-    bool mCompleted;
-    Direction mDirection;
-    hal::Milliseconds mExpectedDuration;
-    hal::Milliseconds mTimeLeftUntilUpdate;
-    hal::Milliseconds mTimePassed;
+    StaticMoving<kDefaultConfig, IBasicLight> mMoving;
 };
 
-} // namespace staircase
\ No newline at end of file
+} // namespace staircase
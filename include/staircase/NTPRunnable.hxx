@@ -4,20 +4,40 @@
 #include <hal/IRTC.hxx>
 #include <hal/Timing.hxx>
 
+#include <staircase/ClockDiscipline.hxx>
 #include <staircase/IRunnable.hxx>
 
 namespace staircase {
 
-class NTPRunnable : public IRunnable {
+// Keeps the RTC on the time server. Requests go out at the poll interval of
+// the discipline and never block the task; the corrections are handed to
+// the RTC a millisecond at a time as the discipline slews them out, and the
+// task is only due again when the next one, the next poll or the reply
+// timeout is.
+class NTPRunnable : public IRunnable, private hal::INTP::IListener {
   public:
-    static constexpr hal::Milliseconds kUpdateInterval = 60 * 1000;
+    // Delta assumed when run without a task.
+    static constexpr hal::Milliseconds kUpdateInterval = 1000;
+
     NTPRunnable(hal::IRTC &rtc, hal::INTP &ntp);
 
+    hal::Milliseconds nextDeadline() const noexcept final;
+
+    const ClockDiscipline &getDiscipline() const noexcept {
+        return mDiscipline;
+    }
+
   private:
     void run() noexcept final;
+    void onSample(const hal::INTP::Sample &sample) noexcept final;
+    void onFailure() noexcept final;
+    void poll() noexcept;
 
     hal::IRTC &mRtc;
     hal::INTP &mNtp;
+    ClockDiscipline mDiscipline;
+    // Time until the next request, kForever while one is in flight.
+    hal::Milliseconds mUntilPoll;
 };
 
 } // namespace staircase
\ No newline at end of file
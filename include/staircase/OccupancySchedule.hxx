@@ -0,0 +1,76 @@
+#pragma once
+
+#include <hal/Timing.hxx>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace staircase {
+
+// Learns at which times of day the staircase is used. The day is split into
+// kSlotsNum slots, each with a one byte score of how many recent days saw
+// traffic in it, kOccupied being every day. A slot watched from its start to
+// its end moves a quarter of the way to occupied or to empty; a slot only
+// partly watched, e.g. the one the device booted in, counts only when it did
+// see traffic. Slots start as occupied, so nothing is slept through before
+// it has been seen empty for about ten days.
+//
+// Slots which are slept through cannot be watched, so each time one is its
+// score creeps back up by kForgetStep, and the device stays awake through it
+// again every few days to notice when habits change.
+class OccupancySchedule {
+  public:
+    static constexpr std::size_t kSlotsNum = 48;
+    static constexpr hal::Milliseconds kDay = 24 * 60 * 60 * 1000;
+    static constexpr hal::Milliseconds kSlotLength = kDay / kSlotsNum;
+    static constexpr std::uint8_t kOccupied = 255;
+    // Scores below this are predictably empty.
+    static constexpr std::uint8_t kQuietScore = 16;
+    static constexpr std::uint8_t kForgetStep = 1;
+    // Scores are persisted packed into 32-bit words.
+    static constexpr std::size_t kSlotsPerWord = 4;
+    static constexpr std::size_t kWordsNum = kSlotsNum / kSlotsPerWord;
+
+    OccupancySchedule() noexcept;
+
+    OccupancySchedule(const OccupancySchedule &) = delete;
+    OccupancySchedule(OccupancySchedule &&) noexcept = delete;
+    OccupancySchedule &operator=(const OccupancySchedule &) = delete;
+    OccupancySchedule &operator=(OccupancySchedule &&) noexcept = delete;
+
+    ~OccupancySchedule() = default;
+
+    // Feeds the current time of day and the sensor triggers since the last
+    // call.
+    void update(hal::Milliseconds timeOfDay, std::uint32_t triggers) noexcept;
+    // Time from timeOfDay until the first slot which is not predictably
+    // empty, at most a day. Zero when the current slot has seen traffic.
+    std::int64_t quietFor(hal::Milliseconds timeOfDay) const noexcept;
+    // Takes note that the device sleeps from timeOfDay for duration.
+    void sleepThrough(hal::Milliseconds timeOfDay,
+                      std::int64_t duration) noexcept;
+
+    std::uint8_t getScore(std::size_t slot) const noexcept {
+        return mScores[slot];
+    }
+
+    std::int32_t getWord(std::size_t word) const noexcept;
+    void setWord(std::size_t word, std::int32_t value) noexcept;
+
+  private:
+    static constexpr std::uint8_t kLearningRate = 4;
+
+    static std::size_t slotOf(hal::Milliseconds timeOfDay) noexcept;
+    void record(std::size_t slot, bool occupied) noexcept;
+
+    std::array<std::uint8_t, kSlotsNum> mScores;
+    bool mStarted;
+    // The slot being watched, whether it was from its start, and whether
+    // it saw traffic so far.
+    std::size_t mSlot;
+    bool mWhole;
+    bool mOccupied;
+};
+
+} // namespace staircase
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <hal/IPersistence.hxx>
+#include <hal/Timing.hxx>
+
+#include <staircase/IRunnable.hxx>
+#include <staircase/IStaircaseLooper.hxx>
+#include <staircase/WriteBehindStore.hxx>
+
+#include <cstdint>
+
+namespace staircase {
+
+// Keeps the learned moving times and the walk counters across reboots. run()
+// copies them from the looper snapshot into a write-behind store, so the
+// control task never waits for flash; restore() feeds them back to the
+// looper at startup. While nothing is pending it lets the persistence do its
+// housekeeping.
+class PersistenceRunnable final : public IRunnable {
+  public:
+    static constexpr hal::Milliseconds kUpdateInterval = 1000;
+
+    enum Slot : std::size_t {
+        DOWN_MOVING_TIME,
+        UP_MOVING_TIME,
+        DOWN_WALKS,
+        UP_WALKS,
+        SLOTS_NUM
+    };
+
+    using Store = WriteBehindStore<SLOTS_NUM>;
+
+    PersistenceRunnable(
+        IStaircaseLooper &looper, hal::IPersistence &persistence,
+        hal::Milliseconds quietPeriod = Store::kDefaultQuietPeriod,
+        std::uint32_t dirtyThreshold = Store::kDefaultDirtyThreshold) noexcept;
+
+    // Reads the stored state in one batch and resets the looper filters to
+    // it. Call once before the looper task starts.
+    void restore() noexcept;
+    // Takes the state from the looper and writes whatever is pending now,
+    // e.g. before hibernating.
+    void flush() noexcept;
+
+  private:
+    void run() noexcept final;
+    void storeSnapshot() noexcept;
+
+    IStaircaseLooper &mStaircaseLooper;
+    hal::IPersistence &mPersistence;
+    Store mStore;
+    std::uint32_t mDownWalksBase;
+    std::uint32_t mUpWalksBase;
+};
+
+} // namespace staircase
\ No newline at end of file
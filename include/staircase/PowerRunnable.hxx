@@ -1,23 +1,69 @@
 #pragma once
 
+#include <hal/IPersistence.hxx>
 #include <hal/IPowerManager.hxx>
 #include <hal/IRTC.hxx>
 #include <hal/Timing.hxx>
 
 #include <staircase/IRunnable.hxx>
+#include <staircase/IStaircaseLooper.hxx>
+#include <staircase/LooperSnapshot.hxx>
+#include <staircase/OccupancySchedule.hxx>
+#include <staircase/PersistenceRunnable.hxx>
+#include <staircase/WriteBehindStore.hxx>
+
+#include <cstdint>
 
 namespace staircase {
 
-class PowerRunnable : public IRunnable {
+// Hibernates the device while the staircase is predictably empty. The
+// sensor triggers of the looper feed an occupancy schedule, which is kept
+// across reboots in a write-behind store; once the lights are off and the
+// schedule expects nobody for at least kMinHibernation, the schedule and
+// the learned state still pending are written out and the device sleeps
+// until the next slot which may see traffic, kMaxHibernation at most.
+class PowerRunnable final : public IRunnable {
   public:
     static constexpr hal::Milliseconds kUpdateInterval = 1000;
-    PowerRunnable(hal::IRTC &rtc, hal::IPowerManager &powerManager);
+    // Shorter quiet spells are not worth the boot afterwards.
+    static constexpr hal::Milliseconds kMinHibernation = 15 * 60 * 1000;
+    // Wakes up at least twice a day, e.g. for the time server.
+    static constexpr hal::Milliseconds kMaxHibernation = 12 * 60 * 60 * 1000;
+
+    using Store = WriteBehindStore<OccupancySchedule::kWordsNum>;
+
+    PowerRunnable(hal::IRTC &rtc, hal::IPowerManager &powerManager,
+                  IStaircaseLooper &looper,
+                  hal::IPersistence &persistence) noexcept;
+
+    // Reads the stored schedule in one batch. Call once before the task
+    // starts.
+    void restore() noexcept;
+
+    const OccupancySchedule &getSchedule() const noexcept {
+        return mSchedule;
+    }
+
+    // Flushes the learned moving times and walk counters of persistence
+    // right before hibernating, so a walk which ended within its quiet
+    // period is not lost. nullptr stops it.
+    void setPersistence(PersistenceRunnable *persistence) noexcept {
+        mPersistence = persistence;
+    }
 
   private:
     void run() noexcept final;
+    void storeSchedule() noexcept;
+    static bool isQuiet(const LooperSnapshot &snapshot) noexcept;
 
     hal::IRTC &mRtc;
     hal::IPowerManager &mPowerManager;
+    IStaircaseLooper &mStaircaseLooper;
+    Store mStore;
+    PersistenceRunnable *mPersistence;
+    OccupancySchedule mSchedule;
+    // Looper triggers fed to the schedule so far.
+    std::uint32_t mTriggers;
 };
 
 } // namespace staircase
\ No newline at end of file
@@ -1,15 +1,42 @@
 #pragma once
 
+#include <hal/Adapters.hxx>
+#include <hal/BinaryEdge.hxx>
+#include <hal/BinaryValue.hxx>
 #include <hal/IBinaryValueReader.hxx>
 #include <hal/Timing.hxx>
 
 #include <staircase/IProximitySensor.hxx>
+#include <staircase/StaticProximitySensor.hxx>
+#include <staircase/TraceRing.hxx>
+
+#include <util/SpscRing.hxx>
+
+#include <cstdint>
+#include <optional>
 
 namespace staircase {
 
+// Debounced proximity sensor. It either polls a reader on every update,
+// through StaticProximitySensor, and so always has a deadline, or, when built
+// on an EdgeQueue, consumes timestamped edges pushed by the pin interrupt.
+// The edge path debounces against the exact edge times, so short pulses
+// between two updates are neither missed nor mistimed and an idle sensor
+// costs nothing. Edges the interrupt could not queue are counted by the
+// queue; once the ones which did fit are consumed, the edge path reads the
+// level once to get back in step and debounces it from there.
 class ProximitySensor final : public IProximitySensor {
   public:
+    static constexpr std::size_t kEdgeQueueSize = 16;
+
+    using EdgeQueue = util::SpscRing<hal::BinaryEdge, kEdgeQueueSize>;
+
     ProximitySensor(hal::IBinaryValueReader &binaryValueReader) noexcept;
+    // level is read for the initial state and after a queue overflow. now
+    // is the timestamp clock at construction; later updates have to advance
+    // by the same clock the interrupt stamps edges with.
+    ProximitySensor(EdgeQueue &edges, hal::IBinaryValueReader &level,
+                    hal::Timestamp now) noexcept;
 
     ProximitySensor(const ProximitySensor &) = delete;
     ProximitySensor(ProximitySensor &&) noexcept = delete;
@@ -23,17 +50,43 @@ class ProximitySensor final : public IProximitySensor {
     bool isFar() const noexcept final;
 
     void update(hal::Milliseconds delta) noexcept final;
+    hal::Milliseconds nextDeadline() const noexcept final;
+
+    // Records raw edges into trace under subject, nullptr stops it. Only the
+    // edge path sees raw edges; the looper traces the debounced changes.
+    void setTrace(TraceRing *trace, std::uint16_t subject) noexcept;
+
+    // Times the edge path had to read the level after edges were lost.
+    std::uint32_t getResyncs() const noexcept { return mResyncs; }
 
   private:
     enum class SensorState { CLOSE, FAR };
     static constexpr hal::Milliseconds kDebouncePeriod = DEBOUNCE_PERIOD;
 
-    SensorState readState() noexcept;
+    using Poller = StaticProximitySensor<hal::BinaryReaderAdapter>;
+
+    static SensorState toState(hal::BinaryValue value) noexcept;
+
+    void consumeEdges(hal::Milliseconds delta) noexcept;
+    bool settle(hal::Timestamp now) noexcept;
+    void resync() noexcept;
+    void traceEdge(const hal::BinaryEdge &edge) noexcept;
 
-    hal::IBinaryValueReader &mBinaryValueReader;
+    std::optional<Poller> mPoller;
+    EdgeQueue *mEdges;
+    hal::IBinaryValueReader *mLevel;
+    // Queue overflows seen so far, and whether the level is still to be
+    // read for the latest ones.
+    std::uint32_t mOverflows;
+    bool mResyncPending;
+    std::uint32_t mResyncs;
     SensorState mState;
     bool mStateChanged;
-    hal::Milliseconds mTimePassed;
+    SensorState mRawState;
+    hal::Timestamp mRawSince;
+    hal::Timestamp mNow;
+    TraceRing *mTrace;
+    std::uint16_t mTraceSubject;
 };
 
-} // namespace staircase
\ No newline at end of file
+} // namespace staircase
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <hal/Timing.hxx>
+
+#include <staircase/IMovingTimeFilter.hxx>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <utility>
+
+namespace staircase {
+
+// Median of the last WindowSize moving times, so a pedestrian who stopped
+// half way or ran up the stairs does not shift the estimate at all. The window
+// is kept twice: in arrival order, to know which value leaves, and sorted,
+// as the order statistics from which the median is read. A new value takes
+// the slot of the leaving one in the sorted copy and is moved into place,
+// which is a handful of swaps for the small windows used here.
+template <std::size_t WindowSize = 5>
+class SlidingMedianMovingTimeFilter final : public IMovingTimeFilter {
+  public:
+    static_assert(WindowSize > 0, "window must hold at least one value");
+
+    SlidingMedianMovingTimeFilter(
+        hal::Milliseconds initialFilterValue) noexcept {
+        reset(initialFilterValue);
+    }
+
+    hal::Milliseconds getCurrentMovingTime() const noexcept override {
+        if constexpr (WindowSize % 2 == 1) {
+            return mSorted[WindowSize / 2];
+        } else {
+            return static_cast<hal::Milliseconds>(
+                (static_cast<std::int64_t>(mSorted[WindowSize / 2 - 1]) +
+                 mSorted[WindowSize / 2]) /
+                2);
+        }
+    }
+
+    void processNewMovingTime(hal::Milliseconds timeElapsed) noexcept override {
+        auto oldest = std::exchange(mFilterValues[mCurrentIndex], timeElapsed);
+
+        mCurrentIndex++;
+        if (mCurrentIndex == WindowSize) {
+            mCurrentIndex = 0;
+        }
+
+        auto position = static_cast<std::size_t>(
+            std::distance(std::begin(mSorted),
+                          std::lower_bound(std::begin(mSorted),
+                                           std::end(mSorted), oldest)));
+        mSorted[position] = timeElapsed;
+
+        while (position > 0 && mSorted[position - 1] > mSorted[position]) {
+            std::swap(mSorted[position - 1], mSorted[position]);
+            --position;
+        }
+
+        while (position + 1 < WindowSize &&
+               mSorted[position + 1] < mSorted[position]) {
+            std::swap(mSorted[position + 1], mSorted[position]);
+            ++position;
+        }
+    }
+
+    void reset(hal::Milliseconds timeElapsed) noexcept override {
+        std::fill(std::begin(mFilterValues), std::end(mFilterValues),
+                  timeElapsed);
+        std::fill(std::begin(mSorted), std::end(mSorted), timeElapsed);
+        mCurrentIndex = 0;
+    }
+
+  private:
+    std::array<hal::Milliseconds, WindowSize> mFilterValues;
+    std::array<hal::Milliseconds, WindowSize> mSorted;
+    std::size_t mCurrentIndex;
+};
+
+} // namespace staircase
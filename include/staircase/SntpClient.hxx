@@ -0,0 +1,61 @@
+#pragma once
+
+#include <hal/IDatagramSocket.hxx>
+#include <hal/INTP.hxx>
+#include <hal/IRTC.hxx>
+#include <hal/Timing.hxx>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace staircase {
+
+// SNTP client (RFC 4330) over a connected datagram socket. The exchange is
+// stamped with the RTC it is meant to correct, so a sample is directly the
+// correction that RTC needs. Replies which do not answer the request in
+// flight, from an unsynchronised server or carrying a kiss-o'-death are
+// dropped and the request eventually times out.
+class SntpClient final : public hal::INTP {
+  public:
+    static constexpr std::size_t kPacketSize = 48;
+    static constexpr hal::Milliseconds kTimeout = 2000;
+
+    // zoneOffset is added to the UTC time of day of the server, for an RTC
+    // kept in local time.
+    SntpClient(hal::IDatagramSocket &socket, hal::IRTC &rtc,
+               hal::Milliseconds zoneOffset = 0) noexcept;
+
+    SntpClient(const SntpClient &) = delete;
+    SntpClient(SntpClient &&) noexcept = delete;
+    SntpClient &operator=(const SntpClient &) = delete;
+    SntpClient &operator=(SntpClient &&) noexcept = delete;
+
+    ~SntpClient() = default;
+
+    bool request(IListener &listener) noexcept final;
+    void update(hal::Milliseconds delta) noexcept final;
+    hal::Milliseconds nextDeadline() const noexcept final;
+
+  private:
+    using Packet = std::array<std::byte, kPacketSize>;
+
+    bool accept(const Packet &packet, Sample &sample) const noexcept;
+    hal::Milliseconds timeOfDay(const Packet &packet,
+                                std::size_t offset) const noexcept;
+    void complete(const Sample *sample) noexcept;
+
+    hal::IDatagramSocket &mSocket;
+    hal::IRTC &mRtc;
+    hal::Milliseconds mZoneOffset;
+    // Set while a request is in flight.
+    IListener *mListener;
+    hal::Milliseconds mWaited;
+    // Local time of day the request left at.
+    hal::Milliseconds mSentAt;
+    // Transmit timestamp of the request, which the reply has to echo.
+    std::array<std::byte, 8> mNonce;
+    std::uint32_t mRequests;
+};
+
+} // namespace staircase
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <hal/Timing.hxx>
+
+#include <cstdint>
+
+namespace staircase {
+
+// Compile-time description of one staircase. It is passed as a template
+// argument to the Static* components, so differently sized staircases can
+// live in one binary.
+struct StaircaseConfig {
+    std::size_t lightsNum;
+    hal::Milliseconds defaultOnPeriod;
+    hal::Milliseconds debouncePeriod;
+    std::size_t maxMovings;
+    hal::Milliseconds movingFinishDelta;
+    hal::Milliseconds initialMovingDuration;
+};
+
+// The configuration injected by CMake or the ESP32 Kconfig, which the
+// virtual interface classes are built with.
+inline constexpr StaircaseConfig kDefaultConfig{
+    LIGHTS_NUM,  DEFAULT_ON_PERIOD,   DEBOUNCE_PERIOD,
+    MAX_MOVINGS, MOVING_FINISH_DELTA, INITIAL_MOVING_DURATION};
+
+} // namespace staircase
@@ -3,30 +3,67 @@
 #include <hal/Timing.hxx>
 
 #include <staircase/IBasicLight.hxx>
+#include <staircase/ILightBank.hxx>
+#include <staircase/ILightPort.hxx>
 #include <staircase/IMoving.hxx>
 #include <staircase/IMovingDurationCalculator.hxx>
 #include <staircase/IMovingFactory.hxx>
 #include <staircase/IMovingTimeFilter.hxx>
 #include <staircase/IProximitySensor.hxx>
 #include <staircase/IStaircaseLooper.hxx>
-
-#include <util/StaticDequeue.hxx>
+#include <staircase/LooperCommand.hxx>
+#include <staircase/LooperSnapshot.hxx>
+#include <staircase/StaircaseConfig.hxx>
+#include <staircase/StaticStaircaseLooper.hxx>
+#include <staircase/TickProfile.hxx>
+#include <staircase/TraceRing.hxx>
 
 #include <cstdint>
-#include <memory>
 #include <mutex>
-#include <string>
 
 namespace staircase {
 
+// The looper logic over the I* interfaces, with movings from an
+// IMovingFactory. Instantiated once, in StaircaseLooper.cxx.
+using InterfaceStaircaseLooper =
+    StaticStaircaseLooper<kDefaultConfig, IBasicLight, IProximitySensor,
+                          IMovingDurationCalculator, IMovingTimeFilter,
+                          IMovingTimeFilter, FactoryMovings>;
+
+extern template class StaticStaircaseLooper<
+    kDefaultConfig, IBasicLight, IProximitySensor, IMovingDurationCalculator,
+    IMovingTimeFilter, IMovingTimeFilter, FactoryMovings>;
+
+// InterfaceStaircaseLooper behind IStaircaseLooper, for the tasks which only
+// know the interface.
 class StaircaseLooper final : public IStaircaseLooper {
   public:
+    static constexpr std::size_t kCommandQueueSize =
+        InterfaceStaircaseLooper::kCommandQueueSize;
+
+    using CommandQueue = InterfaceStaircaseLooper::CommandQueue;
+    using PhasePeriods = InterfaceStaircaseLooper::PhasePeriods;
+
     StaircaseLooper(BasicLights &lights, IProximitySensor &downSensor,
                     IProximitySensor &upSensor, IMovingFactory &movingFactory,
                     IMovingDurationCalculator &durationCalculator,
                     IMovingTimeFilter &downMovingFilter,
                     IMovingTimeFilter &upMovingFilter) noexcept;
 
+    StaircaseLooper(BasicLights &lights, ILightPort &lightPort,
+                    IProximitySensor &downSensor, IProximitySensor &upSensor,
+                    IMovingFactory &movingFactory,
+                    IMovingDurationCalculator &durationCalculator,
+                    IMovingTimeFilter &downMovingFilter,
+                    IMovingTimeFilter &upMovingFilter) noexcept;
+
+    StaircaseLooper(BasicLights &lights, ILightBank &lightBank,
+                    IProximitySensor &downSensor, IProximitySensor &upSensor,
+                    IMovingFactory &movingFactory,
+                    IMovingDurationCalculator &durationCalculator,
+                    IMovingTimeFilter &downMovingFilter,
+                    IMovingTimeFilter &upMovingFilter) noexcept;
+
     StaircaseLooper(const StaircaseLooper &) = delete;
     StaircaseLooper(StaircaseLooper &&) noexcept = delete;
     StaircaseLooper &operator=(const StaircaseLooper &) = delete;
@@ -35,36 +72,19 @@ class StaircaseLooper final : public IStaircaseLooper {
     ~StaircaseLooper() = default;
 
     void update(hal::Milliseconds delta) noexcept final;
+    hal::Milliseconds nextDeadline() const noexcept final;
+    bool isIdle() const noexcept final;
+    bool post(const LooperCommand &command) noexcept final;
+    LooperSnapshot snapshot() const noexcept final;
     std::lock_guard<std::mutex> block() noexcept final;
 
-  private:
-    void updateLights(hal::Milliseconds delta) noexcept;
-    void updateSensors(hal::Milliseconds delta) noexcept;
-    void updateMovigns(hal::Milliseconds delta) noexcept;
-
-    void removeAllStaleMovings(Movings &movings) noexcept;
+    // See InterfaceStaircaseLooper.
+    void setTrace(TraceRing *trace) noexcept;
+    void setProfile(TickProfile *profile) noexcept;
+    void setPeriods(const PhasePeriods &periods) noexcept;
 
-    void handleDownSensorStateChanged() noexcept;
-    void handleUpSensorStateChanged() noexcept;
-
-    bool isFirstMovingFinishing(Movings &movings) const noexcept;
-    bool hasNewMovingJustStarted(Movings &movings) const noexcept;
-    bool isMoreNewMovingsAvailable(Movings &movings) const noexcept;
-
-    void finishFirstMoving(Movings &movings,
-                           IMovingTimeFilter &filter) noexcept;
-
-    BasicLights &mLights;
-    IProximitySensor &mDownSensor;
-    IProximitySensor &mUpSensor;
-    IMovingFactory &mMovingFactory;
-    IMovingDurationCalculator &mDurationCalculator;
-    IMovingTimeFilter &mDownMovingFilter;
-    IMovingTimeFilter &mUpMovingFilter;
-    Movings mDownMovings;
-    Movings mUpMovings;
-
-    std::mutex mLock;
+  private:
+    InterfaceStaircaseLooper mLooper;
 };
 
-} // namespace staircase
\ No newline at end of file
+} // namespace staircase
@@ -14,6 +14,9 @@ class StaircaseRunnable : public IRunnable {
 
     StaircaseRunnable(IStaircaseLooper &looper);
 
+    hal::Milliseconds nextDeadline() const noexcept final;
+    bool isIdle() const noexcept final;
+
   private:
     void run() noexcept final;
 
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <hal/BinaryValue.hxx>
+#include <hal/Concepts.hxx>
+#include <hal/Timing.hxx>
+
+#include <staircase/IBasicLight.hxx>
+
+#include <algorithm>
+
+namespace staircase {
+
+// A light over a concrete pin type held by value, so that switching it is a
+// plain store. BasicLight wraps the instantiation over the writer interface.
+template <hal::BinaryWriter W> class StaticBasicLight {
+  public:
+    static constexpr hal::Milliseconds kDefaultOnPeriod =
+        IBasicLight::kDefaultOnPeriod;
+
+    StaticBasicLight(W writer) noexcept
+        : mWriter{writer}, mOn{false}, mTimeLeft{hal::kForever} {
+        writeState();
+    }
+
+    StaticBasicLight(const StaticBasicLight &) = delete;
+    StaticBasicLight(StaticBasicLight &&) noexcept = delete;
+    StaticBasicLight &operator=(const StaticBasicLight &) = delete;
+    StaticBasicLight &operator=(StaticBasicLight &&) noexcept = delete;
+
+    ~StaticBasicLight() = default;
+
+    void turnOn(hal::Milliseconds millis = kDefaultOnPeriod) noexcept {
+        setState(true, millis);
+    }
+
+    void turnOff() noexcept { setState(false, hal::kForever); }
+
+    void update(hal::Milliseconds delta) noexcept {
+        if (mTimeLeft < 0) {
+            return;
+        }
+
+        if (delta >= mTimeLeft) {
+            setState(false, hal::kForever);
+        } else {
+            mTimeLeft -= delta;
+        }
+    }
+
+    bool isOn() const noexcept { return mOn; }
+    bool isOff() const noexcept { return !mOn; }
+    hal::Milliseconds nextDeadline() const noexcept { return mTimeLeft; }
+
+  private:
+    void setState(bool on, hal::Milliseconds millis) noexcept {
+        // On forever outlasts any timed turnOn(), as in LightBank; only
+        // turnOff() ends it.
+        bool forever = mOn && on && mTimeLeft == hal::kForever;
+        if (mOn != on) {
+            mOn = on;
+            writeState();
+        }
+
+        if (millis == hal::kForever || forever) {
+            mTimeLeft = hal::kForever;
+        } else {
+            mTimeLeft = std::max(mTimeLeft, millis);
+        }
+    }
+
+    void writeState() noexcept {
+        mWriter.writeValue(mOn ? hal::BinaryValue::HIGH
+                               : hal::BinaryValue::LOW);
+    }
+
+    W mWriter;
+    bool mOn;
+    hal::Milliseconds mTimeLeft;
+};
+
+} // namespace staircase
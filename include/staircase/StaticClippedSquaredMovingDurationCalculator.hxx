@@ -0,0 +1,36 @@
+#pragma once
+
+#include <hal/Timing.hxx>
+
+#include <cstdint>
+
+namespace staircase {
+
+// ClippedSquaredMovingDurationCalculator for a staircase of LightsNum lights,
+// without the virtual call.
+template <std::size_t LightsNum>
+class StaticClippedSquaredMovingDurationCalculator {
+  public:
+    constexpr hal::Milliseconds
+    calculateDelta(std::size_t lightIndex,
+                   hal::Milliseconds totalDuration) const noexcept {
+        switch (lightIndex) {
+        case 0:
+            return kFirstLightDelta;
+        case 1:
+            return kSecondLightDelta;
+        case 2:
+            return kThirdLightDelta;
+        default:
+            return totalDuration /
+                   static_cast<hal::Milliseconds>(LightsNum + 1);
+        }
+    }
+
+  private:
+    static constexpr hal::Milliseconds kFirstLightDelta = 500;
+    static constexpr hal::Milliseconds kSecondLightDelta = 750;
+    static constexpr hal::Milliseconds kThirdLightDelta = 1200;
+};
+
+} // namespace staircase
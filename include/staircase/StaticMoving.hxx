@@ -0,0 +1,103 @@
+#pragma once
+
+#include <hal/Timing.hxx>
+
+#include <staircase/Concepts.hxx>
+#include <staircase/IMoving.hxx>
+#include <staircase/StaircaseConfig.hxx>
+#include <staircase/StepTimeline.hxx>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+
+namespace staircase {
+
+// A moving over a concrete light type, held by value. Moving wraps the
+// instantiation over the interface. The steps come from a copy of the
+// StepTimeline of its duration, so an update costs a binary search however
+// long the delta was. A stalled tick turns on every light it crosses.
+template <StaircaseConfig Config, Light L> class StaticMoving {
+  public:
+    using Direction = IMoving::Direction;
+    using Lights = std::array<std::reference_wrapper<L>, Config.lightsNum>;
+    using Timeline = StepTimeline<Config.lightsNum>;
+
+    StaticMoving() noexcept
+        : mLights{nullptr}, mTimeline{}, mCurrentIndex{0},
+          mNextOffset{hal::kForever}, mCompleted{true},
+          mDirection{Direction::UP}, mTimePassed{0} {}
+
+    // Moves over timeline.getDuration().
+    StaticMoving(Lights &lights, const Timeline &timeline,
+                 Direction direction) noexcept
+        : mLights{&lights}, mTimeline{timeline}, mCurrentIndex{0},
+          mNextOffset{timeline.offset(1)}, mCompleted{false},
+          mDirection{direction}, mTimePassed{0} {
+        turnOn(0);
+    }
+
+    void update(hal::Milliseconds delta) noexcept {
+        mTimePassed += delta;
+        if (mCompleted || mTimePassed < mNextOffset) {
+            return;
+        }
+
+        std::size_t step = mTimeline.stepAt(mTimePassed);
+
+        std::size_t last = std::min(step, Config.lightsNum - 1);
+        for (std::size_t index = mCurrentIndex + 1; index <= last; ++index) {
+            turnOn(index);
+        }
+
+        mCurrentIndex = step;
+        mCompleted = (step == Config.lightsNum);
+        if (!mCompleted) {
+            mNextOffset = mTimeline.offset(step + 1);
+        }
+    }
+
+    hal::Milliseconds getTimePassed() const noexcept { return mTimePassed; }
+
+    bool isCompleted() const noexcept { return mCompleted; }
+
+    bool isNearEnd() const noexcept {
+        return std::abs(mTimeline.getDuration() - mTimePassed) <
+               Config.movingFinishDelta;
+    }
+
+    bool isNearBegin() const noexcept {
+        return mTimePassed < Config.movingFinishDelta;
+    }
+
+    bool isTooOld() const noexcept {
+        return mTimePassed >
+               (mTimeline.getDuration() + Config.movingFinishDelta);
+    }
+
+    hal::Milliseconds nextDeadline() const noexcept {
+        return mCompleted ? hal::kForever : mNextOffset - mTimePassed;
+    }
+
+  private:
+    void turnOn(std::size_t index) noexcept {
+        std::size_t lightIndex = (mDirection == Direction::DOWN)
+                                     ? Config.lightsNum - 1 - index
+                                     : index;
+
+        (*mLights)[lightIndex].get().turnOn(Config.defaultOnPeriod);
+    }
+
+    Lights *mLights;
+    Timeline mTimeline;
+    std::size_t mCurrentIndex;
+    // Offset of the next step, so that most updates take one comparison.
+    hal::Milliseconds mNextOffset;
+    bool mCompleted;
+    Direction mDirection;
+    hal::Milliseconds mTimePassed;
+};
+
+} // namespace staircase
@@ -1,77 +1,72 @@
 #pragma once
 
+#include <hal/Timing.hxx>
+
+#include <staircase/IBasicLight.hxx>
 #include <staircase/IMoving.hxx>
+#include <staircase/IMovingDurationCalculator.hxx>
 #include <staircase/IMovingFactory.hxx>
 #include <staircase/Moving.hxx>
 
-#include <algorithm>
-#include <array>
+#include <util/StaticPool.hxx>
+
 #include <cstdint>
 
 namespace staircase {
 
+// Heap-free replacement for BasicMovingFactory. Movings live in a fixed pool
+// and the returned MovingPtr carries a generation-checked handle, so stale or
+// repeated releases are ignored instead of corrupting the pool.
 template <std::size_t N>
 class StaticMovingFactory final : public IMovingFactory {
   public:
-    StaticMovingFactory() {
-        std::fill(std::begin(mOccupied), std::end(mOccupied), false);
-    }
+    StaticMovingFactory() noexcept = default;
     StaticMovingFactory(const StaticMovingFactory &) noexcept = delete;
-    StaticMovingFactory(StaticMovingFactory &&) noexcept = default;
+    StaticMovingFactory(StaticMovingFactory &&) noexcept = delete;
     StaticMovingFactory &
     operator=(const StaticMovingFactory &) noexcept = delete;
-    StaticMovingFactory &operator=(StaticMovingFactory &&) noexcept = default;
+    StaticMovingFactory &operator=(StaticMovingFactory &&) noexcept = delete;
 
     ~StaticMovingFactory() = default;
 
-    IMoving *create(BasicLights& lights, IMoving::Direction direction,
-                    hal::Milliseconds duration) noexcept final {
-        std::size_t index = 0;
-        while (mOccupied[index] && (index < N)) {
-            ++index;
+    MovingPtr create(BasicLights &lights,
+                     IMovingDurationCalculator &durationCalculator,
+                     IMoving::Direction direction,
+                     hal::Milliseconds duration) noexcept final {
+        auto handle = mPool.acquire(
+            lights, mTimelines.get(durationCalculator, duration), direction);
+        if (!handle.valid()) {
+            return MovingPtr{};
         }
 
-        if (index == N) {
-            return nullptr;
-        }
-
-        mOccupied[index] = true;
-        char *addr = &mData[index * kElementSize];
-        Moving *moving = new (addr) Moving(lights, direction, duration);
-
-        return moving;
+        return MovingPtr{mPool.get(handle),
+                         MovingDeleter{&StaticMovingFactory::deleteMoving,
+                                       this, handle.value()}};
     }
-    void destroy(IMoving *moving) noexcept final {
-        std::size_t index = 0;
-        while ((&mData[index * kElementSize] !=
-                reinterpret_cast<char *>(moving)) &&
-               (index < N)) {
-            ++index;
-        }
 
-        if (index == N) {
-            return;
+    bool destroy(IMoving *moving, std::uint32_t handle) noexcept {
+        auto poolHandle = typename Pool::Handle{handle};
+        if (mPool.get(poolHandle) != moving) {
+            return false;
         }
 
-        mOccupied[index] = false;
-        Moving *ourMoving = reinterpret_cast<Moving *>(moving);
-        ourMoving->~Moving();
+        return mPool.release(poolHandle);
     }
 
+    std::size_t size() const noexcept { return mPool.size(); }
+
+    static constexpr std::size_t capacity() noexcept { return N; }
+
   private:
-    constexpr static std::size_t elementSize() {
-        if constexpr ((sizeof(Moving) % alignof(Moving)) == 0) {
-            return sizeof(Moving);
-        } else {
-            return sizeof(Moving) +
-                   (alignof(Moving) - (sizeof(Moving) % alignof(Moving)));
-        }
-    }
+    using Pool = util::StaticPool<Moving, N>;
 
-    constexpr static std::size_t kElementSize = elementSize();
+    static void deleteMoving(IMoving *moving, void *context,
+                             std::uint32_t handle) {
+        static_cast<StaticMovingFactory *>(context)->destroy(moving, handle);
+    }
 
-    std::array<char, kElementSize * N> mData;
-    std::array<bool, N> mOccupied;
+    Pool mPool;
+    Moving::TimelineCache mTimelines;
 };
 
-} // namespace staircase
\ No newline at end of file
+} // namespace staircase
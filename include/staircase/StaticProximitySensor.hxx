@@ -0,0 +1,83 @@
+#pragma once
+
+#include <hal/BinaryValue.hxx>
+#include <hal/Concepts.hxx>
+#include <hal/Timing.hxx>
+
+#include <algorithm>
+
+namespace staircase {
+
+// How often a polled sensor reads its pin while the level is stable, the
+// rate the control task used to tick at. Nothing else notices an edge on a
+// polled pin, so the sensor is never without a deadline.
+constexpr hal::Milliseconds kSensorSamplePeriod = 10;
+
+// The polling proximity sensor over a concrete pin type held by value, so
+// the sample on every update is a plain load. ProximitySensor wraps the
+// instantiation over the reader interface.
+template <hal::BinaryReader R,
+          hal::Milliseconds DebouncePeriod = DEBOUNCE_PERIOD,
+          hal::Milliseconds SamplePeriod = kSensorSamplePeriod>
+class StaticProximitySensor {
+  public:
+    StaticProximitySensor(R reader) noexcept
+        : mReader{reader}, mClose{readClose()}, mStateChanged{false},
+          mTimePassed{hal::kForever} {}
+
+    StaticProximitySensor(const StaticProximitySensor &) = delete;
+    StaticProximitySensor(StaticProximitySensor &&) noexcept = delete;
+    StaticProximitySensor &operator=(const StaticProximitySensor &) = delete;
+    StaticProximitySensor &
+    operator=(StaticProximitySensor &&) noexcept = delete;
+
+    ~StaticProximitySensor() = default;
+
+    bool hasStateChanged() const noexcept { return mStateChanged; }
+    bool isClose() const noexcept { return mClose; }
+    bool isFar() const noexcept { return !mClose; }
+
+    void update(hal::Milliseconds delta) noexcept {
+        mStateChanged = false;
+
+        bool close = readClose();
+        if (close == mClose) {
+            return;
+        }
+
+        if (mTimePassed == hal::kForever) {
+            // An update longer than the debounce period means the caller
+            // slept through an idle period and was woken by this very edge,
+            // so assume it is fresh rather than half a tick old.
+            mTimePassed = (delta > DebouncePeriod) ? 0 : delta / 2;
+        } else {
+            mTimePassed += delta;
+        }
+
+        if (mTimePassed >= DebouncePeriod) {
+            mClose = close;
+            mStateChanged = true;
+            mTimePassed = hal::kForever;
+        }
+    }
+
+    hal::Milliseconds nextDeadline() const noexcept {
+        if (mTimePassed == hal::kForever) {
+            return SamplePeriod;
+        }
+
+        return std::max(DebouncePeriod - mTimePassed, 0);
+    }
+
+  private:
+    bool readClose() noexcept {
+        return mReader.readValue() == hal::BinaryValue::HIGH;
+    }
+
+    R mReader;
+    bool mClose;
+    bool mStateChanged;
+    hal::Milliseconds mTimePassed;
+};
+
+} // namespace staircase
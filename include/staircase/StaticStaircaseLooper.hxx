@@ -0,0 +1,700 @@
+#pragma once
+
+#include <hal/Timing.hxx>
+
+#include <staircase/Concepts.hxx>
+#include <staircase/IBasicLight.hxx>
+#include <staircase/ILightBank.hxx>
+#include <staircase/ILightPort.hxx>
+#include <staircase/IMoving.hxx>
+#include <staircase/IMovingDurationCalculator.hxx>
+#include <staircase/IMovingFactory.hxx>
+#include <staircase/LooperCommand.hxx>
+#include <staircase/LooperSnapshot.hxx>
+#include <staircase/StaircaseConfig.hxx>
+#include <staircase/StaticMoving.hxx>
+#include <staircase/StepTimeline.hxx>
+#include <staircase/TickProfile.hxx>
+#include <staircase/TraceRing.hxx>
+
+#include <util/MpscRing.hxx>
+#include <util/SeqLock.hxx>
+#include <util/StaticDequeue.hxx>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <utility>
+
+namespace staircase {
+
+// Movings held by value, each stepping over a copy of the timeline of its
+// duration, cached across movings of the same duration.
+template <StaircaseConfig Config, Light L> class ValueMovings {
+  public:
+    using Moving = StaticMoving<Config, L>;
+    using Lights = typename Moving::Lights;
+
+    template <class Movings, DurationCalculator C>
+    bool create(Movings &movings, Lights &lights, C &durationCalculator,
+                IMoving::Direction direction,
+                hal::Milliseconds duration) noexcept {
+        movings.pushBack(Moving{
+            lights, mTimelines.get(durationCalculator, duration), direction});
+        return true;
+    }
+
+  private:
+    StepTimelineCache<Config.lightsNum> mTimelines;
+};
+
+// Movings made by an IMovingFactory, which may run out of them.
+class FactoryMovings {
+  public:
+    using Moving = MovingPtr;
+
+    FactoryMovings(IMovingFactory &movingFactory) noexcept
+        : mMovingFactory{movingFactory} {}
+
+    template <class Movings>
+    bool create(Movings &movings, BasicLights &lights,
+                IMovingDurationCalculator &durationCalculator,
+                IMoving::Direction direction,
+                hal::Milliseconds duration) noexcept {
+        auto moving = mMovingFactory.create(lights, durationCalculator,
+                                            direction, duration);
+        if (!moving) {
+            return false;
+        }
+
+        movings.pushBack(std::move(moving));
+        return true;
+    }
+
+  private:
+    IMovingFactory &mMovingFactory;
+};
+
+// The staircase looper. The configuration is a template argument instead of
+// global macros and every component is a concrete type constrained by a
+// concept, so the whole tick can be inlined and, with ValueMovings, movings
+// are held by value. Instantiated over the I* interfaces with FactoryMovings
+// it is StaircaseLooper. The up direction may use a different filter type
+// than the down one.
+template <StaircaseConfig Config, Light L, Sensor S, DurationCalculator C,
+          MovingTimeFilter F, MovingTimeFilter G = F,
+          class M = ValueMovings<Config, L>>
+class StaticStaircaseLooper {
+  public:
+    static constexpr std::size_t kCommandQueueSize = 8;
+
+    using Lights = std::array<std::reference_wrapper<L>, Config.lightsNum>;
+    using Moving = typename M::Moving;
+    using Movings = util::StaticDequeue<Moving, Config.maxMovings>;
+    using CommandQueue = util::MpscRing<LooperCommand, kCommandQueueSize>;
+    using Snapshot = BasicLooperSnapshot<Config.lightsNum, Config.maxMovings>;
+
+    // Least time between two runs of each phase of update(). A phase which
+    // is not due keeps accumulating the deltas and gets them in one go. Zero
+    // runs the phase in every update.
+    struct PhasePeriods {
+        hal::Milliseconds sensors = 0;
+        hal::Milliseconds movings = 0;
+        hal::Milliseconds lights = 0;
+    };
+
+    StaticStaircaseLooper(Lights &lights, S &downSensor, S &upSensor,
+                          M movings, C &durationCalculator,
+                          F &downMovingFilter, G &upMovingFilter) noexcept
+        : mLights{lights}, mLightPort{nullptr}, mLightBank{nullptr},
+          mDownSensor{downSensor}, mUpSensor{upSensor},
+          mMovingSource{std::move(movings)},
+          mDurationCalculator{durationCalculator},
+          mDownMovingFilter{downMovingFilter}, mUpMovingFilter{upMovingFilter},
+          mUpdates{0}, mDownWalks{0}, mUpWalks{0}, mTriggers{0},
+          mDeferredDelta{0}, mTrace{nullptr}, mTracedLights{}, mLightWords{},
+          mLightsStale{true}, mProfile{nullptr}, mPeriods{},
+          mLightsPending{0}, mSensorsPending{0}, mMovingsPending{0} {
+        refreshFilterTimes();
+        publishSnapshot();
+    }
+
+    StaticStaircaseLooper(Lights &lights, S &downSensor, S &upSensor,
+                          C &durationCalculator, F &downMovingFilter,
+                          G &upMovingFilter) noexcept
+        requires std::default_initializable<M>
+        : StaticStaircaseLooper{lights,
+                                downSensor,
+                                upSensor,
+                                M{},
+                                durationCalculator,
+                                downMovingFilter,
+                                upMovingFilter} {}
+
+    StaticStaircaseLooper(Lights &lights, ILightPort &lightPort,
+                          S &downSensor, S &upSensor, M movings,
+                          C &durationCalculator, F &downMovingFilter,
+                          G &upMovingFilter) noexcept
+        : StaticStaircaseLooper{lights,
+                                downSensor,
+                                upSensor,
+                                std::move(movings),
+                                durationCalculator,
+                                downMovingFilter,
+                                upMovingFilter} {
+        mLightPort = &lightPort;
+    }
+
+    StaticStaircaseLooper(Lights &lights, ILightBank &lightBank,
+                          S &downSensor, S &upSensor, M movings,
+                          C &durationCalculator, F &downMovingFilter,
+                          G &upMovingFilter) noexcept
+        : StaticStaircaseLooper{lights,
+                                downSensor,
+                                upSensor,
+                                std::move(movings),
+                                durationCalculator,
+                                downMovingFilter,
+                                upMovingFilter} {
+        mLightPort = &lightBank;
+        mLightBank = &lightBank;
+    }
+
+    StaticStaircaseLooper(const StaticStaircaseLooper &) = delete;
+    StaticStaircaseLooper(StaticStaircaseLooper &&) noexcept = delete;
+    StaticStaircaseLooper &operator=(const StaticStaircaseLooper &) = delete;
+    StaticStaircaseLooper &
+    operator=(StaticStaircaseLooper &&) noexcept = delete;
+
+    ~StaticStaircaseLooper() = default;
+
+    void update(hal::Milliseconds delta) noexcept {
+        // Only contended while a legacy block() guard is alive. The tick
+        // never waits for it, the elapsed time is carried over to the next
+        // update.
+        std::unique_lock<std::mutex> lock{mLock, std::try_to_lock};
+        if (!lock.owns_lock()) {
+            mDeferredDelta += delta;
+            return;
+        }
+
+        auto tickStart = profileStart();
+        delta += std::exchange(mDeferredDelta, 0);
+
+        if constexpr (kTraceEnabled) {
+            if (mTrace) {
+                mTrace->advance(delta);
+            }
+        }
+
+        applyCommands();
+
+        mLightsPending += delta;
+        mSensorsPending += delta;
+        mMovingsPending += delta;
+
+        auto start = profileStart();
+        if (isDue(mLightsPending, mPeriods.lights)) {
+            updateLights(std::exchange(mLightsPending, 0));
+            start = profileLap(TickPhase::LIGHTS, start);
+        }
+
+        bool sensorsUpdated = isDue(mSensorsPending, mPeriods.sensors);
+        if (sensorsUpdated) {
+            updateSensors(std::exchange(mSensorsPending, 0));
+            start = profileLap(TickPhase::SENSORS, start);
+        }
+
+        if (isDue(mMovingsPending, mPeriods.movings)) {
+            syncLights();
+            updateMovings(std::exchange(mMovingsPending, 0));
+            start = profileLap(TickPhase::MOVINGS, start);
+
+            removeAllStaleMovings(mDownMovings, IMoving::Direction::DOWN);
+            removeAllStaleMovings(mUpMovings, IMoving::Direction::UP);
+            profileLap(TickPhase::STALE_REMOVAL, start);
+        }
+
+        if (sensorsUpdated) {
+            handleSensors();
+        }
+
+        if (mLightPort) {
+            mLightPort->flush();
+        }
+
+        ++mUpdates;
+        publishSnapshot();
+        profileLap(TickPhase::TICK, tickStart);
+    }
+
+    hal::Milliseconds nextDeadline() const noexcept {
+        auto sensors = hal::earliestDeadline(mDownSensor.nextDeadline(),
+                                             mUpSensor.nextDeadline());
+        auto movings = hal::earliestDeadline(movingsDeadline(mDownMovings),
+                                             movingsDeadline(mUpMovings));
+
+        auto deadline =
+            phaseDeadline(lightsDeadline(), mPeriods.lights, mLightsPending);
+        deadline = hal::earliestDeadline(
+            deadline,
+            phaseDeadline(sensors, mPeriods.sensors, mSensorsPending));
+        deadline = hal::earliestDeadline(
+            deadline,
+            phaseDeadline(movings, mPeriods.movings, mMovingsPending));
+
+        return deadline;
+    }
+
+    bool isIdle() const noexcept {
+        // A deferred update has not looked at the elapsed time yet.
+        if (mDeferredDelta != 0 || !mDownMovings.empty() ||
+            !mUpMovings.empty()) {
+            return false;
+        }
+
+        // A sensor without a deadline waits for an edge which wakes the
+        // task. One which polls its pin always has its next sample due, so
+        // a looper on polled sensors is never idle.
+        if (mDownSensor.nextDeadline() != hal::kForever ||
+            mUpSensor.nextDeadline() != hal::kForever) {
+            return false;
+        }
+
+        return std::none_of(std::begin(mLights), std::end(mLights),
+                            [](auto light) { return light.get().isOn(); });
+    }
+
+    bool post(const LooperCommand &command) noexcept {
+        return mCommands.push(command);
+    }
+
+    Snapshot snapshot() const noexcept { return mSnapshot.load(); }
+
+    std::lock_guard<std::mutex> block() noexcept {
+        return std::lock_guard<std::mutex>{mLock};
+    }
+
+    // Records the looper decisions into trace, nullptr stops it. Only has an
+    // effect when built with STAIRCASE_TRACE. Call before the control task
+    // starts.
+    void setTrace(TraceRing *trace) noexcept { mTrace = trace; }
+
+    // Measures every update into profile, nullptr stops it. Call before the
+    // control task starts.
+    void setProfile(TickProfile *profile) noexcept { mProfile = profile; }
+
+    // Runs the phases at their own rates, e.g. sensors at every 5 ms update
+    // and lights and movings every 50 ms. Before anything is decided or any
+    // light is switched the phases behind are brought up to date, in the
+    // order of a single rate update, so decisions stay the same; lights only
+    // go off up to a lights period late.
+    void setPeriods(const PhasePeriods &periods) noexcept {
+        syncMovings();
+        mPeriods = periods;
+    }
+
+    const Movings &getMovings(IMoving::Direction direction) const noexcept {
+        return (direction == IMoving::Direction::UP) ? mUpMovings
+                                                     : mDownMovings;
+    }
+
+  private:
+    // The moving behind an element of Movings, which is either the moving
+    // itself or a pointer to it.
+    template <class T> static auto &deref(T &moving) noexcept {
+        if constexpr (requires { *moving; }) {
+            return *moving;
+        } else {
+            return moving;
+        }
+    }
+
+    std::uint32_t profileStart() const noexcept {
+        return mProfile ? mProfile->now() : 0;
+    }
+
+    std::uint32_t profileLap(TickPhase phase, std::uint32_t start) noexcept {
+        return mProfile ? mProfile->lap(phase, start) : 0;
+    }
+
+    void trace(TraceEvent event, std::uint16_t subject,
+               std::int32_t value) noexcept {
+        if constexpr (kTraceEnabled) {
+            if (mTrace) {
+                mTrace->record(event, subject, value);
+            }
+        }
+    }
+
+    static std::uint16_t traceSubject(IMoving::Direction direction) noexcept {
+        return (direction == IMoving::Direction::UP) ? kTraceUp : kTraceDown;
+    }
+
+    static bool isDue(hal::Milliseconds pending,
+                      hal::Milliseconds period) noexcept {
+        return pending >= period;
+    }
+
+    static hal::Milliseconds phaseDeadline(hal::Milliseconds deadline,
+                                           hal::Milliseconds period,
+                                           hal::Milliseconds pending) noexcept {
+        if (deadline == hal::kForever) {
+            return deadline;
+        }
+
+        // The phase does not run before its period is up.
+        auto due = period - pending;
+        return (deadline > due) ? deadline : due;
+    }
+
+    void applyCommands() noexcept {
+        LooperCommand command;
+        while (mCommands.pop(command)) {
+            syncMovings();
+            applyCommand(command);
+            mLightsStale = true;
+        }
+    }
+
+    void handleSensors() noexcept {
+        // Decisions are taken on up to date movings, as in a single rate
+        // update.
+        if (mDownSensor.hasStateChanged()) {
+            syncMovings();
+            mLightsStale = true;
+            bool close = mDownSensor.isClose();
+            trace(TraceEvent::DEBOUNCE_ACCEPT, kTraceDown, close);
+            if (close) {
+                ++mTriggers;
+                handleDownSensorStateChanged();
+            }
+        }
+
+        if (mUpSensor.hasStateChanged()) {
+            syncMovings();
+            mLightsStale = true;
+            bool close = mUpSensor.isClose();
+            trace(TraceEvent::DEBOUNCE_ACCEPT, kTraceUp, close);
+            if (close) {
+                ++mTriggers;
+                handleUpSensorStateChanged();
+            }
+        }
+    }
+
+    void syncLights() noexcept {
+        if (mLightsPending != 0) {
+            updateLights(std::exchange(mLightsPending, 0));
+        }
+    }
+
+    void syncMovings() noexcept {
+        syncLights();
+        if (mMovingsPending != 0) {
+            updateMovings(std::exchange(mMovingsPending, 0));
+            removeAllStaleMovings(mDownMovings, IMoving::Direction::DOWN);
+            removeAllStaleMovings(mUpMovings, IMoving::Direction::UP);
+        }
+    }
+
+    void applyCommand(const LooperCommand &command) noexcept {
+        bool up = command.direction == IMoving::Direction::UP;
+
+        trace(TraceEvent::COMMAND, static_cast<std::uint16_t>(command.type),
+              command.value);
+
+        switch (command.type) {
+        case LooperCommand::Type::FORCE_ON:
+            forceLightsOn(command.value);
+            break;
+        case LooperCommand::Type::FORCE_OFF:
+            forceLightsOff();
+            break;
+        case LooperCommand::Type::RESET_FILTER:
+            if (up) {
+                mUpMovingFilter.reset(command.value);
+                mUpMovingTime = mUpMovingFilter.getCurrentMovingTime();
+                trace(TraceEvent::FILTER_UPDATE, kTraceUp, mUpMovingTime);
+            } else {
+                mDownMovingFilter.reset(command.value);
+                mDownMovingTime = mDownMovingFilter.getCurrentMovingTime();
+                trace(TraceEvent::FILTER_UPDATE, kTraceDown,
+                      mDownMovingTime);
+            }
+            break;
+        case LooperCommand::Type::INJECT_TRIGGER:
+            // Only starts a moving; one going the other way is left to its
+            // own sensor, so no made up walk time reaches its filter.
+            ++mTriggers;
+            if (up) {
+                startMoving(mUpMovings, mUpMovingFilter,
+                            IMoving::Direction::UP);
+            } else {
+                startMoving(mDownMovings, mDownMovingFilter,
+                            IMoving::Direction::DOWN);
+            }
+            break;
+        }
+    }
+
+    void forceLightsOn(hal::Milliseconds millis) noexcept {
+        std::for_each(std::begin(mLights), std::end(mLights),
+                      [millis](auto light) { light.get().turnOn(millis); });
+    }
+
+    void forceLightsOff() noexcept {
+        removeAllMovings(mDownMovings);
+        removeAllMovings(mUpMovings);
+
+        std::for_each(std::begin(mLights), std::end(mLights),
+                      [](auto light) { light.get().turnOff(); });
+    }
+
+    void publishSnapshot() noexcept {
+        Snapshot snapshot{};
+
+        snapshot.updates = mUpdates;
+        if (mLightBank) {
+            mLightBank->copyState(snapshot.lights);
+        } else {
+            if (mLightsStale) {
+                mLightWords.fill(0);
+                for (std::size_t index = 0; index < mLights.size(); ++index) {
+                    mLightWords[index / Snapshot::kLightWordBits] |=
+                        static_cast<std::uint32_t>(
+                            mLights[index].get().isOn())
+                        << (index % Snapshot::kLightWordBits);
+                }
+                mLightsStale = false;
+            }
+            snapshot.lights = mLightWords;
+        }
+
+        if constexpr (kTraceEnabled) {
+            traceLights(snapshot.lights);
+        }
+
+        fillMovings(snapshot.downMovings, mDownMovings);
+        fillMovings(snapshot.upMovings, mUpMovings);
+        snapshot.downMovingTime = mDownMovingTime;
+        snapshot.upMovingTime = mUpMovingTime;
+        snapshot.downWalks = mDownWalks;
+        snapshot.upWalks = mUpWalks;
+        snapshot.triggers = mTriggers;
+
+        mSnapshot.store(snapshot);
+    }
+
+    void traceLights(const typename Snapshot::Lights &lights) noexcept {
+        for (std::size_t word = 0; word < lights.size(); ++word) {
+            auto changed = lights[word] ^ mTracedLights[word];
+            mTracedLights[word] = lights[word];
+
+            while (mTrace && changed != 0) {
+                auto bit = std::countr_zero(changed);
+                changed &= changed - 1;
+
+                bool on = (lights[word] >> bit) & 1;
+                trace(on ? TraceEvent::LIGHT_ON : TraceEvent::LIGHT_OFF,
+                      static_cast<std::uint16_t>(
+                          word * Snapshot::kLightWordBits + bit),
+                      0);
+            }
+        }
+    }
+
+    void refreshFilterTimes() noexcept {
+        mDownMovingTime = mDownMovingFilter.getCurrentMovingTime();
+        mUpMovingTime = mUpMovingFilter.getCurrentMovingTime();
+    }
+
+    static void fillMovings(typename Snapshot::Movings &snapshot,
+                            const Movings &movings) noexcept {
+        snapshot.count = movings.size();
+        for (std::size_t index = 0; index < movings.size(); ++index) {
+            snapshot.timePassed[index] = deref(movings[index]).getTimePassed();
+        }
+    }
+
+    void updateLights(hal::Milliseconds delta) noexcept {
+        if (mLightBank) {
+            mLightBank->update(delta);
+            return;
+        }
+
+        mLightsStale = true;
+        std::for_each(std::begin(mLights), std::end(mLights),
+                      [delta](auto light) { light.get().update(delta); });
+    }
+
+    void updateSensors(hal::Milliseconds delta) noexcept {
+        mDownSensor.update(delta);
+        mUpSensor.update(delta);
+    }
+
+    void updateMovings(hal::Milliseconds delta) noexcept {
+        mLightsStale = true;
+        for (std::size_t index = 0; index < mDownMovings.size(); ++index) {
+            deref(mDownMovings[index]).update(delta);
+        }
+
+        for (std::size_t index = 0; index < mUpMovings.size(); ++index) {
+            deref(mUpMovings[index]).update(delta);
+        }
+    }
+
+    void removeAllStaleMovings(Movings &movings,
+                               IMoving::Direction direction) noexcept {
+        while (!movings.empty() && deref(movings.front()).isTooOld()) {
+            if constexpr (kTraceEnabled) {
+                if (mTrace) {
+                    mTrace->record(TraceEvent::MOVING_EXPIRE,
+                                   traceSubject(direction),
+                                   deref(movings.front()).getTimePassed());
+                }
+            }
+            movings.popFront();
+        }
+    }
+
+    static void removeAllMovings(Movings &movings) noexcept {
+        while (!movings.empty()) {
+            movings.popFront();
+        }
+    }
+
+    hal::Milliseconds lightsDeadline() const noexcept {
+        if (mLightBank) {
+            return mLightBank->nextDeadline();
+        }
+
+        hal::Milliseconds deadline = hal::kForever;
+        for (const auto &light : mLights) {
+            deadline =
+                hal::earliestDeadline(deadline, light.get().nextDeadline());
+        }
+
+        return deadline;
+    }
+
+    static hal::Milliseconds
+    movingsDeadline(const Movings &movings) noexcept {
+        hal::Milliseconds deadline = hal::kForever;
+        for (std::size_t index = 0; index < movings.size(); ++index) {
+            deadline = hal::earliestDeadline(
+                deadline, deref(movings[index]).nextDeadline());
+        }
+
+        return deadline;
+    }
+
+    void handleDownSensorStateChanged() noexcept {
+        if (isFirstMovingFinishing(mDownMovings)) {
+            finishFirstMoving(mDownMovings, mDownMovingFilter,
+                              mDownMovingTime, mDownWalks,
+                              IMoving::Direction::DOWN);
+        } else {
+            startMoving(mUpMovings, mUpMovingFilter, IMoving::Direction::UP);
+        }
+    }
+
+    void handleUpSensorStateChanged() noexcept {
+        if (isFirstMovingFinishing(mUpMovings)) {
+            finishFirstMoving(mUpMovings, mUpMovingFilter, mUpMovingTime,
+                              mUpWalks, IMoving::Direction::UP);
+        } else {
+            startMoving(mDownMovings, mDownMovingFilter,
+                        IMoving::Direction::DOWN);
+        }
+    }
+
+    // Creates a moving unless one has just started or there is no room.
+    template <class Filter>
+    void startMoving(Movings &movings, Filter &filter,
+                     IMoving::Direction direction) noexcept {
+        if (!hasNewMovingJustStarted(movings) && !movings.full()) {
+            createMoving(movings, filter, direction);
+        }
+    }
+
+    static bool isFirstMovingFinishing(Movings &movings) noexcept {
+        return !movings.empty() && deref(movings.front()).isNearEnd();
+    }
+
+    static bool hasNewMovingJustStarted(Movings &movings) noexcept {
+        return !movings.empty() && deref(movings.back()).isNearBegin();
+    }
+
+    template <class Filter>
+    void finishFirstMoving(Movings &movings, Filter &filter,
+                           hal::Milliseconds &movingTime,
+                           std::uint32_t &walks,
+                           IMoving::Direction direction) noexcept {
+        if (movings.empty()) {
+            return;
+        }
+
+        auto currentDuration = deref(movings.front()).getTimePassed();
+        movings.popFront();
+
+        filter.processNewMovingTime(currentDuration);
+        movingTime = filter.getCurrentMovingTime();
+        ++walks;
+
+        trace(TraceEvent::MOVING_FINISH, traceSubject(direction),
+              currentDuration);
+        trace(TraceEvent::FILTER_UPDATE, traceSubject(direction), movingTime);
+    }
+
+    template <class Filter>
+    void createMoving(Movings &movings, Filter &filter,
+                      IMoving::Direction direction) noexcept {
+        auto duration = filter.getCurrentMovingTime();
+        if (mMovingSource.create(movings, mLights, mDurationCalculator,
+                                 direction, duration)) {
+            trace(TraceEvent::MOVING_CREATE, traceSubject(direction),
+                  duration);
+        }
+    }
+
+    Lights &mLights;
+    ILightPort *mLightPort;
+    ILightBank *mLightBank;
+    S &mDownSensor;
+    S &mUpSensor;
+    M mMovingSource;
+    C &mDurationCalculator;
+    F &mDownMovingFilter;
+    G &mUpMovingFilter;
+    Movings mDownMovings;
+    Movings mUpMovings;
+
+    CommandQueue mCommands;
+    util::SeqLock<Snapshot> mSnapshot;
+    std::uint32_t mUpdates;
+    hal::Milliseconds mDownMovingTime;
+    hal::Milliseconds mUpMovingTime;
+    std::uint32_t mDownWalks;
+    std::uint32_t mUpWalks;
+    std::uint32_t mTriggers;
+    std::mutex mLock;
+    hal::Milliseconds mDeferredDelta;
+    TraceRing *mTrace;
+    typename Snapshot::Lights mTracedLights;
+    // Light bitmap of the last snapshot, rebuilt only after a phase which
+    // may have switched lights. Unused with a light bank.
+    typename Snapshot::Lights mLightWords;
+    bool mLightsStale;
+    TickProfile *mProfile;
+    PhasePeriods mPeriods;
+    hal::Milliseconds mLightsPending;
+    hal::Milliseconds mSensorsPending;
+    hal::Milliseconds mMovingsPending;
+};
+
+} // namespace staircase
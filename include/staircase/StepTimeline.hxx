@@ -0,0 +1,93 @@
+#pragma once
+
+#include <hal/Timing.hxx>
+
+#include <staircase/Concepts.hxx>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+namespace staircase {
+
+// When each light of a moving of one duration is reached, as cumulative
+// offsets from its start: light i turns on at offset(i) and the moving
+// completes at offset(LightsNum). The offsets are running sums of the
+// calculator's own deltas, so the steps fall exactly where stepping delta by
+// delta would put them, whatever the calculator does with the duration.
+template <std::size_t LightsNum> class StepTimeline {
+  public:
+    static constexpr std::size_t kStepsNum = LightsNum;
+
+    StepTimeline() noexcept : mOffsets{}, mDuration{hal::kForever} {}
+
+    template <DurationCalculator C>
+    StepTimeline(const C &durationCalculator,
+                 hal::Milliseconds duration) noexcept
+        : mOffsets{}, mDuration{duration} {
+        for (std::size_t index = 0; index < LightsNum; ++index) {
+            mOffsets[index + 1] =
+                mOffsets[index] +
+                durationCalculator.calculateDelta(index, duration);
+        }
+    }
+
+    hal::Milliseconds getDuration() const noexcept { return mDuration; }
+
+    hal::Milliseconds offset(std::size_t step) const noexcept {
+        return mOffsets[step];
+    }
+
+    // Number of steps taken once timePassed has passed, LightsNum when the
+    // moving is complete.
+    std::size_t stepAt(hal::Milliseconds timePassed) const noexcept {
+        auto first = mOffsets.begin() + 1;
+        return static_cast<std::size_t>(
+            std::upper_bound(first, mOffsets.end(), timePassed) - first);
+    }
+
+  private:
+    std::array<hal::Milliseconds, LightsNum + 1> mOffsets;
+    hal::Milliseconds mDuration;
+};
+
+// The timelines of the last Size durations a factory created movings with.
+// The expected duration only changes after a walk, so most movings find
+// theirs here and skip the calculator. Entries are keyed on the calculator
+// too, as one factory may serve several staircases. Movings copy what get()
+// returns, which holds only until the next get().
+template <std::size_t LightsNum, std::size_t Size = 4>
+class StepTimelineCache {
+  public:
+    using Timeline = StepTimeline<LightsNum>;
+
+    StepTimelineCache() noexcept : mEntries{}, mNext{0} {}
+
+    template <DurationCalculator C>
+    const Timeline &get(const C &durationCalculator,
+                        hal::Milliseconds duration) noexcept {
+        for (auto &entry : mEntries) {
+            if (entry.calculator == &durationCalculator &&
+                entry.timeline.getDuration() == duration) {
+                return entry.timeline;
+            }
+        }
+
+        auto &entry = mEntries[mNext];
+        mNext = (mNext + 1) % Size;
+        entry.calculator = &durationCalculator;
+        entry.timeline = Timeline{durationCalculator, duration};
+        return entry.timeline;
+    }
+
+  private:
+    struct Entry {
+        const void *calculator = nullptr;
+        Timeline timeline;
+    };
+
+    std::array<Entry, Size> mEntries;
+    std::size_t mNext;
+};
+
+} // namespace staircase
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <hal/ICycleCounter.hxx>
+
+#include <util/LogLinearHistogram.hxx>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace staircase {
+
+// Parts of a looper update which are measured separately.
+enum class TickPhase : std::uint8_t {
+    LIGHTS,
+    SENSORS,
+    MOVINGS,
+    STALE_REMOVAL,
+    // The whole update, commands, sensor handling and publishing included.
+    TICK,
+};
+
+inline constexpr std::size_t kTickPhasesNum = 5;
+
+// Cycle count histograms of every TickPhase. The control task records into
+// it; other tasks may query it at any time without holding up the tick, see
+// util::LogLinearHistogram.
+class TickProfile {
+  public:
+    using Histogram = util::LogLinearHistogram<>;
+
+    explicit TickProfile(const hal::ICycleCounter &counter) noexcept
+        : mCounter{counter} {}
+
+    TickProfile(const TickProfile &) = delete;
+    TickProfile(TickProfile &&) noexcept = delete;
+    TickProfile &operator=(const TickProfile &) = delete;
+    TickProfile &operator=(TickProfile &&) noexcept = delete;
+
+    ~TickProfile() = default;
+
+    // Control task side.
+    std::uint32_t now() const noexcept { return mCounter.cycles(); }
+
+    // Records the cycles since start into phase and returns the current
+    // count, which the next phase can start from.
+    std::uint32_t lap(TickPhase phase, std::uint32_t start) noexcept {
+        auto end = mCounter.cycles();
+        mHistograms[static_cast<std::size_t>(phase)].record(end - start);
+        return end;
+    }
+
+    void reset() noexcept {
+        for (auto &histogram : mHistograms) {
+            histogram.reset();
+        }
+    }
+
+    // Any task.
+    const Histogram &histogram(TickPhase phase) const noexcept {
+        return mHistograms[static_cast<std::size_t>(phase)];
+    }
+
+    Histogram::Summary summary(TickPhase phase) const noexcept {
+        return histogram(phase).summary();
+    }
+
+    std::uint32_t toMicroseconds(std::uint32_t cycles) const noexcept {
+        auto frequency = mCounter.frequency();
+        return (frequency == 0)
+                   ? 0
+                   : static_cast<std::uint32_t>(std::uint64_t{cycles} *
+                                                1000000 / frequency);
+    }
+
+  private:
+    const hal::ICycleCounter &mCounter;
+    std::array<Histogram, kTickPhasesNum> mHistograms;
+};
+
+} // namespace staircase
\ No newline at end of file
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <hal/Timing.hxx>
+
+#include <util/SpscRing.hxx>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace staircase {
+
+// Trace points are compiled in with STAIRCASE_TRACE and cost nothing
+// otherwise: every call site is guarded by if constexpr on this flag.
+#ifdef STAIRCASE_TRACE
+inline constexpr bool kTraceEnabled = true;
+#else
+inline constexpr bool kTraceEnabled = false;
+#endif
+
+enum class TraceEvent : std::uint8_t {
+    // Raw sensor level change, subject is the sensor, value the new level.
+    SENSOR_EDGE,
+    // Debounced sensor state change, value is 1 for close and 0 for far.
+    DEBOUNCE_ACCEPT,
+    // Subject is the direction, value the expected moving duration.
+    MOVING_CREATE,
+    // Moving ended by the far sensor, value is its duration.
+    MOVING_FINISH,
+    // Moving dropped as stale, value is the time it had passed.
+    MOVING_EXPIRE,
+    // Subject is the light index.
+    LIGHT_ON,
+    LIGHT_OFF,
+    // Subject is the direction, value the new filtered moving time.
+    FILTER_UPDATE,
+    // Subject is the LooperCommand::Type, value its value.
+    COMMAND,
+    // Inserted by the drain, value is how many records were lost.
+    DROPPED,
+};
+
+// Sensor and direction subjects.
+inline constexpr std::uint16_t kTraceDown = 0;
+inline constexpr std::uint16_t kTraceUp = 1;
+
+struct TraceRecord {
+    // Milliseconds of looper time.
+    hal::Timestamp time;
+    TraceEvent event;
+    std::uint16_t subject;
+    std::int32_t value;
+};
+
+// Size of a record in a dump: the fields above, little endian, no padding.
+inline constexpr std::size_t kTraceRecordSize = 11;
+
+using EncodedTraceRecord = std::array<std::byte, kTraceRecordSize>;
+
+EncodedTraceRecord encodeTraceRecord(const TraceRecord &record) noexcept;
+TraceRecord decodeTraceRecord(std::span<const std::byte, kTraceRecordSize>
+                                  encoded) noexcept;
+
+// Fixed size lock-free trace buffer. Everything which records into it has to
+// run in the control task, which also keeps its clock: the looper advances
+// it by the delta of each update. A full ring drops new records and counts
+// them rather than blocking the tick; a low priority task drains it.
+class TraceRing {
+  public:
+    static constexpr std::size_t kSize = 256;
+
+    TraceRing() noexcept : mNow{0} {}
+
+    TraceRing(const TraceRing &) = delete;
+    TraceRing(TraceRing &&) noexcept = delete;
+    TraceRing &operator=(const TraceRing &) = delete;
+    TraceRing &operator=(TraceRing &&) noexcept = delete;
+
+    ~TraceRing() = default;
+
+    // Producer side.
+    void advance(hal::Milliseconds delta) noexcept { mNow += delta; }
+    hal::Timestamp now() const noexcept { return mNow; }
+
+    void record(TraceEvent event, std::uint16_t subject,
+                std::int32_t value) noexcept {
+        recordAt(mNow, event, subject, value);
+    }
+
+    void recordAt(hal::Timestamp time, TraceEvent event,
+                  std::uint16_t subject, std::int32_t value) noexcept {
+        mRecords.push({time, event, subject, value});
+    }
+
+    // Consumer side.
+    bool pop(TraceRecord &record) noexcept { return mRecords.pop(record); }
+
+    // Records lost so far because the ring was full.
+    std::uint32_t dropped() const noexcept { return mRecords.overflows(); }
+
+  private:
+    util::SpscRing<TraceRecord, kSize> mRecords;
+    hal::Timestamp mNow;
+};
+
+} // namespace staircase
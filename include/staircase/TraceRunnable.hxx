@@ -0,0 +1,36 @@
+#pragma once
+
+#include <hal/IStreamWriter.hxx>
+#include <hal/Timing.hxx>
+
+#include <staircase/IRunnable.hxx>
+#include <staircase/TraceRing.hxx>
+
+#include <cstdint>
+
+namespace staircase {
+
+// Low priority drain of a TraceRing. Writes the records as a binary dump of
+// encodeTraceRecord() records, with a DROPPED record wherever the ring
+// overflowed since the previous drain.
+class TraceRunnable final : public IRunnable {
+  public:
+    static constexpr hal::Milliseconds kUpdateInterval = 100;
+    // Records per write to the stream.
+    static constexpr std::size_t kChunkRecords = 32;
+
+    TraceRunnable(TraceRing &trace, hal::IStreamWriter &writer) noexcept;
+
+    // Empties the ring now. Returns the number of records written.
+    std::size_t drain() noexcept;
+
+  private:
+    void run() noexcept final;
+
+    TraceRing &mTrace;
+    hal::IStreamWriter &mWriter;
+    std::uint32_t mDropped;
+    hal::Timestamp mLastTime;
+};
+
+} // namespace staircase
\ No newline at end of file
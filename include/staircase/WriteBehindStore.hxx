@@ -0,0 +1,132 @@
+#pragma once
+
+#include <hal/IPersistence.hxx>
+#include <hal/Timing.hxx>
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace staircase {
+
+// RAM copy of N persisted values which writes back lazily. set() only marks a
+// slot dirty; the dirty slots are committed together in one setValues() once
+// nothing has changed for the quiet period, or straight away once the dirty
+// threshold is reached so a busy staircase does not postpone the write
+// forever. restore() reads every slot in one getValues().
+template <std::size_t N> class WriteBehindStore {
+  public:
+    // Not copied, so usually string literals.
+    using Keys = std::array<std::string_view, N>;
+
+    static constexpr hal::Milliseconds kDefaultQuietPeriod = 60000;
+    static constexpr std::uint32_t kDefaultDirtyThreshold = 16;
+
+    WriteBehindStore(hal::IPersistence &persistence, Keys keys,
+                     hal::Milliseconds quietPeriod = kDefaultQuietPeriod,
+                     std::uint32_t dirtyThreshold =
+                         kDefaultDirtyThreshold) noexcept
+        : mPersistence{persistence}, mQuietPeriod{quietPeriod},
+          mDirtyThreshold{dirtyThreshold}, mQuietTime{0}, mPendingWrites{0} {
+        for (std::size_t slot = 0; slot < N; ++slot) {
+            mEntries[slot] = {keys[slot], 0, false};
+        }
+    }
+
+    WriteBehindStore(const WriteBehindStore &) = delete;
+    WriteBehindStore(WriteBehindStore &&) noexcept = delete;
+    WriteBehindStore &operator=(const WriteBehindStore &) = delete;
+    WriteBehindStore &operator=(WriteBehindStore &&) noexcept = delete;
+
+    ~WriteBehindStore() = default;
+
+    // Loads every slot, dropping whatever was set before. Returns how many
+    // slots were found in the persistence.
+    std::size_t restore() noexcept {
+        mPersistence.getValues(mEntries);
+        mDirty.reset();
+        mPendingWrites = 0;
+
+        std::size_t found = 0;
+        for (const auto &entry : mEntries) {
+            found += entry.found ? 1 : 0;
+        }
+
+        return found;
+    }
+
+    bool has(std::size_t slot) const noexcept { return mEntries[slot].found; }
+
+    std::int32_t get(std::size_t slot) const noexcept {
+        return mEntries[slot].value;
+    }
+
+    void set(std::size_t slot, std::int32_t value) noexcept {
+        auto &entry = mEntries[slot];
+        if (entry.found && entry.value == value) {
+            return;
+        }
+
+        entry.value = value;
+        entry.found = true;
+        mDirty.set(slot);
+        ++mPendingWrites;
+        mQuietTime = 0;
+    }
+
+    void update(hal::Milliseconds delta) noexcept {
+        if (mDirty.none()) {
+            return;
+        }
+
+        mQuietTime += delta;
+        if (mQuietTime >= mQuietPeriod ||
+            mPendingWrites >= mDirtyThreshold) {
+            flush();
+        }
+    }
+
+    // Commits the dirty slots now, e.g. before the device hibernates.
+    void flush() noexcept {
+        if (mDirty.none()) {
+            return;
+        }
+
+        std::array<hal::IPersistence::Entry, N> batch;
+        std::size_t count = 0;
+        for (std::size_t slot = 0; slot < N; ++slot) {
+            if (mDirty.test(slot)) {
+                batch[count++] = mEntries[slot];
+            }
+        }
+
+        mPersistence.setValues(
+            std::span<const hal::IPersistence::Entry>{batch.data(), count});
+        mDirty.reset();
+        mPendingWrites = 0;
+    }
+
+    bool isDirty() const noexcept { return mDirty.any(); }
+
+    // Time until update() flushes on its own, kForever when clean.
+    hal::Milliseconds nextDeadline() const noexcept {
+        if (mDirty.none()) {
+            return hal::kForever;
+        }
+
+        return (mQuietTime < mQuietPeriod) ? mQuietPeriod - mQuietTime : 0;
+    }
+
+  private:
+    hal::IPersistence &mPersistence;
+    std::array<hal::IPersistence::Entry, N> mEntries;
+    std::bitset<N> mDirty;
+    hal::Milliseconds mQuietPeriod;
+    std::uint32_t mDirtyThreshold;
+    hal::Milliseconds mQuietTime;
+    std::uint32_t mPendingWrites;
+};
+
+} // namespace staircase
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace util {
+
+namespace detail {
+
+constexpr std::array<std::uint32_t, 256> makeCrc32Table() noexcept {
+    std::array<std::uint32_t, 256> table{};
+    for (std::uint32_t index = 0; index < table.size(); ++index) {
+        std::uint32_t crc = index;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+        }
+        table[index] = crc;
+    }
+
+    return table;
+}
+
+inline constexpr auto kCrc32Table = makeCrc32Table();
+
+} // namespace detail
+
+// CRC-32 as used by zlib and Ethernet. Pass the previous result as crc to
+// continue a checksum over several pieces.
+constexpr std::uint32_t crc32(std::span<const std::byte> data,
+                              std::uint32_t crc = 0) noexcept {
+    crc = ~crc;
+    for (auto byte : data) {
+        crc = detail::kCrc32Table[(crc ^ static_cast<std::uint32_t>(byte)) &
+                                  0xFF] ^
+              (crc >> 8);
+    }
+
+    return ~crc;
+}
+
+constexpr std::uint32_t crc32(std::string_view data,
+                              std::uint32_t crc = 0) noexcept {
+    crc = ~crc;
+    for (auto character : data) {
+        crc = detail::kCrc32Table[(crc ^ static_cast<std::uint8_t>(character)) &
+                                  0xFF] ^
+              (crc >> 8);
+    }
+
+    return ~crc;
+}
+
+} // namespace util
\ No newline at end of file
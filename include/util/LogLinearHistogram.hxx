@@ -0,0 +1,165 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace util {
+
+// Fixed memory histogram of 32-bit samples in the style of HdrHistogram.
+// Values below 2^SubBucketBits get a bucket each; above that every power of
+// two is split into 2^(SubBucketBits - 1) equal buckets, so a reported value
+// is within 2^(1 - SubBucketBits) of the recorded one whatever its magnitude.
+//
+// One thread records, any number of threads read. The counters are relaxed
+// atomic words which the writer only loads and stores, so recording is a few
+// plain memory accesses and a reader never delays it. A reader racing with
+// record() may miss that one sample, which a latency summary can afford.
+template <unsigned SubBucketBits = 4> class LogLinearHistogram {
+    static_assert(SubBucketBits >= 1 && SubBucketBits < 32,
+                  "sub-buckets have to split a 32-bit value");
+
+  public:
+    static constexpr std::uint32_t kSubBucketsNum = 1u << SubBucketBits;
+    static constexpr std::size_t kBucketsNum =
+        (32 - SubBucketBits + 2) * (kSubBucketsNum / 2);
+
+    using Counts = std::array<std::uint32_t, kBucketsNum>;
+
+    struct Summary {
+        std::uint32_t count;
+        std::uint32_t p50;
+        std::uint32_t p99;
+        std::uint32_t max;
+    };
+
+    LogLinearHistogram() noexcept : mCount{0}, mMax{0} {
+        for (auto &bucket : mBuckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    LogLinearHistogram(const LogLinearHistogram &) = delete;
+    LogLinearHistogram(LogLinearHistogram &&) noexcept = delete;
+    LogLinearHistogram &operator=(const LogLinearHistogram &) = delete;
+    LogLinearHistogram &operator=(LogLinearHistogram &&) noexcept = delete;
+
+    ~LogLinearHistogram() = default;
+
+    static constexpr std::size_t bucketOf(std::uint32_t value) noexcept {
+        if (value < kSubBucketsNum) {
+            return value;
+        }
+
+        auto shift = static_cast<unsigned>(std::bit_width(value)) -
+                     SubBucketBits;
+        return shift * (kSubBucketsNum / 2) + (value >> shift);
+    }
+
+    // Highest value which falls into bucket.
+    static constexpr std::uint32_t bucketLimit(std::size_t bucket) noexcept {
+        if (bucket < kSubBucketsNum) {
+            return static_cast<std::uint32_t>(bucket);
+        }
+
+        auto shift = bucket / (kSubBucketsNum / 2) - 1;
+        auto sub = bucket - shift * (kSubBucketsNum / 2);
+        return static_cast<std::uint32_t>(((std::uint64_t{sub} + 1) << shift) -
+                                          1);
+    }
+
+    // Writer side.
+    void record(std::uint32_t value) noexcept {
+        bump(mBuckets[bucketOf(value)]);
+        bump(mCount);
+        if (value > mMax.load(std::memory_order_relaxed)) {
+            mMax.store(value, std::memory_order_relaxed);
+        }
+    }
+
+    void reset() noexcept {
+        for (auto &bucket : mBuckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        mCount.store(0, std::memory_order_relaxed);
+        mMax.store(0, std::memory_order_relaxed);
+    }
+
+    // Reader side.
+    std::uint32_t count() const noexcept {
+        return mCount.load(std::memory_order_relaxed);
+    }
+
+    std::uint32_t max() const noexcept {
+        return mMax.load(std::memory_order_relaxed);
+    }
+
+    void copyCounts(Counts &counts) const noexcept {
+        for (std::size_t bucket = 0; bucket < kBucketsNum; ++bucket) {
+            counts[bucket] = mBuckets[bucket].load(std::memory_order_relaxed);
+        }
+    }
+
+    // Smallest value at or below which perMille thousandths of the samples
+    // fall, rounded up to its bucket limit but never past the maximum.
+    std::uint32_t valueAt(std::uint32_t perMille) const noexcept {
+        Counts counts;
+        copyCounts(counts);
+        return valueAt(counts, perMille, max());
+    }
+
+    Summary summary() const noexcept {
+        Counts counts;
+        copyCounts(counts);
+        auto maximum = max();
+
+        std::uint32_t count = 0;
+        for (auto bucketCount : counts) {
+            count += bucketCount;
+        }
+
+        return {count, valueAt(counts, 500, maximum),
+                valueAt(counts, 990, maximum), maximum};
+    }
+
+    static std::uint32_t valueAt(const Counts &counts, std::uint32_t perMille,
+                                 std::uint32_t max) noexcept {
+        std::uint64_t total = 0;
+        for (auto bucketCount : counts) {
+            total += bucketCount;
+        }
+
+        if (total == 0) {
+            return 0;
+        }
+
+        // Rank of the sample, rounded up and at least the first one.
+        auto rank = (total * perMille + 999) / 1000;
+        rank = (rank == 0) ? 1 : rank;
+
+        std::uint64_t seen = 0;
+        for (std::size_t bucket = 0; bucket < kBucketsNum; ++bucket) {
+            seen += counts[bucket];
+            if (seen >= rank) {
+                auto limit = bucketLimit(bucket);
+                return (limit < max) ? limit : max;
+            }
+        }
+
+        return max;
+    }
+
+  private:
+    static void bump(std::atomic<std::uint32_t> &counter) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + 1,
+                      std::memory_order_relaxed);
+    }
+
+    std::array<std::atomic<std::uint32_t>, kBucketsNum> mBuckets;
+    std::atomic<std::uint32_t> mCount;
+    std::atomic<std::uint32_t> mMax;
+};
+
+} // namespace util
\ No newline at end of file
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace util {
+
+// Bounded lock-free ring for any number of producers and exactly one
+// consumer. Every cell carries a sequence number which tells whether it is
+// free for the producer which claimed its position or filled for the
+// consumer, so producers only race on the tail index and never wait for
+// each other. push() fails when the ring is full; a value whose producer was
+// preempted mid-push is simply picked up by a later pop(). N has to be a
+// power of two.
+template <class T, std::size_t N> class MpscRing {
+    static_assert(N >= 2 && (N & (N - 1)) == 0,
+                  "MpscRing size must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "MpscRing elements are copied between threads");
+    static_assert(std::atomic<std::size_t>::is_always_lock_free,
+                  "MpscRing needs lock-free indices");
+
+  public:
+    MpscRing() noexcept : mTail{0}, mHead{0} {
+        for (std::size_t index = 0; index < N; ++index) {
+            mCells[index].sequence.store(index, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRing(const MpscRing &) = delete;
+    MpscRing(MpscRing &&) noexcept = delete;
+    MpscRing &operator=(const MpscRing &) = delete;
+    MpscRing &operator=(MpscRing &&) noexcept = delete;
+
+    ~MpscRing() = default;
+
+    // Producer side, callable from any thread.
+    bool push(const T &value) noexcept {
+        std::size_t position = mTail.load(std::memory_order_relaxed);
+        Cell *cell;
+
+        while (true) {
+            cell = &mCells[position & kMask];
+            std::size_t sequence =
+                cell->sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<std::intptr_t>(sequence) -
+                              static_cast<std::intptr_t>(position);
+
+            if (difference == 0) {
+                if (mTail.compare_exchange_weak(position, position + 1,
+                                                std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = mTail.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->value = value;
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side, only ever called from one thread.
+    bool pop(T &value) noexcept {
+        Cell &cell = mCells[mHead & kMask];
+        if (cell.sequence.load(std::memory_order_acquire) != mHead + 1) {
+            return false;
+        }
+
+        value = cell.value;
+        cell.sequence.store(mHead + N, std::memory_order_release);
+        ++mHead;
+        return true;
+    }
+
+    static constexpr std::size_t capacity() noexcept { return N; }
+
+  private:
+    static constexpr std::size_t kMask = N - 1;
+
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    std::array<Cell, N> mCells;
+    std::atomic<std::size_t> mTail;
+    std::size_t mHead;
+};
+
+} // namespace util
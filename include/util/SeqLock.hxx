@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace util {
+
+// Single-writer sequence lock. The writer never waits: it bumps the sequence
+// to odd, copies the value in and bumps it back to even. Readers copy the
+// value out and retry if the sequence was odd or moved meanwhile, so any
+// number of them can read without ever delaying the writer. The value is
+// stored as relaxed atomic words, which keeps a torn read well defined.
+template <class T> class SeqLock {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "SeqLock values are copied word by word");
+
+  public:
+    SeqLock() noexcept : SeqLock{T{}} {}
+
+    explicit SeqLock(const T &value) noexcept : mSequence{0} {
+        store(value);
+    }
+
+    SeqLock(const SeqLock &) = delete;
+    SeqLock(SeqLock &&) noexcept = delete;
+    SeqLock &operator=(const SeqLock &) = delete;
+    SeqLock &operator=(SeqLock &&) noexcept = delete;
+
+    ~SeqLock() = default;
+
+    // Writer side, only ever called from one thread.
+    void store(const T &value) noexcept {
+        Words words{};
+        std::memcpy(words.data(), &value, sizeof(T));
+
+        std::uint32_t sequence = mSequence.load(std::memory_order_relaxed);
+        mSequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (std::size_t index = 0; index < kWordsNum; ++index) {
+            mWords[index].store(words[index], std::memory_order_relaxed);
+        }
+
+        mSequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    // Reader side. A single attempt which fails if a store was in progress.
+    bool tryLoad(T &value) const noexcept {
+        std::uint32_t before = mSequence.load(std::memory_order_acquire);
+        if (before & 1) {
+            return false;
+        }
+
+        Words words;
+        for (std::size_t index = 0; index < kWordsNum; ++index) {
+            words[index] = mWords[index].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (mSequence.load(std::memory_order_relaxed) != before) {
+            return false;
+        }
+
+        std::memcpy(&value, words.data(), sizeof(T));
+        return true;
+    }
+
+    T load() const noexcept {
+        T value;
+        while (!tryLoad(value)) {
+        }
+
+        return value;
+    }
+
+  private:
+    using Word = std::uint32_t;
+
+    static constexpr std::size_t kWordsNum =
+        (sizeof(T) + sizeof(Word) - 1) / sizeof(Word);
+
+    using Words = std::array<Word, kWordsNum>;
+
+    std::atomic<std::uint32_t> mSequence;
+    std::array<std::atomic<Word>, kWordsNum> mWords;
+};
+
+} // namespace util
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace util {
+
+// Lock-free ring for exactly one producer and one consumer, e.g. an interrupt
+// handler feeding a task. Neither side ever blocks or allocates: push() fails
+// when the ring is full and pop() fails when it is empty. Failed pushes are
+// counted, so the consumer can tell that it missed something. The indices run
+// freely and are masked on access, so N has to be a power of two.
+template <class T, std::size_t N> class SpscRing {
+    static_assert(N >= 2 && (N & (N - 1)) == 0,
+                  "SpscRing size must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "SpscRing elements are copied from interrupt context");
+    static_assert(std::atomic<std::size_t>::is_always_lock_free,
+                  "SpscRing needs lock-free indices");
+
+  public:
+    SpscRing() noexcept : mHead{0}, mTail{0}, mOverflows{0} {}
+
+    SpscRing(const SpscRing &) = delete;
+    SpscRing(SpscRing &&) noexcept = delete;
+    SpscRing &operator=(const SpscRing &) = delete;
+    SpscRing &operator=(SpscRing &&) noexcept = delete;
+
+    ~SpscRing() = default;
+
+    // Producer side.
+    bool push(const T &value) noexcept {
+        std::size_t tail = mTail.load(std::memory_order_relaxed);
+        if (tail - mHead.load(std::memory_order_acquire) == N) {
+            mOverflows.store(mOverflows.load(std::memory_order_relaxed) + 1,
+                             std::memory_order_release);
+            return false;
+        }
+
+        mBuffer[tail & kMask] = value;
+        mTail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side.
+    bool peek(T &value) const noexcept {
+        std::size_t head = mHead.load(std::memory_order_relaxed);
+        if (head == mTail.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        value = mBuffer[head & kMask];
+        return true;
+    }
+
+    bool pop(T &value) noexcept {
+        if (!peek(value)) {
+            return false;
+        }
+
+        mHead.store(mHead.load(std::memory_order_relaxed) + 1,
+                    std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const noexcept {
+        return mHead.load(std::memory_order_acquire) ==
+               mTail.load(std::memory_order_acquire);
+    }
+
+    std::size_t size() const noexcept {
+        std::size_t head = mHead.load(std::memory_order_acquire);
+        return mTail.load(std::memory_order_acquire) - head;
+    }
+
+    // Pushes which failed because the ring was full, wrapping around.
+    std::uint32_t overflows() const noexcept {
+        return mOverflows.load(std::memory_order_acquire);
+    }
+
+    static constexpr std::size_t capacity() noexcept { return N; }
+
+  private:
+    static constexpr std::size_t kMask = N - 1;
+
+    std::array<T, N> mBuffer;
+    std::atomic<std::size_t> mHead;
+    std::atomic<std::size_t> mTail;
+    std::atomic<std::uint32_t> mOverflows;
+};
+
+} // namespace util
@@ -2,6 +2,7 @@
 
 #include <array>
 #include <cstdint>
+#include <utility>
 
 namespace util {
 
@@ -25,7 +26,7 @@ template <class T, std::size_t N> class StaticDequeue {
 
             ++mPosition;
             ++mCounter;
-            if (mPosition == mDequeue.size()) {
+            if (mPosition == N) {
                 mPosition = 0;
             }
 
@@ -39,7 +40,7 @@ template <class T, std::size_t N> class StaticDequeue {
 
             ++mPosition;
             ++mCounter;
-            if (mPosition == mDequeue.size()) {
+            if (mPosition == N) {
                 mPosition = 0;
             }
 
@@ -109,7 +110,7 @@ template <class T, std::size_t N> class StaticDequeue {
             next -= N;
         }
 
-        mArray[next] = value;
+        mArray[next] = std::move(value);
         ++mSize;
 
         return mArray[next];
@@ -151,8 +152,7 @@ template <class T, std::size_t N> class StaticDequeue {
             return;
         }
 
-        T &element = mArray[mFirst];
-        element.~T();
+        mArray[mFirst] = T{};
 
         ++mFirst;
 
@@ -165,7 +165,25 @@ template <class T, std::size_t N> class StaticDequeue {
 
     T &front() noexcept { return mArray[mFirst]; }
 
+    T &operator[](std::size_t index) noexcept {
+        return mArray[position(index)];
+    }
+
+    const T &operator[](std::size_t index) const noexcept {
+        return mArray[position(index)];
+    }
+
   private:
+    std::size_t position(std::size_t index) const noexcept {
+        std::size_t position = mFirst + index;
+
+        if (position >= N) {
+            position -= N;
+        }
+
+        return position;
+    }
+
     std::array<T, N> mArray;
     std::size_t mSize{0};
     std::size_t mFirst{0};
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <utility>
+
+namespace util {
+
+// Fixed-capacity object pool. Free slots are chained through their own
+// storage, so acquire and release are O(1). Every slot carries a generation
+// counter which is bumped on both acquire and release (odd means occupied),
+// which lets release() reject stale and double frees.
+template <class T, std::size_t N> class StaticPool {
+  public:
+    static_assert(N > 0, "pool must hold at least one element");
+    static_assert(N < std::numeric_limits<std::uint16_t>::max(),
+                  "pool index must fit into a handle");
+
+    using value_type = T;
+    using pointer = T *;
+    using reference = T &;
+
+    class Handle {
+      public:
+        constexpr Handle() noexcept = default;
+        constexpr explicit Handle(std::uint32_t value) noexcept
+            : mValue{value} {}
+
+        constexpr std::uint32_t value() const noexcept { return mValue; }
+        constexpr bool valid() const noexcept { return mValue != kInvalid; }
+
+        bool operator==(const Handle &other) const noexcept = default;
+
+      private:
+        static constexpr std::uint32_t kInvalid =
+            std::numeric_limits<std::uint32_t>::max();
+
+        constexpr Handle(std::uint16_t index, std::uint16_t generation) noexcept
+            : mValue{(static_cast<std::uint32_t>(generation) << 16) | index} {}
+
+        constexpr std::uint16_t index() const noexcept {
+            return static_cast<std::uint16_t>(mValue & 0xFFFF);
+        }
+
+        constexpr std::uint16_t generation() const noexcept {
+            return static_cast<std::uint16_t>(mValue >> 16);
+        }
+
+        std::uint32_t mValue{kInvalid};
+
+        friend class StaticPool;
+    };
+
+    StaticPool() noexcept {
+        for (std::size_t index = 0; index < N; ++index) {
+            mSlots[index].mGeneration = 0;
+            mSlots[index].setNextFree(static_cast<std::uint16_t>(index + 1));
+        }
+    }
+
+    StaticPool(const StaticPool &) = delete;
+    StaticPool(StaticPool &&) = delete;
+    StaticPool &operator=(const StaticPool &) = delete;
+    StaticPool &operator=(StaticPool &&) = delete;
+
+    ~StaticPool() {
+        for (auto &slot : mSlots) {
+            if (slot.occupied()) {
+                slot.object()->~T();
+            }
+        }
+    }
+
+    template <class... Args> Handle acquire(Args &&...args) noexcept {
+        if (full()) {
+            return Handle{};
+        }
+
+        std::uint16_t index = mFirstFree;
+        Slot &slot = mSlots[index];
+        mFirstFree = slot.nextFree();
+
+        new (slot.mStorage) T(std::forward<Args>(args)...);
+        ++slot.mGeneration;
+        ++mSize;
+
+        return Handle{index, slot.mGeneration};
+    }
+
+    bool release(Handle handle) noexcept {
+        Slot *slot = find(handle);
+        if (slot == nullptr) {
+            return false;
+        }
+
+        slot->object()->~T();
+        ++slot->mGeneration;
+        slot->setNextFree(mFirstFree);
+        mFirstFree = handle.index();
+        --mSize;
+
+        return true;
+    }
+
+    T *get(Handle handle) noexcept {
+        Slot *slot = find(handle);
+        return slot ? slot->object() : nullptr;
+    }
+
+    std::size_t size() const noexcept { return mSize; }
+
+    bool empty() const noexcept { return mSize == 0; }
+
+    bool full() const noexcept { return mSize == N; }
+
+    static constexpr std::size_t capacity() noexcept { return N; }
+
+  private:
+    struct Slot {
+        alignas(T) alignas(std::uint16_t) std::byte
+            mStorage[sizeof(T) < sizeof(std::uint16_t) ? sizeof(std::uint16_t)
+                                                       : sizeof(T)];
+        std::uint16_t mGeneration;
+
+        bool occupied() const noexcept { return (mGeneration & 1) != 0; }
+
+        T *object() noexcept {
+            return std::launder(reinterpret_cast<T *>(mStorage));
+        }
+
+        std::uint16_t nextFree() const noexcept {
+            return *std::launder(reinterpret_cast<const std::uint16_t *>(
+                mStorage));
+        }
+
+        void setNextFree(std::uint16_t next) noexcept {
+            new (mStorage) std::uint16_t{next};
+        }
+    };
+
+    Slot *find(Handle handle) noexcept {
+        if (!handle.valid() || (handle.index() >= N)) {
+            return nullptr;
+        }
+
+        Slot &slot = mSlots[handle.index()];
+        if (!slot.occupied() || (slot.mGeneration != handle.generation())) {
+            return nullptr;
+        }
+
+        return &slot;
+    }
+
+    std::array<Slot, N> mSlots;
+    std::uint16_t mFirstFree{0};
+    std::size_t mSize{0};
+};
+
+} // namespace util
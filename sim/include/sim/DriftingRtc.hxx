@@ -0,0 +1,31 @@
+#pragma once
+
+#include <hal/IRTC.hxx>
+#include <hal/Timing.hxx>
+
+#include <sim/VirtualClock.hxx>
+
+#include <cstdint>
+
+namespace sim {
+
+// RTC running off the virtual clock with a constant frequency error. The
+// virtual clock is the true time, midnight at zero.
+class DriftingRtc final : public hal::IRTC {
+  public:
+    DriftingRtc(const VirtualClock &clock, std::int32_t driftPpm,
+                hal::Milliseconds initialError = 0) noexcept;
+
+    hal::Milliseconds getCurrentTimeOfDay() const noexcept final;
+    void adjustCurrentTime(hal::Milliseconds diff) noexcept final;
+
+    // RTC time minus the true time.
+    std::int64_t getError() const noexcept;
+
+  private:
+    const VirtualClock &mClock;
+    std::int32_t mDriftPpm;
+    std::int64_t mAdjustment;
+};
+
+} // namespace sim
\ No newline at end of file
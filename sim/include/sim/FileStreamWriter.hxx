@@ -0,0 +1,22 @@
+#pragma once
+
+#include <hal/IStreamWriter.hxx>
+
+#include <cstddef>
+#include <cstdio>
+#include <span>
+
+namespace sim {
+
+// Stream into a stdio file, which stays owned by the caller.
+class FileStreamWriter final : public hal::IStreamWriter {
+  public:
+    FileStreamWriter(std::FILE *file) noexcept;
+
+    std::size_t write(std::span<const std::byte> data) noexcept final;
+
+  private:
+    std::FILE *mFile;
+};
+
+} // namespace sim
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <hal/IDatagramSocket.hxx>
+#include <hal/Timing.hxx>
+
+#include <sim/VirtualClock.hxx>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace sim {
+
+// Stand-in SNTP server behind an in-memory loopback socket. A request
+// reaches it after the uplink delay and is answered with the true time of
+// the virtual clock, midnight at zero; receive() hands the reply out once
+// the downlink delay has passed as well. It can go silent or send
+// kiss-o'-death replies to exercise the failure paths of a client.
+class LoopbackSntpServer final : public hal::IDatagramSocket {
+  public:
+    static constexpr std::size_t kPacketSize = 48;
+    static constexpr hal::Milliseconds kProcessingTime = 1;
+
+    LoopbackSntpServer(const VirtualClock &clock, hal::Milliseconds uplink,
+                       hal::Milliseconds downlink) noexcept;
+
+    LoopbackSntpServer(const LoopbackSntpServer &) = delete;
+    LoopbackSntpServer(LoopbackSntpServer &&) noexcept = delete;
+    LoopbackSntpServer &operator=(const LoopbackSntpServer &) = delete;
+    LoopbackSntpServer &operator=(LoopbackSntpServer &&) noexcept = delete;
+
+    ~LoopbackSntpServer() = default;
+
+    bool send(std::span<const std::byte> datagram) noexcept final;
+    std::size_t receive(std::span<std::byte> buffer) noexcept final;
+
+    // Time until the next reply can be received, kForever when none is on
+    // its way. A platform would wake the client task then.
+    hal::Milliseconds nextDelivery() const noexcept;
+
+    void setDelays(hal::Milliseconds uplink,
+                   hal::Milliseconds downlink) noexcept;
+    void setSilent(bool silent) noexcept;
+    // Stratum 0 replies are kiss-o'-death.
+    void setStratum(std::uint8_t stratum) noexcept;
+    std::uint64_t getRequests() const noexcept;
+
+  private:
+    using Packet = std::array<std::byte, kPacketSize>;
+
+    struct Reply {
+        VirtualClock::Time deliverAt;
+        Packet packet;
+    };
+
+    static void writeTimestamp(Packet &packet, std::size_t offset,
+                               VirtualClock::Time time) noexcept;
+
+    const VirtualClock &mClock;
+    hal::Milliseconds mUplink;
+    hal::Milliseconds mDownlink;
+    bool mSilent;
+    std::uint8_t mStratum;
+    std::uint64_t mRequests;
+    std::vector<Reply> mReplies;
+};
+
+} // namespace sim
\ No newline at end of file
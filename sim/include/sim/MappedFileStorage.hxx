@@ -0,0 +1,55 @@
+#pragma once
+
+#include <hal/IStorage.hxx>
+
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <string>
+
+namespace sim {
+
+// Host flash over a memory-mapped file, so persistence backends can be
+// benchmarked and crash-tested on Linux. Writes AND into the existing bytes
+// like NOR flash programming does, and a write budget cuts the data off
+// mid-write to emulate power loss: once it is spent every write fails.
+class MappedFileStorage final : public hal::IStorage {
+  public:
+    static constexpr std::size_t kDefaultSectorSize = 4096;
+    static constexpr std::size_t kUnlimited =
+        std::numeric_limits<std::size_t>::max();
+
+    // Maps path, creating it erased if it does not exist yet.
+    MappedFileStorage(const std::string &path, std::size_t size,
+                      std::size_t sectorSize = kDefaultSectorSize) noexcept;
+
+    MappedFileStorage(const MappedFileStorage &) = delete;
+    MappedFileStorage(MappedFileStorage &&) noexcept = delete;
+    MappedFileStorage &operator=(const MappedFileStorage &) = delete;
+    MappedFileStorage &operator=(MappedFileStorage &&) noexcept = delete;
+
+    ~MappedFileStorage();
+
+    bool isOpen() const noexcept;
+    // Bytes which may still be written before the emulated power loss.
+    void setWriteBudget(std::size_t bytes) noexcept;
+
+    std::size_t size() const noexcept final;
+    std::size_t sectorSize() const noexcept final;
+    bool read(std::size_t offset,
+              std::span<std::byte> data) const noexcept final;
+    bool write(std::size_t offset,
+               std::span<const std::byte> data) noexcept final;
+    bool erase(std::size_t offset, std::size_t length) noexcept final;
+    bool sync() noexcept final;
+
+  private:
+    bool inBounds(std::size_t offset, std::size_t length) const noexcept;
+
+    std::byte *mData;
+    std::size_t mSize;
+    std::size_t mSectorSize;
+    std::size_t mWriteBudget;
+};
+
+} // namespace sim
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <hal/Timing.hxx>
+
+#include <staircase/IMoving.hxx>
+
+#include <sim/VirtualClock.hxx>
+
+#include <cstdint>
+
+namespace sim {
+
+struct TrafficConfig {
+    // Mean time between two pedestrians, arrivals are a Poisson process.
+    hal::Milliseconds meanArrivalInterval = 10 * 60 * 1000;
+    hal::Milliseconds minWalkDuration = 8000;
+    hal::Milliseconds maxWalkDuration = 14000;
+    // How long a pedestrian stays within range of a sensor.
+    hal::Milliseconds sensorPresence = 1000;
+    std::uint32_t upPercent = 50;
+};
+
+struct Pedestrian {
+    VirtualClock::Time arrival;
+    hal::Milliseconds walkDuration;
+    staircase::IMoving::Direction direction;
+};
+
+// Deterministic pedestrian generator: the same config and seed always yield
+// the same sequence of pedestrians.
+class PedestrianTraffic {
+  public:
+    PedestrianTraffic(const TrafficConfig &config, std::uint64_t seed) noexcept;
+
+    Pedestrian next() noexcept;
+
+  private:
+    std::uint64_t random() noexcept;
+    double uniform() noexcept;
+
+    TrafficConfig mConfig;
+    std::uint64_t mState;
+    VirtualClock::Time mLastArrival;
+};
+
+} // namespace sim
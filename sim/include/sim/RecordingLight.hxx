@@ -0,0 +1,31 @@
+#pragma once
+
+#include <hal/BinaryValue.hxx>
+#include <hal/IBinaryValueWriter.hxx>
+
+#include <sim/VirtualClock.hxx>
+
+#include <cstdint>
+
+namespace sim {
+
+// Light output which records how often and for how long it was switched on.
+class RecordingLight final : public hal::IBinaryValueWriter {
+  public:
+    RecordingLight(const VirtualClock &clock) noexcept;
+
+    void writeValue(hal::BinaryValue value) noexcept final;
+
+    bool isOn() const noexcept;
+    std::uint64_t getSwitchOns() const noexcept;
+    VirtualClock::Time getOnTime() const noexcept;
+
+  private:
+    const VirtualClock &mClock;
+    bool mOn;
+    VirtualClock::Time mOnSince;
+    VirtualClock::Time mOnTime;
+    std::uint64_t mSwitchOns;
+};
+
+} // namespace sim
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <hal/BinaryValue.hxx>
+#include <hal/IBinaryValueReader.hxx>
+
+#include <cstdint>
+
+namespace sim {
+
+// Proximity sensor input driven by the traffic model. It reads HIGH while at
+// least one pedestrian is within range.
+class SimulatedSensor final : public hal::IBinaryValueReader {
+  public:
+    SimulatedSensor() noexcept;
+
+    hal::BinaryValue readValue() noexcept final;
+
+    void enter() noexcept;
+    void leave() noexcept;
+
+  private:
+    std::uint32_t mPresent;
+};
+
+} // namespace sim
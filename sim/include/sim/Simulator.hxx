@@ -0,0 +1,219 @@
+#pragma once
+
+#include <hal/BinaryValue.hxx>
+#include <hal/IStreamWriter.hxx>
+#include <hal/Timing.hxx>
+
+#include <staircase/BasicLight.hxx>
+#include <staircase/ClippedSquaredMovingDurationCalculator.hxx>
+#include <staircase/EWMAMovingTimeFilter.hxx>
+#include <staircase/IBasicLight.hxx>
+#include <staircase/IMoving.hxx>
+#include <staircase/IMovingTimeFilter.hxx>
+#include <staircase/MTAMovingTimeFilter.hxx>
+#include <staircase/ProximitySensor.hxx>
+#include <staircase/SlidingMedianMovingTimeFilter.hxx>
+#include <staircase/StaircaseLooper.hxx>
+#include <staircase/StaticMovingFactory.hxx>
+#include <staircase/TickProfile.hxx>
+#include <staircase/TraceRing.hxx>
+#include <staircase/TraceRunnable.hxx>
+
+#include <sim/PedestrianTraffic.hxx>
+#include <sim/RecordingLight.hxx>
+#include <sim/SimulatedSensor.hxx>
+#include <sim/VirtualClock.hxx>
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace sim {
+
+enum class FilterType { MTA, EWMA, MEDIAN };
+
+struct SimulationConfig {
+    // Update period of a real device. Ignored when tickless, where the
+    // looper is only updated at its own deadlines and at sensor edges.
+    hal::Milliseconds tick = 10;
+    bool tickless = true;
+    // Fixed tick only: while the looper is idle the device parks until the
+    // next sensor edge instead of ticking, as a parking ITask does.
+    bool parkWhenIdle = false;
+    std::uint64_t seed = 1;
+    // Moving time estimator of each direction.
+    FilterType downFilter = FilterType::MTA;
+    FilterType upFilter = FilterType::MTA;
+    // Phase periods of the looper, single rate by default.
+    staircase::StaircaseLooper::PhasePeriods periods;
+    TrafficConfig traffic;
+};
+
+struct SimulationReport {
+    VirtualClock::Time simulatedTime;
+    std::uint64_t updates;
+    // Times the device woke to update the looper, edges handled in the
+    // same wake not counted again, and the time it spent parked.
+    std::uint64_t wakeups;
+    VirtualClock::Time parkedTime;
+    std::uint64_t pedestrians;
+    // A pedestrian passing the middle of a step is one checkpoint. Dark
+    // checkpoints are the ones where that step's light was off.
+    std::uint64_t checkpoints;
+    std::uint64_t darkCheckpoints;
+    std::uint64_t lightSwitchOns;
+    // Walks the looper finished and fed to the moving time filters.
+    std::uint64_t walks;
+    VirtualClock::Time lightOnTime;
+    hal::Milliseconds downMovingTime;
+    hal::Milliseconds upMovingTime;
+    double wallSeconds;
+};
+
+// Host side simulation of a whole staircase. Pedestrian traffic drives the
+// sensor edges of the real StaircaseLooper, ProximitySensor, Moving and
+// moving time filters on a virtual clock, so weeks of traffic run in seconds
+// and the same seed always reproduces the same run.
+class Simulator {
+  public:
+    Simulator(const SimulationConfig &config) noexcept;
+
+    Simulator(const Simulator &) = delete;
+    Simulator(Simulator &&) noexcept = delete;
+    Simulator &operator=(const Simulator &) = delete;
+    Simulator &operator=(Simulator &&) noexcept = delete;
+
+    ~Simulator() = default;
+
+    // Runs for the given amount of simulated time on top of earlier runs.
+    void run(VirtualClock::Time duration);
+
+    SimulationReport getReport() const noexcept;
+
+    // Dumps the looper trace into writer, drained after every update. Needs
+    // a build with STAIRCASE_TRACE.
+    void traceTo(hal::IStreamWriter &writer) noexcept;
+
+    // Measures the looper updates into profile. Wall clock based, so only
+    // meaningful in an optimized build.
+    void profileWith(staircase::TickProfile &profile) noexcept;
+
+    const staircase::StaircaseLooper &getLooper() const noexcept {
+        return mLooper;
+    }
+
+  private:
+    static constexpr std::size_t kLightsNum =
+        staircase::IBasicLight::kLightsNum;
+
+    enum class EventType { ENTER, LEAVE, CHECKPOINT };
+
+    struct Event {
+        VirtualClock::Time time;
+        std::uint64_t order;
+        EventType type;
+        // Sensor for ENTER and LEAVE, light index for CHECKPOINT.
+        std::size_t target;
+
+        bool operator>(const Event &other) const noexcept {
+            return std::pair{time, order} > std::pair{other.time, other.order};
+        }
+    };
+
+    // One of each estimator, so that the configured one can be handed to the
+    // looper by reference.
+    struct Filters {
+        Filters() noexcept
+            : mta{INITIAL_MOVING_DURATION}, ewma{INITIAL_MOVING_DURATION},
+              median{INITIAL_MOVING_DURATION} {}
+
+        staircase::IMovingTimeFilter &select(FilterType type) noexcept {
+            switch (type) {
+            case FilterType::EWMA:
+                return ewma;
+            case FilterType::MEDIAN:
+                return median;
+            case FilterType::MTA:
+            default:
+                return mta;
+            }
+        }
+
+        staircase::MTAMovingTimeFilter mta;
+        staircase::EWMAMovingTimeFilter<> ewma;
+        staircase::SlidingMedianMovingTimeFilter<> median;
+    };
+
+    static constexpr std::size_t kDownSensor = 0;
+    static constexpr std::size_t kUpSensor = 1;
+    // Keeps a single update within the range of hal::Milliseconds.
+    static constexpr VirtualClock::Time kMaxStep = 24 * 60 * 60 * 1000;
+
+    void schedule(const Pedestrian &pedestrian);
+    void push(VirtualClock::Time time, EventType type, std::size_t target);
+    bool applyEvents() noexcept;
+    void pushEdge(std::size_t sensor, hal::BinaryValue before) noexcept;
+    void update(VirtualClock::Time time) noexcept;
+    void updateLooper(hal::Milliseconds delta) noexcept;
+    bool isParked() const noexcept;
+    VirtualClock::Time nextStep(VirtualClock::Time end) const noexcept;
+    VirtualClock::Time nextEvent(VirtualClock::Time end) const noexcept;
+
+    template <std::size_t... I>
+    std::array<RecordingLight, kLightsNum>
+    makeOutputs(std::index_sequence<I...>) noexcept {
+        return {((void)I, RecordingLight{mClock})...};
+    }
+
+    template <std::size_t... I>
+    std::array<staircase::BasicLight, kLightsNum>
+    makeLights(std::index_sequence<I...>) noexcept {
+        return {staircase::BasicLight{mOutputs[I]}...};
+    }
+
+    template <std::size_t... I>
+    staircase::BasicLights makeLightRefs(std::index_sequence<I...>) noexcept {
+        return {mLights[I]...};
+    }
+
+    SimulationConfig mConfig;
+    VirtualClock mClock;
+    PedestrianTraffic mTraffic;
+    Pedestrian mNextPedestrian;
+
+    std::array<RecordingLight, kLightsNum> mOutputs;
+    std::array<staircase::BasicLight, kLightsNum> mLights;
+    staircase::BasicLights mLightRefs;
+    std::array<SimulatedSensor, 2> mInputs;
+    // Filled the way the pin interrupts of a parking device fill them.
+    std::array<staircase::ProximitySensor::EdgeQueue, 2> mEdges;
+    staircase::ProximitySensor mDownSensor;
+    staircase::ProximitySensor mUpSensor;
+    staircase::StaticMovingFactory<2 * staircase::IMoving::kMaxMovings>
+        mMovingFactory;
+    staircase::ClippedSquaredMovingDurationCalculator mDurationCalculator;
+    Filters mDownFilters;
+    Filters mUpFilters;
+    staircase::IMovingTimeFilter &mDownFilter;
+    staircase::IMovingTimeFilter &mUpFilter;
+    staircase::StaircaseLooper mLooper;
+    staircase::TraceRing mTrace;
+    std::optional<staircase::TraceRunnable> mTraceDrain;
+
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>>
+        mEvents;
+    std::uint64_t mEventOrder;
+
+    std::uint64_t mUpdates;
+    std::uint64_t mWakeups;
+    VirtualClock::Time mParkedTime;
+    std::uint64_t mPedestrians;
+    std::uint64_t mCheckpoints;
+    std::uint64_t mDarkCheckpoints;
+    double mWallSeconds;
+};
+
+} // namespace sim
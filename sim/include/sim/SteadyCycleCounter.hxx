@@ -0,0 +1,17 @@
+#pragma once
+
+#include <hal/ICycleCounter.hxx>
+
+#include <cstdint>
+
+namespace sim {
+
+// Host stand-in for the CPU cycle counter: nanoseconds of the steady clock,
+// truncated to 32 bits.
+class SteadyCycleCounter final : public hal::ICycleCounter {
+  public:
+    std::uint32_t cycles() const noexcept final;
+    std::uint32_t frequency() const noexcept final;
+};
+
+} // namespace sim
\ No newline at end of file
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <staircase/TraceRing.hxx>
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace sim {
+
+// Host side reading of TraceRunnable dumps. A truncated last record is
+// ignored.
+std::vector<staircase::TraceRecord>
+decodeTrace(std::span<const std::byte> dump);
+
+// One timeline line, e.g. "     12.345 s  MOVING_CREATE    up, 12000 ms".
+std::string formatTraceRecord(const staircase::TraceRecord &record);
+
+} // namespace sim
\ No newline at end of file
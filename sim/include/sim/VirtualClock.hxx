@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+namespace sim {
+
+// Simulated monotonic clock in milliseconds. 64 bits wide so runs spanning
+// weeks never wrap.
+class VirtualClock {
+  public:
+    using Time = std::uint64_t;
+
+    VirtualClock() noexcept : mNow{0} {}
+
+    VirtualClock(const VirtualClock &) = delete;
+    VirtualClock(VirtualClock &&) noexcept = delete;
+    VirtualClock &operator=(const VirtualClock &) = delete;
+    VirtualClock &operator=(VirtualClock &&) noexcept = delete;
+
+    ~VirtualClock() = default;
+
+    Time now() const noexcept { return mNow; }
+    void advanceTo(Time time) noexcept { mNow = time; }
+
+  private:
+    Time mNow;
+};
+
+} // namespace sim
@@ -0,0 +1,36 @@
+#include <sim/DriftingRtc.hxx>
+
+#include <hal/Timing.hxx>
+
+#include <sim/VirtualClock.hxx>
+
+#include <cstdint>
+
+using namespace sim;
+
+namespace {
+
+constexpr std::int64_t kDay = 24 * 60 * 60 * 1000;
+
+} // namespace
+
+DriftingRtc::DriftingRtc(const VirtualClock &clock, std::int32_t driftPpm,
+                         hal::Milliseconds initialError) noexcept
+    : mClock{clock}, mDriftPpm{driftPpm}, mAdjustment{initialError} {}
+
+hal::Milliseconds DriftingRtc::getCurrentTimeOfDay() const noexcept {
+    auto time = static_cast<std::int64_t>(mClock.now()) + getError();
+    auto timeOfDay = time % kDay;
+    return static_cast<hal::Milliseconds>((timeOfDay < 0) ? timeOfDay + kDay
+                                                          : timeOfDay);
+}
+
+void DriftingRtc::adjustCurrentTime(hal::Milliseconds diff) noexcept {
+    mAdjustment += diff;
+}
+
+std::int64_t DriftingRtc::getError() const noexcept {
+    auto drift = static_cast<std::int64_t>(mClock.now()) * mDriftPpm /
+                 (1000 * 1000);
+    return drift + mAdjustment;
+}
\ No newline at end of file
@@ -0,0 +1,12 @@
+#include <sim/FileStreamWriter.hxx>
+
+#include <hal/IStreamWriter.hxx>
+
+using namespace sim;
+
+FileStreamWriter::FileStreamWriter(std::FILE *file) noexcept : mFile{file} {}
+
+std::size_t
+FileStreamWriter::write(std::span<const std::byte> data) noexcept {
+    return std::fwrite(data.data(), 1, data.size(), mFile);
+}
\ No newline at end of file
@@ -0,0 +1,129 @@
+#include <sim/LoopbackSntpServer.hxx>
+
+#include <hal/Timing.hxx>
+
+#include <sim/VirtualClock.hxx>
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace sim;
+
+namespace {
+
+// NTP seconds of the virtual clock's zero, a midnight in 2023.
+constexpr std::uint64_t kEpochSeconds = 45000ull * 24 * 60 * 60;
+
+constexpr std::size_t kStratum = 1;
+constexpr std::size_t kPoll = 2;
+constexpr std::size_t kPrecision = 3;
+constexpr std::size_t kReferenceId = 12;
+constexpr std::size_t kReference = 16;
+constexpr std::size_t kOriginate = 24;
+constexpr std::size_t kReceive = 32;
+constexpr std::size_t kTransmit = 40;
+constexpr unsigned kModeClient = 3;
+constexpr unsigned kModeServer = 4;
+
+} // namespace
+
+LoopbackSntpServer::LoopbackSntpServer(const VirtualClock &clock,
+                                       hal::Milliseconds uplink,
+                                       hal::Milliseconds downlink) noexcept
+    : mClock{clock}, mUplink{uplink}, mDownlink{downlink}, mSilent{false},
+      mStratum{1}, mRequests{0} {}
+
+bool LoopbackSntpServer::send(std::span<const std::byte> datagram) noexcept {
+    ++mRequests;
+
+    auto header =
+        datagram.empty() ? 0u : std::to_integer<unsigned>(datagram[0]);
+    if (mSilent || datagram.size() < kPacketSize ||
+        (header & 0x07) != kModeClient) {
+        // Lost on the way, as far as the client can tell.
+        return true;
+    }
+
+    Reply reply{};
+    auto &packet = reply.packet;
+    auto receivedAt = mClock.now() + mUplink;
+    auto sentAt = receivedAt + kProcessingTime;
+
+    packet[0] = static_cast<std::byte>((header & 0x38) | kModeServer);
+    packet[kStratum] = static_cast<std::byte>(mStratum);
+    packet[kPoll] = datagram[kPoll];
+    // 2^-20 s, about a microsecond.
+    packet[kPrecision] = static_cast<std::byte>(-20);
+    constexpr char kId[] = "LOOP";
+    constexpr char kKissOfDeath[] = "DENY";
+    const char *id = (mStratum == 0) ? kKissOfDeath : kId;
+    for (std::size_t index = 0; index < 4; ++index) {
+        packet[kReferenceId + index] = static_cast<std::byte>(id[index]);
+    }
+
+    writeTimestamp(packet, kReference, receivedAt);
+    std::copy_n(datagram.begin() + kTransmit, 8, packet.begin() + kOriginate);
+    writeTimestamp(packet, kReceive, receivedAt);
+    writeTimestamp(packet, kTransmit, sentAt);
+
+    reply.deliverAt = sentAt + mDownlink;
+    mReplies.push_back(reply);
+    return true;
+}
+
+std::size_t LoopbackSntpServer::receive(std::span<std::byte> buffer) noexcept {
+    auto next = std::min_element(
+        mReplies.begin(), mReplies.end(),
+        [](const auto &first, const auto &second) {
+            return first.deliverAt < second.deliverAt;
+        });
+    if (next == mReplies.end() || next->deliverAt > mClock.now()) {
+        return 0;
+    }
+
+    auto size = std::min(buffer.size(), next->packet.size());
+    std::copy_n(next->packet.begin(), size, buffer.begin());
+    mReplies.erase(next);
+    return kPacketSize;
+}
+
+hal::Milliseconds LoopbackSntpServer::nextDelivery() const noexcept {
+    auto deadline = hal::kForever;
+    for (const auto &reply : mReplies) {
+        auto left = (reply.deliverAt > mClock.now())
+                        ? static_cast<hal::Milliseconds>(reply.deliverAt -
+                                                         mClock.now())
+                        : 0;
+        deadline = hal::earliestDeadline(deadline, left);
+    }
+
+    return deadline;
+}
+
+void LoopbackSntpServer::setDelays(hal::Milliseconds uplink,
+                                   hal::Milliseconds downlink) noexcept {
+    mUplink = uplink;
+    mDownlink = downlink;
+}
+
+void LoopbackSntpServer::setSilent(bool silent) noexcept { mSilent = silent; }
+
+void LoopbackSntpServer::setStratum(std::uint8_t stratum) noexcept {
+    mStratum = stratum;
+}
+
+std::uint64_t LoopbackSntpServer::getRequests() const noexcept {
+    return mRequests;
+}
+
+void LoopbackSntpServer::writeTimestamp(Packet &packet, std::size_t offset,
+                                        VirtualClock::Time time) noexcept {
+    auto seconds = kEpochSeconds + time / 1000;
+    // Rounded up, so clients which round down read back the millisecond.
+    auto fraction = (((time % 1000) << 32) + 999) / 1000;
+    for (std::size_t index = 0; index < 4; ++index) {
+        auto shift = 8 * (3 - index);
+        packet[offset + index] = static_cast<std::byte>(seconds >> shift);
+        packet[offset + 4 + index] = static_cast<std::byte>(fraction >> shift);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,179 @@
+#include <staircase/TickProfile.hxx>
+
+#include <sim/FileStreamWriter.hxx>
+#include <sim/Simulator.hxx>
+#include <sim/SteadyCycleCounter.hxx>
+#include <sim/VirtualClock.hxx>
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+void usage(const char *name) {
+    std::printf("usage: %s [--days N] [--seed N] [--interval SECONDS] "
+                "[--tick MS [--park] | --tickless] "
+                "[--filter mta|ewma|median] "
+                "[--down-filter TYPE] [--up-filter TYPE] [--trace FILE] "
+                "[--profile]\n",
+                name);
+}
+
+bool parseFilter(const char *value, sim::FilterType &type) {
+    if (std::strcmp(value, "mta") == 0) {
+        type = sim::FilterType::MTA;
+    } else if (std::strcmp(value, "ewma") == 0) {
+        type = sim::FilterType::EWMA;
+    } else if (std::strcmp(value, "median") == 0) {
+        type = sim::FilterType::MEDIAN;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+void printProfile(const staircase::TickProfile &profile) {
+    struct Row {
+        const char *name;
+        staircase::TickPhase phase;
+    };
+
+    constexpr Row kRows[] = {
+        {"lights", staircase::TickPhase::LIGHTS},
+        {"sensors", staircase::TickPhase::SENSORS},
+        {"movings", staircase::TickPhase::MOVINGS},
+        {"stale removal", staircase::TickPhase::STALE_REMOVAL},
+        {"whole update", staircase::TickPhase::TICK},
+    };
+
+    std::printf("update latency        p50 / p99 / max ns\n");
+    for (const auto &row : kRows) {
+        auto summary = profile.summary(row.phase);
+        std::printf("  %-19s %" PRIu32 " / %" PRIu32 " / %" PRIu32 "\n",
+                    row.name, summary.p50, summary.p99, summary.max);
+    }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    sim::SimulationConfig config;
+    double days = 14;
+    const char *tracePath = nullptr;
+    bool profiled = false;
+
+    for (int index = 1; index < argc; ++index) {
+        const char *argument = argv[index];
+        const char *value = (index + 1 < argc) ? argv[index + 1] : nullptr;
+
+        if (std::strcmp(argument, "--tickless") == 0) {
+            config.tickless = true;
+        } else if (std::strcmp(argument, "--park") == 0) {
+            config.parkWhenIdle = true;
+        } else if (std::strcmp(argument, "--profile") == 0) {
+            profiled = true;
+        } else if (value && std::strcmp(argument, "--days") == 0) {
+            days = std::atof(value);
+            ++index;
+        } else if (value && std::strcmp(argument, "--seed") == 0) {
+            config.seed = std::strtoull(value, nullptr, 10);
+            ++index;
+        } else if (value && std::strcmp(argument, "--interval") == 0) {
+            config.traffic.meanArrivalInterval = std::atoi(value) * 1000;
+            ++index;
+        } else if (value && std::strcmp(argument, "--filter") == 0 &&
+                   parseFilter(value, config.downFilter)) {
+            config.upFilter = config.downFilter;
+            ++index;
+        } else if (value && std::strcmp(argument, "--down-filter") == 0 &&
+                   parseFilter(value, config.downFilter)) {
+            ++index;
+        } else if (value && std::strcmp(argument, "--up-filter") == 0 &&
+                   parseFilter(value, config.upFilter)) {
+            ++index;
+        } else if (value && std::strcmp(argument, "--trace") == 0) {
+            tracePath = value;
+            ++index;
+        } else if (value && std::strcmp(argument, "--tick") == 0) {
+            config.tick = std::atoi(value);
+            config.tickless = false;
+            ++index;
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (days <= 0 || config.tick <= 0 ||
+        (config.parkWhenIdle && config.tickless) ||
+        config.traffic.meanArrivalInterval <= 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    static sim::Simulator simulator{config};
+
+    std::FILE *trace = nullptr;
+    if (tracePath) {
+        trace = std::fopen(tracePath, "wb");
+        if (!trace) {
+            std::perror(tracePath);
+            return 1;
+        }
+    }
+
+    static sim::FileStreamWriter traceWriter{trace};
+    if (trace) {
+        simulator.traceTo(traceWriter);
+    }
+
+    static sim::SteadyCycleCounter counter;
+    static staircase::TickProfile profile{counter};
+    if (profiled) {
+        simulator.profileWith(profile);
+    }
+    simulator.run(
+        static_cast<sim::VirtualClock::Time>(days * 24 * 3600 * 1000));
+
+    if (trace) {
+        std::fclose(trace);
+    }
+
+    auto report = simulator.getReport();
+    double simulatedSeconds = report.simulatedTime / 1000.0;
+
+    std::printf("simulated time        %.1f days\n",
+                simulatedSeconds / (24 * 3600));
+    std::printf("mode                  %s\n",
+                config.tickless       ? "tickless"
+                : config.parkWhenIdle ? "fixed tick, parked when idle"
+                                      : "fixed tick");
+    std::printf("pedestrians           %" PRIu64 "\n", report.pedestrians);
+    std::printf("dark checkpoints      %" PRIu64 " of %" PRIu64 " (%.2f%%)\n",
+                report.darkCheckpoints, report.checkpoints,
+                report.checkpoints
+                    ? 100.0 * report.darkCheckpoints / report.checkpoints
+                    : 0.0);
+    std::printf("light switch-ons      %" PRIu64 "\n", report.lightSwitchOns);
+    std::printf("light on time         %.1f hours\n",
+                report.lightOnTime / 3600000.0);
+    std::printf("learned moving time   down %d ms, up %d ms\n",
+                report.downMovingTime, report.upMovingTime);
+    std::printf("looper updates        %" PRIu64 "\n", report.updates);
+    std::printf("wakeups               %.0f per hour, parked %.1f%%\n",
+                report.wakeups * 3600.0 / simulatedSeconds,
+                100.0 * report.parkedTime / report.simulatedTime);
+    std::printf("wall time             %.3f s\n", report.wallSeconds);
+    std::printf("throughput            %.0f ticks/s, %.0fx real time\n",
+                report.updates / report.wallSeconds,
+                simulatedSeconds / report.wallSeconds);
+
+    if (profiled) {
+        printProfile(profile);
+    }
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+#include <sim/MappedFileStorage.hxx>
+
+#include <hal/IStorage.hxx>
+
+#include <algorithm>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace sim;
+
+MappedFileStorage::MappedFileStorage(const std::string &path,
+                                     std::size_t size,
+                                     std::size_t sectorSize) noexcept
+    : mData{nullptr}, mSize{size}, mSectorSize{sectorSize},
+      mWriteBudget{kUnlimited} {
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        return;
+    }
+
+    struct stat status {};
+    bool fresh = ::fstat(fd, &status) == 0 && status.st_size == 0;
+    if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        ::close(fd);
+        return;
+    }
+
+    void *data =
+        ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        return;
+    }
+
+    mData = static_cast<std::byte *>(data);
+    if (fresh) {
+        std::fill_n(mData, mSize, kErased);
+    }
+}
+
+MappedFileStorage::~MappedFileStorage() {
+    if (mData) {
+        ::munmap(mData, mSize);
+    }
+}
+
+bool MappedFileStorage::isOpen() const noexcept { return mData != nullptr; }
+
+void MappedFileStorage::setWriteBudget(std::size_t bytes) noexcept {
+    mWriteBudget = bytes;
+}
+
+std::size_t MappedFileStorage::size() const noexcept { return mSize; }
+
+std::size_t MappedFileStorage::sectorSize() const noexcept {
+    return mSectorSize;
+}
+
+bool MappedFileStorage::read(std::size_t offset,
+                             std::span<std::byte> data) const noexcept {
+    if (!inBounds(offset, data.size())) {
+        return false;
+    }
+
+    std::memcpy(data.data(), mData + offset, data.size());
+    return true;
+}
+
+bool MappedFileStorage::write(std::size_t offset,
+                              std::span<const std::byte> data) noexcept {
+    if (!inBounds(offset, data.size())) {
+        return false;
+    }
+
+    auto length = std::min(data.size(), mWriteBudget);
+    for (std::size_t index = 0; index < length; ++index) {
+        mData[offset + index] &= data[index];
+    }
+
+    if (mWriteBudget != kUnlimited) {
+        mWriteBudget -= length;
+    }
+
+    return length == data.size();
+}
+
+bool MappedFileStorage::erase(std::size_t offset,
+                              std::size_t length) noexcept {
+    if (!inBounds(offset, length) || offset % mSectorSize != 0 ||
+        length % mSectorSize != 0 || mWriteBudget == 0) {
+        return false;
+    }
+
+    std::fill_n(mData + offset, length, kErased);
+    return true;
+}
+
+bool MappedFileStorage::sync() noexcept {
+    return mData && ::msync(mData, mSize, MS_SYNC) == 0;
+}
+
+bool MappedFileStorage::inBounds(std::size_t offset,
+                                 std::size_t length) const noexcept {
+    return mData && offset <= mSize && length <= mSize - offset;
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+#include <sim/PedestrianTraffic.hxx>
+
+#include <hal/Timing.hxx>
+
+#include <staircase/IMoving.hxx>
+
+#include <sim/VirtualClock.hxx>
+
+#include <cmath>
+#include <cstdint>
+
+using namespace sim;
+
+PedestrianTraffic::PedestrianTraffic(const TrafficConfig &config,
+                                     std::uint64_t seed) noexcept
+    : mConfig{config}, mState{seed}, mLastArrival{0} {}
+
+Pedestrian PedestrianTraffic::next() noexcept {
+    double interval = -std::log(1.0 - uniform()) * mConfig.meanArrivalInterval;
+    mLastArrival += static_cast<VirtualClock::Time>(interval) + 1;
+
+    hal::Milliseconds walkRange =
+        mConfig.maxWalkDuration - mConfig.minWalkDuration + 1;
+    auto walkDuration = static_cast<hal::Milliseconds>(
+        mConfig.minWalkDuration + random() % walkRange);
+
+    auto direction = (random() % 100 < mConfig.upPercent)
+                         ? staircase::IMoving::Direction::UP
+                         : staircase::IMoving::Direction::DOWN;
+
+    return Pedestrian{mLastArrival, walkDuration, direction};
+}
+
+// SplitMix64, small and identical everywhere unlike the std distributions.
+std::uint64_t PedestrianTraffic::random() noexcept {
+    std::uint64_t z = (mState += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+double PedestrianTraffic::uniform() noexcept {
+    return (random() >> 11) * 0x1.0p-53;
+}
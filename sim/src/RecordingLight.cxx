@@ -0,0 +1,36 @@
+#include <sim/RecordingLight.hxx>
+
+#include <hal/BinaryValue.hxx>
+
+#include <sim/VirtualClock.hxx>
+
+using namespace sim;
+
+RecordingLight::RecordingLight(const VirtualClock &clock) noexcept
+    : mClock{clock}, mOn{false}, mOnSince{0}, mOnTime{0}, mSwitchOns{0} {}
+
+void RecordingLight::writeValue(hal::BinaryValue value) noexcept {
+    bool on = value == hal::BinaryValue::HIGH;
+    if (on == mOn) {
+        return;
+    }
+
+    if (on) {
+        mOnSince = mClock.now();
+        ++mSwitchOns;
+    } else {
+        mOnTime += mClock.now() - mOnSince;
+    }
+
+    mOn = on;
+}
+
+bool RecordingLight::isOn() const noexcept { return mOn; }
+
+std::uint64_t RecordingLight::getSwitchOns() const noexcept {
+    return mSwitchOns;
+}
+
+VirtualClock::Time RecordingLight::getOnTime() const noexcept {
+    return mOn ? mOnTime + (mClock.now() - mOnSince) : mOnTime;
+}
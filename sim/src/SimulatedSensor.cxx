@@ -0,0 +1,19 @@
+#include <sim/SimulatedSensor.hxx>
+
+#include <hal/BinaryValue.hxx>
+
+using namespace sim;
+
+SimulatedSensor::SimulatedSensor() noexcept : mPresent{0} {}
+
+hal::BinaryValue SimulatedSensor::readValue() noexcept {
+    return (mPresent > 0) ? hal::BinaryValue::HIGH : hal::BinaryValue::LOW;
+}
+
+void SimulatedSensor::enter() noexcept { ++mPresent; }
+
+void SimulatedSensor::leave() noexcept {
+    if (mPresent > 0) {
+        --mPresent;
+    }
+}
@@ -0,0 +1,226 @@
+#include <sim/Simulator.hxx>
+
+#include <hal/BinaryEdge.hxx>
+#include <hal/BinaryValue.hxx>
+#include <hal/Timing.hxx>
+
+#include <staircase/IMoving.hxx>
+
+#include <sim/PedestrianTraffic.hxx>
+#include <sim/VirtualClock.hxx>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <utility>
+
+using namespace sim;
+
+Simulator::Simulator(const SimulationConfig &config) noexcept
+    : mConfig{config}, mTraffic{config.traffic, config.seed},
+      mNextPedestrian{mTraffic.next()},
+      mOutputs{makeOutputs(std::make_index_sequence<kLightsNum>{})},
+      mLights{makeLights(std::make_index_sequence<kLightsNum>{})},
+      mLightRefs{makeLightRefs(std::make_index_sequence<kLightsNum>{})},
+      mDownSensor{mEdges[kDownSensor], mInputs[kDownSensor],
+                  static_cast<hal::Timestamp>(mClock.now())},
+      mUpSensor{mEdges[kUpSensor], mInputs[kUpSensor],
+                static_cast<hal::Timestamp>(mClock.now())},
+      mDownFilter{mDownFilters.select(config.downFilter)},
+      mUpFilter{mUpFilters.select(config.upFilter)},
+      mLooper{mLightRefs,      mDownSensor,         mUpSensor,
+              mMovingFactory,  mDurationCalculator, mDownFilter,
+              mUpFilter},
+      mEventOrder{0}, mUpdates{0}, mWakeups{0}, mParkedTime{0},
+      mPedestrians{0}, mCheckpoints{0},
+      mDarkCheckpoints{0}, mWallSeconds{0} {
+    mLooper.setPeriods(config.periods);
+}
+
+void Simulator::run(VirtualClock::Time duration) {
+    auto start = std::chrono::steady_clock::now();
+    VirtualClock::Time end = mClock.now() + duration;
+
+    while (mClock.now() < end) {
+        auto next = nextStep(end);
+        if (isParked()) {
+            mParkedTime += next - mClock.now();
+        }
+        update(next);
+
+        while (mNextPedestrian.arrival <= mClock.now()) {
+            schedule(mNextPedestrian);
+            mNextPedestrian = mTraffic.next();
+        }
+
+        // Edges are handed to the looper right away with a zero delta, so
+        // the debounce starts at the edge even if the next step is far off.
+        if (applyEvents()) {
+            updateLooper(0);
+        }
+    }
+
+    mWallSeconds += std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - start)
+                        .count();
+}
+
+SimulationReport Simulator::getReport() const noexcept {
+    SimulationReport report{};
+
+    report.simulatedTime = mClock.now();
+    report.updates = mUpdates;
+    report.wakeups = mWakeups;
+    report.parkedTime = mParkedTime;
+    report.pedestrians = mPedestrians;
+    report.checkpoints = mCheckpoints;
+    report.darkCheckpoints = mDarkCheckpoints;
+
+    for (const auto &output : mOutputs) {
+        report.lightSwitchOns += output.getSwitchOns();
+        report.lightOnTime += output.getOnTime();
+    }
+
+    report.downMovingTime = mDownFilter.getCurrentMovingTime();
+    report.upMovingTime = mUpFilter.getCurrentMovingTime();
+    auto snapshot = mLooper.snapshot();
+    report.walks = snapshot.downWalks + snapshot.upWalks;
+    report.wallSeconds = mWallSeconds;
+
+    return report;
+}
+
+void Simulator::traceTo(hal::IStreamWriter &writer) noexcept {
+    mTraceDrain.emplace(mTrace, writer);
+    mLooper.setTrace(&mTrace);
+}
+
+void Simulator::profileWith(staircase::TickProfile &profile) noexcept {
+    mLooper.setProfile(&profile);
+}
+
+void Simulator::schedule(const Pedestrian &pedestrian) {
+    bool up = pedestrian.direction == staircase::IMoving::Direction::UP;
+    std::size_t first = up ? kDownSensor : kUpSensor;
+    std::size_t last = up ? kUpSensor : kDownSensor;
+    VirtualClock::Time arrival = pedestrian.arrival;
+    VirtualClock::Time walk = pedestrian.walkDuration;
+    VirtualClock::Time presence = mConfig.traffic.sensorPresence;
+
+    push(arrival, EventType::ENTER, first);
+    push(arrival + presence, EventType::LEAVE, first);
+    push(arrival + walk, EventType::ENTER, last);
+    push(arrival + walk + presence, EventType::LEAVE, last);
+
+    for (std::size_t step = 0; step < kLightsNum; ++step) {
+        std::size_t light = up ? step : kLightsNum - 1 - step;
+        push(arrival + walk * (2 * step + 1) / (2 * kLightsNum),
+             EventType::CHECKPOINT, light);
+    }
+
+    ++mPedestrians;
+}
+
+void Simulator::push(VirtualClock::Time time, EventType type,
+                     std::size_t target) {
+    mEvents.push(Event{time, mEventOrder++, type, target});
+}
+
+bool Simulator::applyEvents() noexcept {
+    bool edges = false;
+
+    while (!mEvents.empty() && mEvents.top().time <= mClock.now()) {
+        const Event &event = mEvents.top();
+
+        switch (event.type) {
+        case EventType::ENTER: {
+            auto before = mInputs[event.target].readValue();
+            mInputs[event.target].enter();
+            pushEdge(event.target, before);
+            edges = true;
+            break;
+        }
+        case EventType::LEAVE: {
+            auto before = mInputs[event.target].readValue();
+            mInputs[event.target].leave();
+            pushEdge(event.target, before);
+            edges = true;
+            break;
+        }
+        case EventType::CHECKPOINT:
+            ++mCheckpoints;
+            if (!mOutputs[event.target].isOn()) {
+                ++mDarkCheckpoints;
+            }
+            break;
+        }
+
+        mEvents.pop();
+    }
+
+    return edges;
+}
+
+void Simulator::pushEdge(std::size_t sensor,
+                         hal::BinaryValue before) noexcept {
+    // Pedestrians overlapping in front of a sensor do not change its level.
+    auto value = mInputs[sensor].readValue();
+    if (value != before) {
+        mEdges[sensor].push(hal::BinaryEdge{
+            value, static_cast<hal::Timestamp>(mClock.now())});
+    }
+}
+
+void Simulator::update(VirtualClock::Time time) noexcept {
+    auto delta = static_cast<hal::Milliseconds>(time - mClock.now());
+
+    mClock.advanceTo(time);
+    ++mWakeups;
+    updateLooper(delta);
+}
+
+void Simulator::updateLooper(hal::Milliseconds delta) noexcept {
+    mLooper.update(delta);
+    ++mUpdates;
+
+    if (mTraceDrain) {
+        mTraceDrain->drain();
+    }
+}
+
+bool Simulator::isParked() const noexcept {
+    return !mConfig.tickless && mConfig.parkWhenIdle && mLooper.isIdle();
+}
+
+VirtualClock::Time Simulator::nextStep(VirtualClock::Time end) const noexcept {
+    VirtualClock::Time now = mClock.now();
+
+    if (isParked()) {
+        return std::min(nextEvent(end), now + kMaxStep);
+    }
+
+    if (!mConfig.tickless) {
+        return std::min<VirtualClock::Time>(now + mConfig.tick, end);
+    }
+
+    VirtualClock::Time next = nextEvent(end);
+    hal::Milliseconds deadline = mLooper.nextDeadline();
+    if (deadline != hal::kForever) {
+        next = std::min<VirtualClock::Time>(
+            next, now + std::max<hal::Milliseconds>(deadline, 1));
+    }
+
+    return std::min(next, now + kMaxStep);
+}
+
+VirtualClock::Time
+Simulator::nextEvent(VirtualClock::Time end) const noexcept {
+    // Sensor edges but for the odd checkpoint of a pedestrian walking in
+    // the dark, which a parked device would sleep through.
+    VirtualClock::Time next = std::min(end, mNextPedestrian.arrival);
+    if (!mEvents.empty()) {
+        next = std::min(next, mEvents.top().time);
+    }
+
+    return next;
+}
@@ -0,0 +1,17 @@
+#include <sim/SteadyCycleCounter.hxx>
+
+#include <hal/ICycleCounter.hxx>
+
+#include <chrono>
+
+using namespace sim;
+
+std::uint32_t SteadyCycleCounter::cycles() const noexcept {
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<std::uint32_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+}
+
+std::uint32_t SteadyCycleCounter::frequency() const noexcept {
+    return 1000000000;
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include <sim/TraceDecoder.hxx>
+
+#include <staircase/TraceRing.hxx>
+
+#include <cstdio>
+
+using namespace sim;
+
+namespace {
+
+const char *eventName(staircase::TraceEvent event) noexcept {
+    switch (event) {
+    case staircase::TraceEvent::SENSOR_EDGE:
+        return "SENSOR_EDGE";
+    case staircase::TraceEvent::DEBOUNCE_ACCEPT:
+        return "DEBOUNCE_ACCEPT";
+    case staircase::TraceEvent::MOVING_CREATE:
+        return "MOVING_CREATE";
+    case staircase::TraceEvent::MOVING_FINISH:
+        return "MOVING_FINISH";
+    case staircase::TraceEvent::MOVING_EXPIRE:
+        return "MOVING_EXPIRE";
+    case staircase::TraceEvent::LIGHT_ON:
+        return "LIGHT_ON";
+    case staircase::TraceEvent::LIGHT_OFF:
+        return "LIGHT_OFF";
+    case staircase::TraceEvent::FILTER_UPDATE:
+        return "FILTER_UPDATE";
+    case staircase::TraceEvent::COMMAND:
+        return "COMMAND";
+    case staircase::TraceEvent::DROPPED:
+        return "DROPPED";
+    default:
+        return nullptr;
+    }
+}
+
+const char *commandName(std::uint16_t type) noexcept {
+    constexpr const char *kNames[] = {"FORCE_ON", "FORCE_OFF", "RESET_FILTER",
+                                      "INJECT_TRIGGER"};
+    return (type < std::size(kNames)) ? kNames[type] : "UNKNOWN";
+}
+
+const char *side(std::uint16_t subject) noexcept {
+    return (subject == staircase::kTraceUp) ? "up" : "down";
+}
+
+} // namespace
+
+std::vector<staircase::TraceRecord>
+sim::decodeTrace(std::span<const std::byte> dump) {
+    std::vector<staircase::TraceRecord> records;
+    records.reserve(dump.size() / staircase::kTraceRecordSize);
+
+    while (dump.size() >= staircase::kTraceRecordSize) {
+        records.push_back(staircase::decodeTraceRecord(
+            dump.first<staircase::kTraceRecordSize>()));
+        dump = dump.subspan(staircase::kTraceRecordSize);
+    }
+
+    return records;
+}
+
+std::string sim::formatTraceRecord(const staircase::TraceRecord &record) {
+    char details[64];
+    auto value = record.value;
+
+    switch (record.event) {
+    case staircase::TraceEvent::SENSOR_EDGE:
+        std::snprintf(details, sizeof(details), "%s sensor %s",
+                      side(record.subject), value ? "high" : "low");
+        break;
+    case staircase::TraceEvent::DEBOUNCE_ACCEPT:
+        std::snprintf(details, sizeof(details), "%s sensor %s",
+                      side(record.subject), value ? "close" : "far");
+        break;
+    case staircase::TraceEvent::MOVING_CREATE:
+        std::snprintf(details, sizeof(details), "%s, expected %d ms",
+                      side(record.subject), value);
+        break;
+    case staircase::TraceEvent::MOVING_FINISH:
+    case staircase::TraceEvent::MOVING_EXPIRE:
+        std::snprintf(details, sizeof(details), "%s, after %d ms",
+                      side(record.subject), value);
+        break;
+    case staircase::TraceEvent::LIGHT_ON:
+    case staircase::TraceEvent::LIGHT_OFF:
+        std::snprintf(details, sizeof(details), "light %u",
+                      static_cast<unsigned>(record.subject));
+        break;
+    case staircase::TraceEvent::FILTER_UPDATE:
+        std::snprintf(details, sizeof(details), "%s, %d ms",
+                      side(record.subject), value);
+        break;
+    case staircase::TraceEvent::COMMAND:
+        std::snprintf(details, sizeof(details), "%s %d",
+                      commandName(record.subject), value);
+        break;
+    case staircase::TraceEvent::DROPPED:
+        std::snprintf(details, sizeof(details), "%d records lost", value);
+        break;
+    default:
+        std::snprintf(details, sizeof(details), "subject %u, value %d",
+                      static_cast<unsigned>(record.subject), value);
+        break;
+    }
+
+    auto name = eventName(record.event);
+    char line[128];
+    if (name) {
+        std::snprintf(line, sizeof(line), "%11.3f s  %-16s %s",
+                      record.time / 1000.0, name, details);
+    } else {
+        std::snprintf(line, sizeof(line), "%11.3f s  EVENT_%-10u %s",
+                      record.time / 1000.0,
+                      static_cast<unsigned>(record.event), details);
+    }
+
+    return line;
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+#include <sim/TraceDecoder.hxx>
+
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+// Prints a TraceRunnable dump, read from a file or stdin, as a timeline.
+int main(int argc, char **argv) {
+    if (argc > 2) {
+        std::printf("usage: %s [DUMP]\n", argv[0]);
+        return 1;
+    }
+
+    std::FILE *input = (argc == 2) ? std::fopen(argv[1], "rb") : stdin;
+    if (!input) {
+        std::perror(argv[1]);
+        return 1;
+    }
+
+    std::vector<std::byte> dump;
+    std::byte buffer[4096];
+    std::size_t read;
+    while ((read = std::fread(buffer, 1, sizeof(buffer), input)) > 0) {
+        dump.insert(dump.end(), buffer, buffer + read);
+    }
+
+    if (input != stdin) {
+        std::fclose(input);
+    }
+
+    for (const auto &record : sim::decodeTrace(dump)) {
+        std::printf("%s\n", sim::formatTraceRecord(record).c_str());
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,215 @@
+#include <hal/Executor.hxx>
+
+#include <hal/ITask.hxx>
+#include <hal/Timing.hxx>
+
+#include <staircase/IRunnable.hxx>
+
+using namespace hal;
+
+Executor::Task::Task(Executor &executor, staircase::IRunnable &runnable,
+                     Milliseconds period, Priority priority) noexcept
+    : ITask{runnable, period}, mExecutor{executor}, mRunnable{runnable},
+      mPriority{priority}, mExpiry{0}, mLastRun{0}, mDelta{0}, mArmed{false},
+      mDue{true}, mTimed{false}, mWoken{false}, mNext{nullptr} {}
+
+void Executor::Task::wake() noexcept {
+    mWoken.store(true);
+    mExecutor.wake();
+}
+
+Executor::Executor() noexcept
+    : mTasksNum{0}, mWheel{}, mCursor{0}, mStarted{false}, mRunning{true} {}
+
+ITask *Executor::add(staircase::IRunnable &runnable, Milliseconds period,
+                     Priority priority) noexcept {
+    if (mTasksNum == kMaxTasks) {
+        return nullptr;
+    }
+
+    return &mTasks[mTasksNum++].emplace(*this, runnable, period, priority);
+}
+
+void Executor::loop() noexcept {
+    while (mRunning.load()) {
+        if (!runOnce() && mRunning.load()) {
+            auto timeout = nextTimeout(now());
+            if (timeout == kForever && isIdle()) {
+                parkTasks();
+            } else {
+                sleepFor(timeout);
+            }
+        }
+    }
+}
+
+bool Executor::runOnce() noexcept {
+    auto start = now();
+    advance(start);
+
+    auto *task = highestDue();
+    if (!task) {
+        return false;
+    }
+
+    run(*task, start);
+    return true;
+}
+
+void Executor::stop() noexcept {
+    mRunning.store(false);
+    wake();
+}
+
+void Executor::advance(Timestamp time) noexcept {
+    if (!mStarted) {
+        mStarted = true;
+        mCursor = time;
+        for (std::size_t index = 0; index < mTasksNum; ++index) {
+            mTasks[index]->mLastRun = time;
+        }
+    }
+
+    // Every slot once at most, however long the sleep was.
+    auto passed = elapsed(mCursor, time);
+    auto slots = (passed <= 0) ? std::size_t{0}
+                 : (static_cast<std::size_t>(passed) < kWheelSize)
+                     ? static_cast<std::size_t>(passed)
+                     : kWheelSize;
+    for (std::size_t step = 1; step <= slots; ++step) {
+        auto **link = &mWheel[slotOf(mCursor + step)];
+        while (*link) {
+            auto &task = **link;
+            if (elapsed(task.mExpiry, time) >= 0) {
+                *link = task.mNext;
+                task.mNext = nullptr;
+                task.mArmed = false;
+                task.mDue = true;
+                task.mTimed = true;
+            } else {
+                link = &task.mNext;
+            }
+        }
+    }
+    mCursor = time;
+
+    for (std::size_t index = 0; index < mTasksNum; ++index) {
+        auto &task = *mTasks[index];
+        if (task.mWoken.exchange(false)) {
+            unlink(task);
+            task.mDue = true;
+            task.mTimed = false;
+        }
+    }
+}
+
+Executor::Task *Executor::highestDue() noexcept {
+    Task *highest = nullptr;
+    for (std::size_t index = 0; index < mTasksNum; ++index) {
+        auto &task = *mTasks[index];
+        if (task.mDue && (!highest || task.mPriority < highest->mPriority)) {
+            highest = &task;
+        }
+    }
+
+    return highest;
+}
+
+bool Executor::isIdle() const noexcept {
+    for (std::size_t index = 0; index < mTasksNum; ++index) {
+        if (!mTasks[index]->mRunnable.isIdle()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void Executor::parkTasks() noexcept {
+    for (std::size_t index = 0; index < mTasksNum; ++index) {
+        mTasks[index]->recordPark();
+    }
+    park();
+}
+
+void Executor::run(Task &task, Timestamp start) noexcept {
+    // A timer which expired while the thread was busy starts late; a wake()
+    // or the first run has no release time to be late for.
+    auto late = task.mTimed ? elapsed(task.mExpiry, start) : 0;
+    task.recordRelease(late);
+
+    task.mDue = false;
+    task.mDelta = elapsed(task.mLastRun, start);
+    task.mLastRun = start;
+    task.mRunnable.run();
+    task.recordRun();
+
+    auto deadline = task.mRunnable.nextDeadline();
+    if (deadline == kForever) {
+        return;
+    }
+
+    // Periodic runnables stay on their grid as long as they keep up.
+    auto base =
+        (task.mTimed && late < task.getPeriod()) ? task.mExpiry : start;
+    arm(task, base + static_cast<Timestamp>(deadline));
+}
+
+void Executor::arm(Task &task, Timestamp expiry) noexcept {
+    task.mExpiry = expiry;
+    if (elapsed(mCursor, expiry) <= 0) {
+        task.mDue = true;
+        task.mTimed = true;
+        return;
+    }
+
+    auto &head = mWheel[slotOf(expiry)];
+    task.mNext = head;
+    head = &task;
+    task.mArmed = true;
+}
+
+void Executor::unlink(Task &task) noexcept {
+    if (!task.mArmed) {
+        return;
+    }
+
+    auto **link = &mWheel[slotOf(task.mExpiry)];
+    while (*link != &task) {
+        link = &(*link)->mNext;
+    }
+    *link = task.mNext;
+    task.mNext = nullptr;
+    task.mArmed = false;
+}
+
+Milliseconds Executor::nextTimeout(Timestamp time) const noexcept {
+    for (std::size_t index = 0; index < mTasksNum; ++index) {
+        if (mTasks[index]->mDue) {
+            return 0;
+        }
+    }
+
+    // Slots in time order hold the timers of the coming rotation first.
+    for (std::size_t step = 1; step <= kWheelSize; ++step) {
+        auto slotTime = mCursor + static_cast<Timestamp>(step);
+        for (auto *task = mWheel[slotOf(slotTime)]; task;
+             task = task->mNext) {
+            if (task->mExpiry == slotTime) {
+                auto left = elapsed(time, slotTime);
+                return (left > 0) ? left : 0;
+            }
+        }
+    }
+
+    // Nothing in the next rotation, look for the earliest further away.
+    auto timeout = kForever;
+    for (std::size_t index = 0; index < mTasksNum; ++index) {
+        const auto &task = *mTasks[index];
+        if (task.mArmed) {
+            timeout = earliestDeadline(timeout, elapsed(time, task.mExpiry));
+        }
+    }
+
+    return timeout;
+}
\ No newline at end of file
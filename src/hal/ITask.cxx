@@ -5,14 +5,194 @@
 
 using namespace hal;
 
+namespace {
+
+void bump(std::atomic<std::uint32_t> &counter, std::uint32_t by) noexcept {
+    counter.store(counter.load(std::memory_order_relaxed) + by,
+                  std::memory_order_relaxed);
+}
+
+} // namespace
+
 ITask::ITask(staircase::IRunnable &runnable, hal::Milliseconds period)
-    : mPeriod{period}, mRunnable{runnable}, mRunning{true} {
+    : mPeriod{period}, mRunnable{runnable}, mRunning{true},
+      mDeadlineMode{false}, mPolicy{OverrunPolicy::COALESCE},
+      mHasRelease{false}, mRelease{0}, mAccounted{0}, mDelta{0}, mRuns{0},
+      mOverruns{0}, mMissedPeriods{0}, mMaxLateness{0}, mParks{0} {
     mRunnable.setParentTask(this);
 }
 
+Milliseconds ITask::getPeriod() const noexcept { return mPeriod; }
+
+Milliseconds ITask::delta() const noexcept {
+    return mDeadlineMode ? mDelta : getDelta();
+}
+
 void ITask::loop() noexcept {
+    if (mDeadlineMode) {
+        loopDeadlines();
+    } else {
+        loopRelative();
+    }
+}
+
+void ITask::stop() noexcept {
+    mRunning.store(false);
+    wake();
+}
+
+bool ITask::isRunning() const noexcept { return mRunning.load(); }
+
+void ITask::setDeadlineMode(OverrunPolicy policy) noexcept {
+    mDeadlineMode = true;
+    mPolicy = policy;
+}
+
+ITask::Stats ITask::getStats() const noexcept {
+    return {mRuns.load(std::memory_order_relaxed),
+            mOverruns.load(std::memory_order_relaxed),
+            mMissedPeriods.load(std::memory_order_relaxed),
+            mMaxLateness.load(std::memory_order_relaxed),
+            mParks.load(std::memory_order_relaxed)};
+}
+
+void ITask::sleepFor(Milliseconds) noexcept { sleep(); }
+
+void ITask::sleepUntil(Timestamp deadline) noexcept {
+    auto left = elapsed(now(), deadline);
+    if (left > 0) {
+        sleepFor(left);
+    }
+}
+
+void ITask::park() noexcept { sleepFor(kForever); }
+
+std::uint32_t ITask::recordRelease(Milliseconds late) noexcept {
+    // Without a period there is no grid to miss releases of.
+    auto missed =
+        (mPeriod > 0) ? static_cast<std::uint32_t>(late / mPeriod) : 0u;
+    if (late > mMaxLateness.load(std::memory_order_relaxed)) {
+        mMaxLateness.store(late, std::memory_order_relaxed);
+    }
+    if (missed > 0) {
+        bump(mOverruns, 1);
+        bump(mMissedPeriods, missed);
+    }
+
+    return missed;
+}
+
+void ITask::recordRun() noexcept { bump(mRuns, 1); }
+
+void ITask::recordPark() noexcept { bump(mParks, 1); }
+
+void ITask::loopRelative() noexcept {
     while (mRunning.load()) {
         mRunnable.run();
-        sleep();
+        recordRun();
+        if (mRunning.load() && !parkIfIdle()) {
+            sleepFor(mRunnable.nextDeadline());
+        }
+    }
+}
+
+void ITask::loopDeadlines() noexcept {
+    mHasRelease = false;
+    mAccounted = now();
+
+    while (mRunning.load()) {
+        release(now());
+        if (mRunning.load()) {
+            schedule();
+        }
+    }
+}
+
+void ITask::release(Timestamp start) noexcept {
+    auto late = mHasRelease ? elapsed(mRelease, start) : -1;
+    if (late < 0) {
+        // First run, woken before the release or after an open ended sleep:
+        // the grid starts over from here.
+        mRelease = start;
+        late = 0;
+    }
+
+    auto missed = recordRelease(late);
+    // Later releases stay on the grid, past the ones which were missed.
+    // Without a period there is no grid and the next deadline counts from
+    // this run.
+    if (mPeriod > 0) {
+        mRelease += missed * static_cast<Timestamp>(mPeriod);
+    } else {
+        mRelease = start;
+    }
+
+    auto total = elapsed(mAccounted, start);
+    mAccounted = start;
+
+    switch (mPolicy) {
+    case OverrunPolicy::REPLAY: {
+        auto replays = (missed < kMaxReplays) ? missed : kMaxReplays;
+        for (std::uint32_t replay = 0; replay < replays && mRunning.load();
+             ++replay) {
+            runWith(mPeriod);
+            total -= mPeriod;
+        }
+        if (mRunning.load()) {
+            runWith(total);
+        }
+        break;
     }
+    case OverrunPolicy::SKIP:
+        runWith(total - static_cast<Milliseconds>(missed) * mPeriod);
+        break;
+    case OverrunPolicy::COALESCE:
+    default:
+        runWith(total);
+        break;
+    }
+}
+
+void ITask::runWith(Milliseconds delta) noexcept {
+    mDelta = delta;
+    mRunnable.run();
+    recordRun();
+}
+
+void ITask::schedule() noexcept {
+    // Open ended waits leave no release for the grid to go on from.
+    if (parkIfIdle()) {
+        mHasRelease = false;
+        return;
+    }
+
+    auto deadline = mRunnable.nextDeadline();
+    if (deadline == kForever) {
+        mHasRelease = false;
+        sleepFor(kForever);
+        return;
+    }
+
+    // The next release is the first grid point at least the deadline after
+    // the current one, so a slow run shows up as lateness instead of
+    // silently shifting the grid. Without a period it is the deadline.
+    if (mPeriod > 0) {
+        auto periods = (deadline + mPeriod - 1) / mPeriod;
+        mRelease += static_cast<Timestamp>((periods > 0) ? periods : 1) *
+                    static_cast<Timestamp>(mPeriod);
+    } else {
+        mRelease += static_cast<Timestamp>(deadline);
+    }
+    mHasRelease = true;
+    sleepUntil(mRelease);
+}
+
+bool ITask::parkIfIdle() noexcept {
+    if (!mRunnable.isIdle()) {
+        return false;
+    }
+
+    recordPark();
+    park();
+    return true;
 }
\ No newline at end of file
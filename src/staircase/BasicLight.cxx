@@ -1,70 +1,27 @@
 #include <staircase/BasicLight.hxx>
 
-#include <hal/BinaryValue.hxx>
 #include <hal/IBinaryValueWriter.hxx>
 #include <hal/Timing.hxx>
 
-#include <staircase/IBasicLight.hxx>
-
-#include <algorithm>
-
 using namespace staircase;
 
 BasicLight::BasicLight(hal::IBinaryValueWriter &binaryValueWriter) noexcept
-    : mBinaryValueWriter{binaryValueWriter}, mState{LightState::OFF},
-      mTimeLeft{hal::kForever} {
-    writeState();
-}
+    : mLight{binaryValueWriter} {}
 
 void BasicLight::turnOn(hal::Milliseconds millis) noexcept {
-    setState(LightState::ON, millis);
+    mLight.turnOn(millis);
 }
 
-void BasicLight::turnOff() noexcept {
-    setState(LightState::OFF, hal::kForever);
-}
+void BasicLight::turnOff() noexcept { mLight.turnOff(); }
 
 void BasicLight::update(hal::Milliseconds delta) noexcept {
-    if (mTimeLeft < 0) {
-        return;
-    }
-
-    if (delta >= mTimeLeft) {
-        setState(LightState::OFF, hal::kForever);
-    } else {
-        mTimeLeft -= delta;
-    }
-}
-
-bool BasicLight::isOn() const noexcept { return mState == LightState::ON; }
-
-bool BasicLight::isOff() const noexcept { return mState == LightState::OFF; }
-
-void BasicLight::setState(LightState state, hal::Milliseconds millis) noexcept {
-    if (mState != state) {
-        mState = state;
-        writeState();
-    }
-
-    if (millis == hal::kForever) {
-        mTimeLeft = millis;
-    } else {
-        mTimeLeft = std::max(mTimeLeft, millis);
-    }
+    mLight.update(delta);
 }
 
-void BasicLight::writeState() noexcept {
-    auto binaryValue = hal::BinaryValue::LOW;
+bool BasicLight::isOn() const noexcept { return mLight.isOn(); }
 
-    switch (mState) {
-    case LightState::ON:
-        binaryValue = hal::BinaryValue::HIGH;
-        break;
-    case LightState::OFF:
-    default:
-        binaryValue = hal::BinaryValue::LOW;
-        break;
-    }
+bool BasicLight::isOff() const noexcept { return mLight.isOff(); }
 
-    mBinaryValueWriter.writeValue(binaryValue);
+hal::Milliseconds BasicLight::nextDeadline() const noexcept {
+    return mLight.nextDeadline();
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <hal/Timing.hxx>
 
 #include <staircase/IBasicLight.hxx>
+#include <staircase/StaticClippedSquaredMovingDurationCalculator.hxx>
 
 #include <cstdint>
 
@@ -10,15 +11,9 @@ using namespace staircase;
 
 hal::Milliseconds ClippedSquaredMovingDurationCalculator::calculateDelta(
     std::size_t lightIndex, hal::Milliseconds totalDuration) const noexcept {
+    constexpr StaticClippedSquaredMovingDurationCalculator<
+        IBasicLight::kLightsNum>
+        kCalculator{};
 
-    switch (lightIndex) {
-    case 0:
-        return kFirstLightDelta;
-    case 1:
-        return kSecondLightDelta;
-    case 2:
-        return kThirdLightDelta;
-    default:
-        return totalDuration / (IBasicLight::kLightsNum + 1);
-    }
+    return kCalculator.calculateDelta(lightIndex, totalDuration);
 }
\ No newline at end of file
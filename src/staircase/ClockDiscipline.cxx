@@ -0,0 +1,105 @@
+#include <staircase/ClockDiscipline.hxx>
+
+#include <hal/INTP.hxx>
+#include <hal/Timing.hxx>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+
+using namespace staircase;
+
+ClockDiscipline::ClockDiscipline() noexcept
+    : mSynchronised{false}, mDriftPpm{0}, mPollInterval{kMinPollInterval},
+      mAgreeing{0}, mSinceSample{0}, mStep{0}, mPending{0}, mResidue{0} {}
+
+void ClockDiscipline::addSample(const hal::INTP::Sample &sample) noexcept {
+    if (!mSynchronised || std::abs(sample.offset) > kStepThreshold) {
+        step(sample.offset);
+        return;
+    }
+
+    // Had the drift been known exactly, the offset would be what is left to
+    // slew of the previous one; the rest is the frequency error.
+    auto offset = sample.offset * kNanosPerMilli;
+    auto error = offset - (mPending + mResidue);
+    if (mSinceSample >= kMinFrequencyInterval) {
+        // Nanoseconds per millisecond are parts per million.
+        auto drift = mDriftPpm + error / mSinceSample / kFrequencyGain;
+        mDriftPpm = static_cast<std::int32_t>(
+            std::clamp<std::int64_t>(drift, -kMaxDriftPpm, kMaxDriftPpm));
+    }
+
+    adaptPollInterval(error, std::max(sample.delay / 2, kMinTolerance));
+    mPending = offset - mResidue;
+    mSinceSample = 0;
+}
+
+hal::Milliseconds ClockDiscipline::update(hal::Milliseconds delta) noexcept {
+    if (!mSynchronised) {
+        return 0;
+    }
+
+    mSinceSample += delta;
+
+    auto limit = std::int64_t{kMaxSlewPpm} * delta;
+    auto slew = std::clamp(mPending, -limit, limit);
+    mPending -= slew;
+    mResidue += std::int64_t{mDriftPpm} * delta + slew;
+
+    auto millis = mResidue / kNanosPerMilli;
+    mResidue -= millis * kNanosPerMilli;
+    return static_cast<hal::Milliseconds>(millis) + std::exchange(mStep, 0);
+}
+
+hal::Milliseconds ClockDiscipline::nextDeadline() const noexcept {
+    if (mStep != 0) {
+        return 0;
+    }
+
+    auto speed = rate();
+    if (speed == 0) {
+        return hal::kForever;
+    }
+
+    auto missing = kNanosPerMilli - ((speed > 0) ? mResidue : -mResidue);
+    speed = std::abs(speed);
+    return static_cast<hal::Milliseconds>((missing + speed - 1) / speed);
+}
+
+void ClockDiscipline::step(hal::Milliseconds offset) noexcept {
+    mSynchronised = true;
+    mStep += offset;
+    mPending = 0;
+    mResidue = 0;
+    mSinceSample = 0;
+    mAgreeing = 0;
+    mPollInterval = kMinPollInterval;
+}
+
+void ClockDiscipline::adaptPollInterval(std::int64_t error,
+                                        hal::Milliseconds tolerance) noexcept {
+    if (std::abs(error) > tolerance * kNanosPerMilli) {
+        mAgreeing = 0;
+        mPollInterval = std::max(mPollInterval / 2, kMinPollInterval);
+        return;
+    }
+
+    if (++mAgreeing >= kAgreeingSamples) {
+        mAgreeing = 0;
+        mPollInterval = std::min(mPollInterval * 2, kMaxPollInterval);
+    }
+}
+
+std::int64_t ClockDiscipline::rate() const noexcept {
+    if (!mSynchronised) {
+        return 0;
+    }
+
+    // Correction per millisecond in nanoseconds, slewing at full speed.
+    std::int64_t slew = (mPending > 0)   ? kMaxSlewPpm
+                        : (mPending < 0) ? -kMaxSlewPpm
+                                         : 0;
+    return mDriftPpm + slew;
+}
\ No newline at end of file
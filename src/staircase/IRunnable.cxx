@@ -6,4 +6,10 @@ using namespace staircase;
 
 IRunnable::IRunnable() : mTask{nullptr} {}
 
+hal::Milliseconds IRunnable::nextDeadline() const noexcept {
+    return mTask ? mTask->getPeriod() : hal::kForever;
+}
+
+bool IRunnable::isIdle() const noexcept { return false; }
+
 void IRunnable::setParentTask(hal::ITask *task) noexcept { mTask = task; }
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include <staircase/LightPort.hxx>
+
+#include <hal/BinaryValue.hxx>
+#include <hal/IBinaryPortWriter.hxx>
+
+#include <staircase/IBasicLight.hxx>
+
+#include <algorithm>
+#include <utility>
+
+using namespace staircase;
+
+LightPort::Pin::Pin(LightPort &port, std::size_t index) noexcept
+    : mPort{port}, mIndex{index} {}
+
+void LightPort::Pin::writeValue(hal::BinaryValue value) noexcept {
+    mPort.set(mIndex, value == hal::BinaryValue::HIGH);
+}
+
+LightPort::LightPort(hal::IBinaryPortWriter &portWriter) noexcept
+    : mPortWriter{portWriter},
+      mPins{makePins(std::make_index_sequence<IBasicLight::kLightsNum>{})},
+      mState{}, mWritten{} {
+    mPortWriter.writePort(mWritten);
+}
+
+void LightPort::flush() noexcept {
+    if (!isDirty()) {
+        return;
+    }
+
+    mWritten = mState;
+    mPortWriter.writePort(mWritten);
+}
+
+LightPort::Pin &LightPort::getPin(std::size_t index) noexcept {
+    return mPins[index];
+}
+
+void LightPort::set(std::size_t index, bool on) noexcept {
+    Word bit = Word{1} << (index % kWordBits);
+
+    if (on) {
+        mState[index / kWordBits] |= bit;
+    } else {
+        mState[index / kWordBits] &= ~bit;
+    }
+}
+
+bool LightPort::isSet(std::size_t index) const noexcept {
+    return (mState[index / kWordBits] >> (index % kWordBits)) & 1;
+}
+
+bool LightPort::isDirty() const noexcept { return mState != mWritten; }
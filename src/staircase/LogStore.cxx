@@ -0,0 +1,355 @@
+#include <staircase/LogStore.hxx>
+
+#include <hal/IPersistence.hxx>
+#include <hal/IStorage.hxx>
+
+#include <util/Crc32.hxx>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace staircase;
+
+namespace {
+
+constexpr std::uint32_t kMagic = 0x534C4F47;
+
+constexpr std::size_t alignUp(std::size_t size) noexcept {
+    return (size + 3) & ~std::size_t{3};
+}
+
+void put16(std::byte *out, std::uint16_t value) noexcept {
+    out[0] = static_cast<std::byte>(value);
+    out[1] = static_cast<std::byte>(value >> 8);
+}
+
+void put32(std::byte *out, std::uint32_t value) noexcept {
+    put16(out, static_cast<std::uint16_t>(value));
+    put16(out + 2, static_cast<std::uint16_t>(value >> 16));
+}
+
+std::uint16_t get16(const std::byte *in) noexcept {
+    return static_cast<std::uint16_t>(static_cast<std::uint16_t>(in[0]) |
+                                      (static_cast<std::uint16_t>(in[1]) << 8));
+}
+
+std::uint32_t get32(const std::byte *in) noexcept {
+    return get16(in) | (static_cast<std::uint32_t>(get16(in + 2)) << 16);
+}
+
+// Record checksum: the length and count fields, then the entries.
+std::uint32_t recordCrc(std::span<const std::byte> record) noexcept {
+    return util::crc32(record.subspan(8), util::crc32(record.first(4)));
+}
+
+} // namespace
+
+LogStore::LogStore(hal::IStorage &storage) noexcept
+    : mStorage{storage}, mBankSize{0}, mActiveBank{0}, mGeneration{0},
+      mWriteOffset{0}, mSlots{}, mKeysNum{0} {}
+
+bool LogStore::mount() noexcept {
+    mKeysNum = 0;
+    mBankSize = 0;
+
+    auto sectorSize = mStorage.sectorSize();
+    if (sectorSize == 0) {
+        return false;
+    }
+
+    auto bankSize = mStorage.size() / 2 / sectorSize * sectorSize;
+    if (bankSize < kBankHeaderSize + 2 * kMaxRecordSize) {
+        return false;
+    }
+    mBankSize = bankSize;
+
+    auto first = readBankHeader(0);
+    auto second = readBankHeader(1);
+    if (!first && !second) {
+        // Compacting the empty index into bank 0 formats it.
+        mActiveBank = 1;
+        mGeneration = 0;
+        return compact();
+    }
+
+    if (first &&
+        (!second || static_cast<std::int32_t>(*first - *second) > 0)) {
+        mActiveBank = 0;
+        mGeneration = *first;
+    } else {
+        mActiveBank = 1;
+        mGeneration = *second;
+    }
+
+    // A torn tail cannot be overwritten in place, so start a clean bank.
+    return replay() || compact();
+}
+
+bool LogStore::keyExists(std::string_view key) const noexcept {
+    return indexOf(key) < mKeysNum;
+}
+
+std::int32_t LogStore::getValue(std::string_view key) const noexcept {
+    return tryGet(key).value_or(0);
+}
+
+void LogStore::setValue(std::string_view key, std::int32_t value) noexcept {
+    Entry entry{key, value, true};
+    setValues({&entry, 1});
+}
+
+std::optional<std::int32_t>
+LogStore::tryGet(std::string_view key) const noexcept {
+    auto index = indexOf(key);
+    if (index == mKeysNum) {
+        return std::nullopt;
+    }
+
+    return mSlots[index].value;
+}
+
+void LogStore::getValues(std::span<Entry> entries) const noexcept {
+    for (auto &entry : entries) {
+        auto index = indexOf(entry.key);
+        entry.found = index < mKeysNum;
+        entry.value = entry.found ? mSlots[index].value : 0;
+    }
+}
+
+void LogStore::setValues(std::span<const Entry> entries) noexcept {
+    Record record;
+    std::size_t size = kRecordHeaderSize;
+    std::size_t count = 0;
+    std::size_t newKeys = 0;
+
+    for (const auto &entry : entries) {
+        if (entry.key.empty() || entry.key.size() > kMaxKeyLength ||
+            size + kEntrySize > record.size()) {
+            continue;
+        }
+
+        auto index = indexOf(entry.key);
+        if (index < mKeysNum && mSlots[index].value == entry.value) {
+            continue;
+        }
+
+        if (index == mKeysNum) {
+            if (mKeysNum + newKeys >= kMaxKeys) {
+                continue;
+            }
+            ++newKeys;
+        }
+
+        size += encode(&record[size], entry.key, entry.value);
+        ++count;
+    }
+
+    if (count == 0) {
+        return;
+    }
+
+    auto encoded = seal(record, size, count);
+    if (append(encoded)) {
+        apply(encoded);
+    }
+}
+
+void LogStore::maintain() noexcept {
+    if (mBankSize != 0 && mWriteOffset > mBankSize / 4 * 3) {
+        compact();
+    }
+}
+
+bool LogStore::compact() noexcept {
+    if (mBankSize == 0) {
+        return false;
+    }
+
+    auto target = 1 - mActiveBank;
+    auto offset = bankOffset(target);
+    if (!mStorage.erase(offset, mBankSize)) {
+        return false;
+    }
+
+    Record record;
+    std::size_t size = kRecordHeaderSize;
+    for (std::size_t index = 0; index < mKeysNum; ++index) {
+        size += encode(&record[size], mSlots[index].name(),
+                       mSlots[index].value);
+    }
+
+    std::size_t used = kBankHeaderSize;
+    if (mKeysNum > 0) {
+        auto encoded = seal(record, size, mKeysNum);
+        if (!mStorage.write(offset + used, encoded)) {
+            return false;
+        }
+        used += alignUp(encoded.size());
+    }
+
+    // The header goes last and only once the values are durable, so the
+    // bank never becomes active half written.
+    std::array<std::byte, kBankHeaderSize> header;
+    put32(&header[0], kMagic);
+    put32(&header[4], mGeneration + 1);
+    put32(&header[8], 0);
+    put32(&header[12], util::crc32(std::span{header}.first(12)));
+    if (!mStorage.sync() || !mStorage.write(offset, header) ||
+        !mStorage.sync()) {
+        return false;
+    }
+
+    mActiveBank = target;
+    ++mGeneration;
+    mWriteOffset = used;
+    return true;
+}
+
+std::size_t LogStore::indexOf(std::string_view key) const noexcept {
+    auto hash = util::crc32(key);
+    for (std::size_t index = 0; index < mKeysNum; ++index) {
+        if (mSlots[index].hash == hash && mSlots[index].name() == key) {
+            return index;
+        }
+    }
+
+    return mKeysNum;
+}
+
+std::size_t LogStore::encode(std::byte *out, std::string_view key,
+                             std::int32_t value) noexcept {
+    out[0] = static_cast<std::byte>(key.size());
+    std::memcpy(out + 1, key.data(), key.size());
+    put32(out + 1 + key.size(), static_cast<std::uint32_t>(value));
+
+    return 1 + key.size() + 4;
+}
+
+std::span<const std::byte> LogStore::seal(Record &record, std::size_t size,
+                                          std::size_t count) noexcept {
+    put16(&record[0], static_cast<std::uint16_t>(size));
+    put16(&record[2], static_cast<std::uint16_t>(count));
+    std::span<const std::byte> encoded{record.data(), size};
+    put32(&record[4], recordCrc(encoded));
+
+    return encoded;
+}
+
+bool LogStore::apply(std::span<const std::byte> record) noexcept {
+    auto count = get16(&record[2]);
+    std::size_t position = kRecordHeaderSize;
+
+    for (std::size_t entry = 0; entry < count; ++entry) {
+        if (position >= record.size()) {
+            return false;
+        }
+
+        std::size_t keyLength = static_cast<std::uint8_t>(record[position]);
+        if (keyLength == 0 || keyLength > kMaxKeyLength ||
+            position + 1 + keyLength + 4 > record.size()) {
+            return false;
+        }
+
+        std::string_view key{
+            reinterpret_cast<const char *>(&record[position + 1]), keyLength};
+        auto value =
+            static_cast<std::int32_t>(get32(&record[position + 1 + keyLength]));
+        position += 1 + keyLength + 4;
+
+        auto index = indexOf(key);
+        if (index < mKeysNum) {
+            mSlots[index].value = value;
+        } else if (mKeysNum < kMaxKeys) {
+            auto &added = mSlots[mKeysNum++];
+            added.hash = util::crc32(key);
+            added.keyLength = static_cast<std::uint8_t>(keyLength);
+            std::copy(key.begin(), key.end(), added.key.begin());
+            added.value = value;
+        }
+    }
+
+    return true;
+}
+
+std::size_t LogStore::bankOffset(std::size_t bank) const noexcept {
+    return bank * mBankSize;
+}
+
+std::optional<std::uint32_t>
+LogStore::readBankHeader(std::size_t bank) const noexcept {
+    std::array<std::byte, kBankHeaderSize> header;
+    if (!mStorage.read(bankOffset(bank), header) ||
+        get32(&header[0]) != kMagic ||
+        get32(&header[12]) != util::crc32(std::span{header}.first(12))) {
+        return std::nullopt;
+    }
+
+    return get32(&header[4]);
+}
+
+bool LogStore::replay() noexcept {
+    auto base = bankOffset(mActiveBank);
+    std::size_t offset = kBankHeaderSize;
+    Record record;
+
+    while (offset + kRecordHeaderSize <= mBankSize) {
+        std::span header{record.data(), kRecordHeaderSize};
+        if (!mStorage.read(base + offset, header)) {
+            break;
+        }
+
+        if (std::all_of(header.begin(), header.end(), [](std::byte byte) {
+                return byte == hal::IStorage::kErased;
+            })) {
+            mWriteOffset = offset;
+            return true;
+        }
+
+        std::size_t length = get16(&record[0]);
+        if (length < kRecordHeaderSize || length > record.size() ||
+            offset + length > mBankSize) {
+            break;
+        }
+
+        std::span<const std::byte> encoded{record.data(), length};
+        if (!mStorage.read(base + offset + kRecordHeaderSize,
+                           {record.data() + kRecordHeaderSize,
+                            length - kRecordHeaderSize}) ||
+            get32(&record[4]) != recordCrc(encoded) || !apply(encoded)) {
+            break;
+        }
+
+        offset += alignUp(length);
+    }
+
+    if (offset + kRecordHeaderSize > mBankSize) {
+        // Full to the last byte, nothing is torn.
+        mWriteOffset = mBankSize;
+        return true;
+    }
+
+    mWriteOffset = mBankSize;
+    return false;
+}
+
+bool LogStore::append(std::span<const std::byte> record) noexcept {
+    if (mBankSize == 0) {
+        return false;
+    }
+
+    auto length = alignUp(record.size());
+    if (mWriteOffset + length > mBankSize &&
+        (!compact() || mWriteOffset + length > mBankSize)) {
+        return false;
+    }
+
+    if (!mStorage.write(bankOffset(mActiveBank) + mWriteOffset, record) ||
+        !mStorage.sync()) {
+        // The bytes may be half programmed, move on to a fresh bank.
+        mWriteOffset = mBankSize;
+        return false;
+    }
+
+    mWriteOffset += length;
+    return true;
+}
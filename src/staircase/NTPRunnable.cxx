@@ -2,15 +2,58 @@
 
 #include <hal/INTP.hxx>
 #include <hal/IRTC.hxx>
+#include <hal/ITask.hxx>
 #include <hal/Timing.hxx>
 
+#include <staircase/ClockDiscipline.hxx>
+
+#include <algorithm>
+
 using namespace staircase;
 
 NTPRunnable::NTPRunnable(hal::IRTC &rtc, hal::INTP &ntp)
-    : mRtc{rtc}, mNtp{ntp} {}
+    : mRtc{rtc}, mNtp{ntp}, mDiscipline{}, mUntilPoll{0} {}
+
+hal::Milliseconds NTPRunnable::nextDeadline() const noexcept {
+    auto deadline =
+        hal::earliestDeadline(mNtp.nextDeadline(), mDiscipline.nextDeadline());
+    return hal::earliestDeadline(deadline, mUntilPoll);
+}
 
 void NTPRunnable::run() noexcept {
-    hal::Milliseconds ntpTime = mNtp.obtainCurrentTimeOfDay();
-    hal::Milliseconds rtcTime = mRtc.getCurrentTimeOfDay();
-    mRtc.adjustCurrentTime(ntpTime - rtcTime);
+    hal::Milliseconds delta = kUpdateInterval;
+    if (mTask) {
+        delta = mTask->delta();
+    }
+
+    if (mUntilPoll != hal::kForever) {
+        mUntilPoll = std::max(mUntilPoll - delta, 0);
+    }
+
+    // The time passed is corrected as of the samples so far; a step the new
+    // sample asks for is taken at once.
+    auto correction = mDiscipline.update(delta);
+    mNtp.update(delta);
+    correction += mDiscipline.update(0);
+    if (correction != 0) {
+        mRtc.adjustCurrentTime(correction);
+    }
+
+    if (mUntilPoll == 0) {
+        poll();
+    }
+}
+
+void NTPRunnable::onSample(const hal::INTP::Sample &sample) noexcept {
+    mDiscipline.addSample(sample);
+    mUntilPoll = mDiscipline.getPollInterval();
+}
+
+void NTPRunnable::onFailure() noexcept {
+    mUntilPoll = ClockDiscipline::kRetryInterval;
+}
+
+void NTPRunnable::poll() noexcept {
+    mUntilPoll = mNtp.request(*this) ? hal::kForever
+                                     : ClockDiscipline::kRetryInterval;
 }
\ No newline at end of file
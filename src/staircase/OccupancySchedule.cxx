@@ -0,0 +1,103 @@
+#include <staircase/OccupancySchedule.hxx>
+
+#include <hal/Timing.hxx>
+
+#include <algorithm>
+
+using namespace staircase;
+
+OccupancySchedule::OccupancySchedule() noexcept
+    : mStarted{false}, mSlot{0}, mWhole{false}, mOccupied{false} {
+    mScores.fill(kOccupied);
+}
+
+void OccupancySchedule::update(hal::Milliseconds timeOfDay,
+                               std::uint32_t triggers) noexcept {
+    auto slot = slotOf(timeOfDay);
+    if (mStarted && slot == mSlot) {
+        mOccupied = mOccupied || triggers > 0;
+        return;
+    }
+
+    if (mStarted && (mWhole || mOccupied)) {
+        record(mSlot, mOccupied);
+    }
+
+    // Only a slot entered straight from the one before is watched whole;
+    // after a boot or a hibernation its start was missed.
+    mWhole = mStarted && slot == (mSlot + 1) % kSlotsNum;
+    mStarted = true;
+    mSlot = slot;
+    mOccupied = triggers > 0;
+}
+
+std::int64_t
+OccupancySchedule::quietFor(hal::Milliseconds timeOfDay) const noexcept {
+    auto slot = slotOf(timeOfDay);
+    if (mStarted && slot == mSlot && mOccupied) {
+        return 0;
+    }
+
+    std::int64_t quiet = 0;
+    std::int64_t left = kSlotLength - timeOfDay % kSlotLength;
+    for (std::size_t step = 0; step < kSlotsNum; ++step) {
+        if (mScores[(slot + step) % kSlotsNum] >= kQuietScore) {
+            break;
+        }
+
+        quiet += left;
+        left = kSlotLength;
+    }
+
+    return std::min<std::int64_t>(quiet, kDay);
+}
+
+void OccupancySchedule::sleepThrough(hal::Milliseconds timeOfDay,
+                                     std::int64_t duration) noexcept {
+    auto slot = slotOf(timeOfDay);
+    auto end = timeOfDay % kSlotLength + duration;
+    auto slots = static_cast<std::size_t>(
+        std::min<std::int64_t>((end + kSlotLength - 1) / kSlotLength,
+                               kSlotsNum));
+
+    for (std::size_t step = 0; step < slots; ++step) {
+        auto &score = mScores[(slot + step) % kSlotsNum];
+        score = static_cast<std::uint8_t>(
+            std::min(score + kForgetStep, static_cast<int>(kOccupied)));
+    }
+}
+
+std::int32_t OccupancySchedule::getWord(std::size_t word) const noexcept {
+    std::uint32_t packed = 0;
+    for (std::size_t index = 0; index < kSlotsPerWord; ++index) {
+        packed |= static_cast<std::uint32_t>(
+                      mScores[word * kSlotsPerWord + index])
+                  << (8 * index);
+    }
+
+    return static_cast<std::int32_t>(packed);
+}
+
+void OccupancySchedule::setWord(std::size_t word,
+                                std::int32_t value) noexcept {
+    auto packed = static_cast<std::uint32_t>(value);
+    for (std::size_t index = 0; index < kSlotsPerWord; ++index) {
+        mScores[word * kSlotsPerWord + index] =
+            static_cast<std::uint8_t>(packed >> (8 * index));
+    }
+}
+
+std::size_t OccupancySchedule::slotOf(hal::Milliseconds timeOfDay) noexcept {
+    auto slot = timeOfDay / kSlotLength;
+    return static_cast<std::size_t>(std::clamp<hal::Milliseconds>(
+        slot, 0, static_cast<hal::Milliseconds>(kSlotsNum - 1)));
+}
+
+void OccupancySchedule::record(std::size_t slot, bool occupied) noexcept {
+    auto &score = mScores[slot];
+    if (occupied) {
+        score += (kOccupied - score + kLearningRate - 1) / kLearningRate;
+    } else {
+        score -= (score + kLearningRate - 1) / kLearningRate;
+    }
+}
\ No newline at end of file
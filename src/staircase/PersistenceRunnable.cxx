@@ -0,0 +1,73 @@
+#include <staircase/PersistenceRunnable.hxx>
+
+#include <hal/IPersistence.hxx>
+#include <hal/ITask.hxx>
+#include <hal/Timing.hxx>
+
+#include <staircase/IMoving.hxx>
+#include <staircase/IStaircaseLooper.hxx>
+#include <staircase/LooperCommand.hxx>
+
+using namespace staircase;
+
+PersistenceRunnable::PersistenceRunnable(IStaircaseLooper &looper,
+                                         hal::IPersistence &persistence,
+                                         hal::Milliseconds quietPeriod,
+                                         std::uint32_t dirtyThreshold) noexcept
+    : mStaircaseLooper{looper}, mPersistence{persistence},
+      mStore{persistence,
+             {"down_time", "up_time", "down_walks", "up_walks"},
+             quietPeriod,
+             dirtyThreshold},
+      mDownWalksBase{0}, mUpWalksBase{0} {}
+
+void PersistenceRunnable::restore() noexcept {
+    mStore.restore();
+
+    if (mStore.has(DOWN_MOVING_TIME) && mStore.get(DOWN_MOVING_TIME) > 0) {
+        mStaircaseLooper.post(LooperCommand::resetFilter(
+            IMoving::Direction::DOWN, mStore.get(DOWN_MOVING_TIME)));
+    }
+
+    if (mStore.has(UP_MOVING_TIME) && mStore.get(UP_MOVING_TIME) > 0) {
+        mStaircaseLooper.post(LooperCommand::resetFilter(
+            IMoving::Direction::UP, mStore.get(UP_MOVING_TIME)));
+    }
+
+    mDownWalksBase = static_cast<std::uint32_t>(mStore.get(DOWN_WALKS));
+    mUpWalksBase = static_cast<std::uint32_t>(mStore.get(UP_WALKS));
+}
+
+void PersistenceRunnable::flush() noexcept {
+    storeSnapshot();
+    mStore.flush();
+}
+
+void PersistenceRunnable::run() noexcept {
+    hal::Milliseconds delta = kUpdateInterval;
+    if (mTask) {
+        delta = mTask->delta();
+    }
+
+    storeSnapshot();
+    mStore.update(delta);
+    if (!mStore.isDirty()) {
+        mPersistence.maintain();
+    }
+}
+
+void PersistenceRunnable::storeSnapshot() noexcept {
+    // Before the first update the snapshot still holds the initial filter
+    // values, not what restore() posted.
+    auto snapshot = mStaircaseLooper.snapshot();
+    if (snapshot.updates == 0) {
+        return;
+    }
+
+    mStore.set(DOWN_MOVING_TIME, snapshot.downMovingTime);
+    mStore.set(UP_MOVING_TIME, snapshot.upMovingTime);
+    mStore.set(DOWN_WALKS,
+               static_cast<std::int32_t>(mDownWalksBase + snapshot.downWalks));
+    mStore.set(UP_WALKS,
+               static_cast<std::int32_t>(mUpWalksBase + snapshot.upWalks));
+}
\ No newline at end of file
@@ -1,24 +1,91 @@
 #include <staircase/PowerRunnable.hxx>
 
+#include <hal/IPersistence.hxx>
 #include <hal/IPowerManager.hxx>
 #include <hal/IRTC.hxx>
+#include <hal/ITask.hxx>
 #include <hal/Timing.hxx>
 
+#include <staircase/IStaircaseLooper.hxx>
+#include <staircase/LooperSnapshot.hxx>
+#include <staircase/OccupancySchedule.hxx>
+#include <staircase/PersistenceRunnable.hxx>
+
+#include <algorithm>
 #include <cstdint>
 
 using namespace staircase;
 
-PowerRunnable::PowerRunnable(hal::IRTC &rtc, hal::IPowerManager &powerManager)
-    : mRtc{rtc}, mPowerManager{powerManager} {}
+namespace {
+
+constexpr PowerRunnable::Store::Keys kScheduleKeys{
+    "occupancy_0", "occupancy_1", "occupancy_2",  "occupancy_3",
+    "occupancy_4", "occupancy_5", "occupancy_6",  "occupancy_7",
+    "occupancy_8", "occupancy_9", "occupancy_10", "occupancy_11"};
+
+} // namespace
+
+PowerRunnable::PowerRunnable(hal::IRTC &rtc, hal::IPowerManager &powerManager,
+                             IStaircaseLooper &looper,
+                             hal::IPersistence &persistence) noexcept
+    : mRtc{rtc}, mPowerManager{powerManager}, mStaircaseLooper{looper},
+      mStore{persistence, kScheduleKeys}, mPersistence{nullptr}, mSchedule{},
+      mTriggers{0} {}
+
+void PowerRunnable::restore() noexcept {
+    mStore.restore();
+
+    for (std::size_t word = 0; word < OccupancySchedule::kWordsNum; ++word) {
+        if (mStore.has(word)) {
+            mSchedule.setWord(word, mStore.get(word));
+        }
+    }
+}
 
 void PowerRunnable::run() noexcept {
-    hal::Milliseconds currentTime = mRtc.getCurrentTimeOfDay();
+    hal::Milliseconds delta = kUpdateInterval;
+    if (mTask) {
+        delta = mTask->delta();
+    }
 
-    constexpr hal::Milliseconds startSleepTime = 8 * 60 * 60 * 1000;
-    constexpr hal::Milliseconds endSleepTime = 17 * 60 * 60 * 1000;
+    auto snapshot = mStaircaseLooper.snapshot();
+    auto timeOfDay = mRtc.getCurrentTimeOfDay();
+    mSchedule.update(timeOfDay, snapshot.triggers - mTriggers);
+    mTriggers = snapshot.triggers;
+    storeSchedule();
+    mStore.update(delta);
 
-    if ((currentTime > startSleepTime) && (currentTime < endSleepTime)) {
-        mPowerManager.hibernateFor(
-            static_cast<uint64_t>(endSleepTime - currentTime) * 1000);
+    if (!isQuiet(snapshot)) {
+        return;
     }
+
+    auto quiet = mSchedule.quietFor(timeOfDay);
+    if (quiet < kMinHibernation) {
+        return;
+    }
+
+    // Durations stay 64-bit until clamped to what hibernateFor() takes.
+    auto duration = std::min<std::int64_t>(quiet, kMaxHibernation);
+    mSchedule.sleepThrough(timeOfDay, duration);
+    storeSchedule();
+    mStore.flush();
+    if (mPersistence) {
+        mPersistence->flush();
+    }
+    mPowerManager.hibernateFor(static_cast<hal::Milliseconds>(duration));
+}
+
+void PowerRunnable::storeSchedule() noexcept {
+    for (std::size_t word = 0; word < OccupancySchedule::kWordsNum; ++word) {
+        mStore.set(word, mSchedule.getWord(word));
+    }
+}
+
+bool PowerRunnable::isQuiet(const LooperSnapshot &snapshot) noexcept {
+    if (snapshot.downMovings.count != 0 || snapshot.upMovings.count != 0) {
+        return false;
+    }
+
+    return std::all_of(std::begin(snapshot.lights), std::end(snapshot.lights),
+                       [](std::uint32_t word) { return word == 0; });
 }
\ No newline at end of file
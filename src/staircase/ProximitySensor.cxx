@@ -1,50 +1,156 @@
 #include <staircase/ProximitySensor.hxx>
 
+#include <hal/BinaryEdge.hxx>
 #include <hal/BinaryValue.hxx>
 #include <hal/IBinaryValueReader.hxx>
 #include <hal/Timing.hxx>
 
+#include <staircase/TraceRing.hxx>
+
+#include <algorithm>
+#include <optional>
+#include <utility>
+
 using namespace staircase;
 
 ProximitySensor::ProximitySensor(
     hal::IBinaryValueReader &binaryValueReader) noexcept
-    : mBinaryValueReader{binaryValueReader}, mState{readState()},
-      mStateChanged{false}, mTimePassed{hal::kForever} {}
+    : mPoller{std::in_place, binaryValueReader}, mEdges{nullptr},
+      mLevel{nullptr}, mOverflows{0}, mResyncPending{false}, mResyncs{0},
+      mState{SensorState::FAR}, mStateChanged{false}, mRawState{mState},
+      mRawSince{0}, mNow{0}, mTrace{nullptr}, mTraceSubject{0} {}
 
-bool ProximitySensor::hasStateChanged() const noexcept { return mStateChanged; }
+ProximitySensor::ProximitySensor(EdgeQueue &edges,
+                                 hal::IBinaryValueReader &level,
+                                 hal::Timestamp now) noexcept
+    : mPoller{}, mEdges{&edges}, mLevel{&level},
+      mOverflows{edges.overflows()}, mResyncPending{false}, mResyncs{0},
+      mState{toState(level.readValue())}, mStateChanged{false},
+      mRawState{mState}, mRawSince{now}, mNow{now}, mTrace{nullptr},
+      mTraceSubject{0} {}
+
+bool ProximitySensor::hasStateChanged() const noexcept {
+    return mPoller ? mPoller->hasStateChanged() : mStateChanged;
+}
 
 bool ProximitySensor::isClose() const noexcept {
-    return mState == SensorState::CLOSE;
+    return mPoller ? mPoller->isClose() : mState == SensorState::CLOSE;
 }
 
 bool ProximitySensor::isFar() const noexcept {
-    return mState == SensorState::FAR;
+    return mPoller ? mPoller->isFar() : mState == SensorState::FAR;
 }
 
 void ProximitySensor::update(hal::Milliseconds delta) noexcept {
+    if (mPoller) {
+        mPoller->update(delta);
+        return;
+    }
+
     mStateChanged = false;
+    consumeEdges(delta);
+}
+
+void ProximitySensor::setTrace(TraceRing *trace,
+                               std::uint16_t subject) noexcept {
+    mTrace = trace;
+    mTraceSubject = subject;
+}
+
+hal::Milliseconds ProximitySensor::nextDeadline() const noexcept {
+    if (mPoller) {
+        return mPoller->nextDeadline();
+    }
+
+    if (!mEdges->empty() || mResyncPending ||
+        mEdges->overflows() != mOverflows) {
+        return 0;
+    }
+
+    if (mRawState == mState) {
+        return hal::kForever;
+    }
+
+    return std::clamp(kDebouncePeriod - hal::elapsed(mRawSince, mNow), 0,
+                      kDebouncePeriod);
+}
 
-    auto newState = readState();
+void ProximitySensor::consumeEdges(hal::Milliseconds delta) noexcept {
+    mNow += delta;
 
-    if (newState != mState) {
-        if (mTimePassed == hal::kForever) {
-            mTimePassed = delta / 2;
-        } else {
-            mTimePassed += delta;
+    // The edges which were lost are later than the queued ones, so the
+    // level is read once those are consumed.
+    auto overflows = mEdges->overflows();
+    if (overflows != mOverflows) {
+        mOverflows = overflows;
+        mResyncPending = true;
+    }
+
+    hal::BinaryEdge edge;
+    while (mEdges->peek(edge)) {
+        // A level which was stable long enough before this edge is a state
+        // change of its own. Report it now and leave the edge for the next
+        // update so back to back changes are not merged into one.
+        if (settle(edge.timestamp)) {
+            return;
         }
 
-        if (mTimePassed >= kDebouncePeriod) {
-            mState = newState;
-            mStateChanged = true;
-            mTimePassed = hal::kForever;
+        mEdges->pop(edge);
+
+        auto newState = toState(edge.value);
+        if (newState != mRawState) {
+            mRawState = newState;
+            mRawSince = edge.timestamp;
+            traceEdge(edge);
         }
     }
+
+    if (mResyncPending) {
+        resync();
+    }
+
+    settle(mNow);
 }
 
-ProximitySensor::SensorState ProximitySensor::readState() noexcept {
-    auto binaryValue = mBinaryValueReader.readValue();
+void ProximitySensor::resync() noexcept {
+    mResyncPending = false;
+    ++mResyncs;
+
+    // When the level changed is unknown, so it is debounced from now.
+    auto level = toState(mLevel->readValue());
+    if (level != mRawState) {
+        mRawState = level;
+        mRawSince = mNow;
+    }
+}
+
+bool ProximitySensor::settle(hal::Timestamp now) noexcept {
+    if (mRawState == mState ||
+        hal::elapsed(mRawSince, now) < kDebouncePeriod) {
+        return false;
+    }
+
+    mState = mRawState;
+    mStateChanged = true;
+    return true;
+}
+
+void ProximitySensor::traceEdge(const hal::BinaryEdge &edge) noexcept {
+    if constexpr (kTraceEnabled) {
+        if (mTrace) {
+            // Back-dated from the trace clock by the age of the edge.
+            auto age = static_cast<hal::Timestamp>(
+                hal::elapsed(edge.timestamp, mNow));
+            mTrace->recordAt(mTrace->now() - age, TraceEvent::SENSOR_EDGE,
+                             mTraceSubject, toState(edge.value) ==
+                                                SensorState::CLOSE);
+        }
+    }
+}
 
-    switch (binaryValue) {
+ProximitySensor::SensorState
+ProximitySensor::toState(hal::BinaryValue value) noexcept {
+    switch (value) {
     case hal::BinaryValue::HIGH:
         return SensorState::CLOSE;
     case hal::BinaryValue::LOW:
@@ -0,0 +1,178 @@
+#include <staircase/SntpClient.hxx>
+
+#include <hal/IDatagramSocket.hxx>
+#include <hal/INTP.hxx>
+#include <hal/IRTC.hxx>
+#include <hal/Timing.hxx>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+using namespace staircase;
+
+namespace {
+
+constexpr hal::Milliseconds kDay = 24 * 60 * 60 * 1000;
+constexpr std::uint64_t kSecondsPerDay = 24 * 60 * 60;
+
+// Field offsets and values of the NTP packet.
+constexpr std::size_t kStratum = 1;
+constexpr std::size_t kOriginate = 24;
+constexpr std::size_t kReceive = 32;
+constexpr std::size_t kTransmit = 40;
+constexpr unsigned kVersion = 4;
+constexpr unsigned kModeClient = 3;
+constexpr unsigned kModeServer = 4;
+constexpr unsigned kLeapAlarm = 3;
+constexpr unsigned kUnsynchronised = 16;
+
+// Difference of two times of day, taken the short way around midnight.
+hal::Milliseconds wrap(hal::Milliseconds difference) noexcept {
+    difference %= kDay;
+    if (difference > kDay / 2) {
+        difference -= kDay;
+    } else if (difference <= -kDay / 2) {
+        difference += kDay;
+    }
+
+    return difference;
+}
+
+std::uint32_t readWord(std::span<const std::byte> bytes,
+                       std::size_t offset) noexcept {
+    std::uint32_t word = 0;
+    for (std::size_t index = 0; index < 4; ++index) {
+        word = (word << 8) |
+               std::to_integer<std::uint32_t>(bytes[offset + index]);
+    }
+
+    return word;
+}
+
+void writeWord(std::span<std::byte> bytes, std::size_t offset,
+               std::uint32_t word) noexcept {
+    for (std::size_t index = 0; index < 4; ++index) {
+        bytes[offset + index] =
+            static_cast<std::byte>(word >> (8 * (3 - index)));
+    }
+}
+
+} // namespace
+
+SntpClient::SntpClient(hal::IDatagramSocket &socket, hal::IRTC &rtc,
+                       hal::Milliseconds zoneOffset) noexcept
+    : mSocket{socket}, mRtc{rtc}, mZoneOffset{zoneOffset}, mListener{nullptr},
+      mWaited{0}, mSentAt{0}, mNonce{}, mRequests{0} {}
+
+bool SntpClient::request(IListener &listener) noexcept {
+    if (mListener) {
+        return false;
+    }
+
+    // Late replies to an earlier request which timed out.
+    Packet packet{};
+    while (mSocket.receive(packet) != 0) {
+    }
+
+    packet.fill(std::byte{0});
+    packet[0] = static_cast<std::byte>((kVersion << 3) | kModeClient);
+
+    // The transmit timestamp of a request is only echoed back by the server,
+    // so it carries a nonce instead of a time the device may not know yet.
+    mSentAt = mRtc.getCurrentTimeOfDay();
+    writeWord(packet, kTransmit, ++mRequests);
+    writeWord(packet, kTransmit + 4, static_cast<std::uint32_t>(mSentAt));
+    std::copy_n(packet.begin() + kTransmit, mNonce.size(), mNonce.begin());
+
+    if (!mSocket.send(packet)) {
+        return false;
+    }
+
+    mListener = &listener;
+    mWaited = 0;
+    return true;
+}
+
+void SntpClient::update(hal::Milliseconds delta) noexcept {
+    if (!mListener) {
+        return;
+    }
+
+    mWaited += delta;
+
+    Packet packet{};
+    while (auto size = mSocket.receive(packet)) {
+        Sample sample{};
+        if (size >= kPacketSize && accept(packet, sample)) {
+            complete(&sample);
+            return;
+        }
+    }
+
+    if (mWaited >= kTimeout) {
+        complete(nullptr);
+    }
+}
+
+hal::Milliseconds SntpClient::nextDeadline() const noexcept {
+    if (!mListener) {
+        return hal::kForever;
+    }
+
+    return std::max(kTimeout - mWaited, 0);
+}
+
+bool SntpClient::accept(const Packet &packet, Sample &sample) const noexcept {
+    auto header = std::to_integer<unsigned>(packet[0]);
+    auto stratum = std::to_integer<unsigned>(packet[kStratum]);
+    if ((header & 0x07) != kModeServer || (header >> 6) == kLeapAlarm ||
+        stratum == 0 || stratum >= kUnsynchronised) {
+        return false;
+    }
+
+    if (!std::equal(mNonce.begin(), mNonce.end(),
+                    packet.begin() + kOriginate)) {
+        return false;
+    }
+
+    auto receivedAt = mRtc.getCurrentTimeOfDay();
+    auto serverReceive = timeOfDay(packet, kReceive);
+    auto serverTransmit = timeOfDay(packet, kTransmit);
+
+    auto roundTrip = wrap(receivedAt - mSentAt);
+    auto processing = wrap(serverTransmit - serverReceive);
+    sample.offset = wrap((wrap(serverReceive - mSentAt) +
+                          wrap(serverTransmit - receivedAt)) /
+                         2);
+    sample.delay = std::max(roundTrip - processing, 0);
+    return true;
+}
+
+hal::Milliseconds SntpClient::timeOfDay(const Packet &packet,
+                                        std::size_t offset) const noexcept {
+    std::uint64_t seconds = readWord(packet, offset);
+    std::uint64_t fraction = readWord(packet, offset + 4);
+
+    // Timestamps with the top bit clear are past the 2036 wrap.
+    if (seconds < (std::uint64_t{1} << 31)) {
+        seconds += std::uint64_t{1} << 32;
+    }
+
+    auto millis =
+        (seconds % kSecondsPerDay) * 1000 + ((fraction * 1000) >> 32);
+    auto local = (static_cast<std::int64_t>(millis) + mZoneOffset) % kDay;
+    return static_cast<hal::Milliseconds>((local < 0) ? local + kDay : local);
+}
+
+void SntpClient::complete(const Sample *sample) noexcept {
+    // The listener may well send the next request straight away.
+    auto *listener = std::exchange(mListener, nullptr);
+    if (sample) {
+        listener->onSample(*sample);
+    } else {
+        listener->onFailure();
+    }
+}
\ No newline at end of file
@@ -3,16 +3,28 @@
 #include <hal/Timing.hxx>
 
 #include <staircase/IBasicLight.hxx>
-#include <staircase/IMoving.hxx>
+#include <staircase/ILightBank.hxx>
+#include <staircase/ILightPort.hxx>
 #include <staircase/IMovingDurationCalculator.hxx>
 #include <staircase/IMovingFactory.hxx>
 #include <staircase/IMovingTimeFilter.hxx>
 #include <staircase/IProximitySensor.hxx>
-#include <staircase/IStaircaseLooper.hxx>
+#include <staircase/LooperCommand.hxx>
+#include <staircase/LooperSnapshot.hxx>
+#include <staircase/StaircaseConfig.hxx>
+#include <staircase/StaticStaircaseLooper.hxx>
+#include <staircase/TickProfile.hxx>
+#include <staircase/TraceRing.hxx>
 
-#include <algorithm>
 #include <mutex>
-#include <string>
+
+namespace staircase {
+
+template class StaticStaircaseLooper<
+    kDefaultConfig, IBasicLight, IProximitySensor, IMovingDurationCalculator,
+    IMovingTimeFilter, IMovingTimeFilter, FactoryMovings>;
+
+} // namespace staircase
 
 using namespace staircase;
 
@@ -23,114 +35,62 @@ StaircaseLooper::StaircaseLooper(BasicLights &lights,
                                  IMovingDurationCalculator &durationCalculator,
                                  IMovingTimeFilter &downMovingFilter,
                                  IMovingTimeFilter &upMovingFilter) noexcept
-    : mLights{lights}, mDownSensor{downSensor}, mUpSensor{upSensor},
-      mMovingFactory{movingFactory}, mDurationCalculator{durationCalculator},
-      mDownMovingFilter{downMovingFilter}, mUpMovingFilter{upMovingFilter} {}
-
-void StaircaseLooper::update(hal::Milliseconds delta) noexcept {
-    std::lock_guard<std::mutex> lock{mLock};
-
-    updateLights(delta);
-    updateSensors(delta);
-    updateMovigns(delta);
-
-    removeAllStaleMovings(mDownMovings);
-    removeAllStaleMovings(mUpMovings);
-
-    if (mDownSensor.hasStateChanged() && mDownSensor.isClose()) {
-        handleDownSensorStateChanged();
-    }
+    : mLooper{lights,        downSensor,         upSensor,
+              movingFactory, durationCalculator, downMovingFilter,
+              upMovingFilter} {}
 
-    if (mUpSensor.hasStateChanged() && mUpSensor.isClose()) {
-        handleUpSensorStateChanged();
-    }
-}
+StaircaseLooper::StaircaseLooper(BasicLights &lights, ILightPort &lightPort,
+                                 IProximitySensor &downSensor,
+                                 IProximitySensor &upSensor,
+                                 IMovingFactory &movingFactory,
+                                 IMovingDurationCalculator &durationCalculator,
+                                 IMovingTimeFilter &downMovingFilter,
+                                 IMovingTimeFilter &upMovingFilter) noexcept
+    : mLooper{lights,           lightPort,     downSensor,
+              upSensor,         movingFactory, durationCalculator,
+              downMovingFilter, upMovingFilter} {}
 
-std::lock_guard<std::mutex> StaircaseLooper::block() noexcept {
-    return std::lock_guard<std::mutex>{mLock};
-}
+StaircaseLooper::StaircaseLooper(BasicLights &lights, ILightBank &lightBank,
+                                 IProximitySensor &downSensor,
+                                 IProximitySensor &upSensor,
+                                 IMovingFactory &movingFactory,
+                                 IMovingDurationCalculator &durationCalculator,
+                                 IMovingTimeFilter &downMovingFilter,
+                                 IMovingTimeFilter &upMovingFilter) noexcept
+    : mLooper{lights,           lightBank,     downSensor,
+              upSensor,         movingFactory, durationCalculator,
+              downMovingFilter, upMovingFilter} {}
 
-void StaircaseLooper::updateLights(hal::Milliseconds delta) noexcept {
-    std::for_each(std::begin(mLights), std::end(mLights),
-                  [delta](auto light) { light.get().update(delta); });
+void StaircaseLooper::update(hal::Milliseconds delta) noexcept {
+    mLooper.update(delta);
 }
 
-void StaircaseLooper::updateSensors(hal::Milliseconds delta) noexcept {
-    mDownSensor.update(delta);
-    mUpSensor.update(delta);
+hal::Milliseconds StaircaseLooper::nextDeadline() const noexcept {
+    return mLooper.nextDeadline();
 }
 
-void StaircaseLooper::updateMovigns(hal::Milliseconds delta) noexcept {
-    std::for_each(std::begin(mDownMovings), std::end(mDownMovings),
-                  [delta](auto &moving) { moving->update(delta); });
+bool StaircaseLooper::isIdle() const noexcept { return mLooper.isIdle(); }
 
-    std::for_each(std::begin(mUpMovings), std::end(mUpMovings),
-                  [delta](auto &moving) { moving->update(delta); });
+bool StaircaseLooper::post(const LooperCommand &command) noexcept {
+    return mLooper.post(command);
 }
 
-void StaircaseLooper::removeAllStaleMovings(Movings &movings) noexcept {
-    while (!movings.empty() && movings.front()->isTooOld()) {
-        movings.pop_front();
-    }
+LooperSnapshot StaircaseLooper::snapshot() const noexcept {
+    return mLooper.snapshot();
 }
 
-void StaircaseLooper::handleDownSensorStateChanged() {
-    if (isFirstMovingFinishing(mDownMovings)) {
-        finishFirstMoving(mDownMovings, mDownMovingFilter);
-    } else if (!hasNewMovingJustStarted(mUpMovings) &&
-               isMoreNewMovingsAvailable(mUpMovings)) {
-        auto moving = mMovingFactory.create(
-            mLights, mDurationCalculator, IMoving::Direction::UP,
-            mUpMovingFilter.getCurrentMovingTime());
-        if (moving) {
-            mUpMovings.push_back(std::move(moving));
-        }
-    }
-}
-
-void StaircaseLooper::handleUpSensorStateChanged() {
-    if (isFirstMovingFinishing(mUpMovings)) {
-        finishFirstMoving(mUpMovings, mUpMovingFilter);
-    } else if (!hasNewMovingJustStarted(mDownMovings) &&
-               isMoreNewMovingsAvailable(mDownMovings)) {
-        auto moving = mMovingFactory.create(
-            mLights, mDurationCalculator, IMoving::Direction::DOWN,
-            mDownMovingFilter.getCurrentMovingTime());
-        if (moving) {
-            mDownMovings.push_back(std::move(moving));
-        }
-    }
+std::lock_guard<std::mutex> StaircaseLooper::block() noexcept {
+    return mLooper.block();
 }
 
-bool StaircaseLooper::isFirstMovingFinishing(Movings &movings) const noexcept {
-    if (movings.empty()) {
-        return false;
-    }
-
-    return movings.front()->isNearEnd();
+void StaircaseLooper::setTrace(TraceRing *trace) noexcept {
+    mLooper.setTrace(trace);
 }
 
-bool StaircaseLooper::hasNewMovingJustStarted(Movings &movings) const noexcept {
-    if (movings.empty()) {
-        return false;
-    }
-
-    return movings.back()->isNearBegin();
+void StaircaseLooper::setProfile(TickProfile *profile) noexcept {
+    mLooper.setProfile(profile);
 }
 
-bool StaircaseLooper::isMoreNewMovingsAvailable(
-    Movings &movings) const noexcept {
-    return movings.size() < IMoving::kMaxMovings;
+void StaircaseLooper::setPeriods(const PhasePeriods &periods) noexcept {
+    mLooper.setPeriods(periods);
 }
-
-void StaircaseLooper::finishFirstMoving(Movings &movings,
-                                        IMovingTimeFilter &filter) noexcept {
-    if (movings.empty()) {
-        return;
-    }
-
-    auto currentDuration = movings.front()->getTimePassed();
-    movings.pop_front();
-
-    filter.processNewMovingTime(currentDuration);
-}
\ No newline at end of file
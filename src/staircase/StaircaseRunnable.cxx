@@ -10,10 +10,18 @@ using namespace staircase;
 StaircaseRunnable::StaircaseRunnable(IStaircaseLooper &looper)
     : mStaircaseLooper{looper} {}
 
+hal::Milliseconds StaircaseRunnable::nextDeadline() const noexcept {
+    return mStaircaseLooper.nextDeadline();
+}
+
+bool StaircaseRunnable::isIdle() const noexcept {
+    return mStaircaseLooper.isIdle();
+}
+
 void StaircaseRunnable::run() noexcept {
     hal::Milliseconds delta = kUpdateInterval;
     if (mTask) {
-        delta = mTask->getDelta();
+        delta = mTask->delta();
     }
     mStaircaseLooper.update(delta);
 }
\ No newline at end of file
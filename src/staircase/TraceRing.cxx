@@ -0,0 +1,44 @@
+#include <staircase/TraceRing.hxx>
+
+#include <hal/Timing.hxx>
+
+using namespace staircase;
+
+namespace {
+
+template <class T> void put(std::byte *out, T value) noexcept {
+    for (std::size_t index = 0; index < sizeof(T); ++index) {
+        out[index] = static_cast<std::byte>(
+            static_cast<std::uint32_t>(value) >> (8 * index));
+    }
+}
+
+template <class T> T get(const std::byte *in) noexcept {
+    std::uint32_t value = 0;
+    for (std::size_t index = 0; index < sizeof(T); ++index) {
+        value |= static_cast<std::uint32_t>(in[index]) << (8 * index);
+    }
+
+    return static_cast<T>(value);
+}
+
+} // namespace
+
+EncodedTraceRecord
+staircase::encodeTraceRecord(const TraceRecord &record) noexcept {
+    EncodedTraceRecord encoded;
+    put<std::uint32_t>(&encoded[0], record.time);
+    put<std::uint8_t>(&encoded[4], static_cast<std::uint8_t>(record.event));
+    put<std::uint16_t>(&encoded[5], record.subject);
+    put<std::uint32_t>(&encoded[7], static_cast<std::uint32_t>(record.value));
+
+    return encoded;
+}
+
+TraceRecord staircase::decodeTraceRecord(
+    std::span<const std::byte, kTraceRecordSize> encoded) noexcept {
+    return {get<std::uint32_t>(&encoded[0]),
+            static_cast<TraceEvent>(get<std::uint8_t>(&encoded[4])),
+            get<std::uint16_t>(&encoded[5]),
+            static_cast<std::int32_t>(get<std::uint32_t>(&encoded[7]))};
+}
\ No newline at end of file
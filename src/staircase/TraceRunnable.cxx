@@ -0,0 +1,52 @@
+#include <staircase/TraceRunnable.hxx>
+
+#include <hal/IStreamWriter.hxx>
+
+#include <staircase/TraceRing.hxx>
+
+#include <algorithm>
+#include <array>
+
+using namespace staircase;
+
+TraceRunnable::TraceRunnable(TraceRing &trace,
+                             hal::IStreamWriter &writer) noexcept
+    : mTrace{trace}, mWriter{writer}, mDropped{0}, mLastTime{0} {}
+
+std::size_t TraceRunnable::drain() noexcept {
+    std::array<std::byte, kChunkRecords * kTraceRecordSize> chunk;
+    std::size_t written = 0;
+
+    auto append = [&chunk](std::size_t count, const TraceRecord &record) {
+        auto encoded = encodeTraceRecord(record);
+        std::copy(encoded.begin(), encoded.end(),
+                  chunk.begin() + count * kTraceRecordSize);
+    };
+
+    while (true) {
+        std::size_t count = 0;
+
+        // Reported before the records which follow the gap.
+        auto dropped = mTrace.dropped();
+        if (dropped != mDropped) {
+            append(count++, {mLastTime, TraceEvent::DROPPED, 0,
+                             static_cast<std::int32_t>(dropped - mDropped)});
+            mDropped = dropped;
+        }
+
+        TraceRecord record;
+        while (count < kChunkRecords && mTrace.pop(record)) {
+            append(count++, record);
+            mLastTime = record.time;
+        }
+
+        if (count == 0) {
+            return written;
+        }
+
+        mWriter.write({chunk.data(), count * kTraceRecordSize});
+        written += count;
+    }
+}
+
+void TraceRunnable::run() noexcept { drain(); }
\ No newline at end of file
@@ -14,6 +14,7 @@ class BasicLightMock : public staircase::IBasicLight {
     MOCK_METHOD(void, update, (hal::Milliseconds), (noexcept));
     MOCK_METHOD(bool, isOn, (), (const, noexcept));
     MOCK_METHOD(bool, isOff, (), (const, noexcept));
+    MOCK_METHOD(hal::Milliseconds, nextDeadline, (), (const, noexcept));
 };
 
 } // namespace mocks
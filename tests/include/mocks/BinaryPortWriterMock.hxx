@@ -0,0 +1,17 @@
+#include <gmock/gmock.h>
+
+#include <hal/IBinaryPortWriter.hxx>
+
+#include <span>
+
+namespace tests {
+namespace mocks {
+
+class BinaryPortWriterMock : public hal::IBinaryPortWriter {
+  public:
+    MOCK_METHOD(void, writePort,
+                (std::span<const hal::IBinaryPortWriter::Word>), (noexcept));
+};
+
+} // namespace mocks
+} // namespace tests
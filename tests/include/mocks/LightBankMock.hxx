@@ -0,0 +1,23 @@
+#include <gmock/gmock.h>
+
+#include <hal/Timing.hxx>
+
+#include <staircase/ILightBank.hxx>
+
+#include <cstdint>
+#include <span>
+
+namespace tests {
+namespace mocks {
+
+class LightBankMock : public staircase::ILightBank {
+  public:
+    MOCK_METHOD(void, flush, (), (noexcept));
+    MOCK_METHOD(void, update, (hal::Milliseconds), (noexcept));
+    MOCK_METHOD(hal::Milliseconds, nextDeadline, (), (const, noexcept));
+    MOCK_METHOD(void, copyState, (std::span<std::uint32_t>),
+                (const, noexcept));
+};
+
+} // namespace mocks
+} // namespace tests
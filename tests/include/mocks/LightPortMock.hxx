@@ -0,0 +1,14 @@
+#include <gmock/gmock.h>
+
+#include <staircase/ILightPort.hxx>
+
+namespace tests {
+namespace mocks {
+
+class LightPortMock : public staircase::ILightPort {
+  public:
+    MOCK_METHOD(void, flush, (), (noexcept));
+};
+
+} // namespace mocks
+} // namespace tests
@@ -15,6 +15,7 @@ class MovingMock : public staircase::IMoving {
     MOCK_METHOD(bool, isNearEnd, (), (const, noexcept));
     MOCK_METHOD(bool, isNearBegin, (), (const, noexcept));
     MOCK_METHOD(bool, isTooOld, (), (const, noexcept));
+    MOCK_METHOD(hal::Milliseconds, nextDeadline, (), (const, noexcept));
 };
 
 } // namespace mocks
@@ -3,18 +3,23 @@
 #include <hal/IPersistence.hxx>
 
 #include <cstdint>
-#include <string>
+#include <optional>
+#include <span>
+#include <string_view>
 
 namespace tests {
 namespace mocks {
 
 class PersistenceMock : public hal::IPersistence {
   public:
-    MOCK_METHOD(bool, keyExists, (const std::string &), (const, noexcept));
-    MOCK_METHOD(std::int32_t, getValue, (const std::string &),
+    MOCK_METHOD(bool, keyExists, (std::string_view), (const, noexcept));
+    MOCK_METHOD(std::int32_t, getValue, (std::string_view), (const, noexcept));
+    MOCK_METHOD(void, setValue, (std::string_view, std::int32_t), (noexcept));
+    MOCK_METHOD(std::optional<std::int32_t>, tryGet, (std::string_view),
                 (const, noexcept));
-    MOCK_METHOD(void, setValue, (const std::string &, std::int32_t),
-                (noexcept));
+    MOCK_METHOD(void, getValues, (std::span<Entry>), (const, noexcept));
+    MOCK_METHOD(void, setValues, (std::span<const Entry>), (noexcept));
+    MOCK_METHOD(void, maintain, (), (noexcept));
 };
 
 } // namespace mocks
@@ -0,0 +1,15 @@
+#include <gmock/gmock.h>
+
+#include <hal/IPowerManager.hxx>
+#include <hal/Timing.hxx>
+
+namespace tests {
+namespace mocks {
+
+class PowerManagerMock : public hal::IPowerManager {
+  public:
+    MOCK_METHOD(void, hibernateFor, (hal::Milliseconds), (noexcept));
+};
+
+} // namespace mocks
+} // namespace tests
\ No newline at end of file
@@ -13,6 +13,7 @@ class ProximitySensorMock : public staircase::IProximitySensor {
     MOCK_METHOD(bool, isClose, (), (const, noexcept));
     MOCK_METHOD(bool, isFar, (), (const, noexcept));
     MOCK_METHOD(void, update, (hal::Milliseconds), (noexcept));
+    MOCK_METHOD(hal::Milliseconds, nextDeadline, (), (const, noexcept));
 };
 
 } // namespace mocks
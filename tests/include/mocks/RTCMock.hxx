@@ -0,0 +1,16 @@
+#include <gmock/gmock.h>
+
+#include <hal/IRTC.hxx>
+#include <hal/Timing.hxx>
+
+namespace tests {
+namespace mocks {
+
+class RTCMock : public hal::IRTC {
+  public:
+    MOCK_METHOD(hal::Milliseconds, getCurrentTimeOfDay, (), (const, noexcept));
+    MOCK_METHOD(void, adjustCurrentTime, (hal::Milliseconds), (noexcept));
+};
+
+} // namespace mocks
+} // namespace tests
\ No newline at end of file
@@ -0,0 +1,32 @@
+#include <gmock/gmock.h>
+
+#include <hal/Timing.hxx>
+
+#include <staircase/IStaircaseLooper.hxx>
+#include <staircase/LooperCommand.hxx>
+#include <staircase/LooperSnapshot.hxx>
+
+#include <mutex>
+
+namespace tests {
+namespace mocks {
+
+class StaircaseLooperMock : public staircase::IStaircaseLooper {
+  public:
+    MOCK_METHOD(void, update, (hal::Milliseconds), (noexcept));
+    MOCK_METHOD(hal::Milliseconds, nextDeadline, (), (const, noexcept));
+    MOCK_METHOD(bool, isIdle, (), (const, noexcept));
+    MOCK_METHOD(bool, post, (const staircase::LooperCommand &), (noexcept));
+    MOCK_METHOD(staircase::LooperSnapshot, snapshot, (), (const, noexcept));
+
+    // lock_guard is neither copyable nor movable, which gmock needs.
+    std::lock_guard<std::mutex> block() noexcept override {
+        return std::lock_guard<std::mutex>{mLock};
+    }
+
+  private:
+    std::mutex mLock;
+};
+
+} // namespace mocks
+} // namespace tests
\ No newline at end of file
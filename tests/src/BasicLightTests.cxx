@@ -3,10 +3,14 @@
 
 #include <mocks/BinaryValueWriterMock.hxx>
 
+#include <hal/Adapters.hxx>
 #include <hal/BinaryValue.hxx>
 #include <hal/Timing.hxx>
 
 #include <staircase/BasicLight.hxx>
+#include <staircase/StaticBasicLight.hxx>
+
+#include <cstdint>
 
 namespace tests {
 
@@ -130,6 +134,18 @@ TEST_F(BasicLightTests, GivenTurnOnIsCalledForeverNewWriteIsNeverCalled) {
     mBasicLight.update(100000);
 }
 
+TEST_F(BasicLightTests, GivenTurnOnIsCalledForeverTimedTurnOnDoesNotEndIt) {
+    mBasicLight.turnOn(hal::kForever);
+    mBasicLight.turnOn(3000);
+
+    EXPECT_CALL(mBinaryValueWriter, writeValue(hal::BinaryValue::LOW))
+        .Times(Exactly(0));
+
+    mBasicLight.update(3000);
+    EXPECT_TRUE(mBasicLight.isOn());
+    EXPECT_EQ(mBasicLight.nextDeadline(), hal::kForever);
+}
+
 TEST_F(BasicLightTests,
        GivenTurnOnIsCalledWithDefaultValueTurnOffWritesANewValue) {
     mBasicLight.turnOn();
@@ -182,4 +198,65 @@ TEST_F(BasicLightTests, GivenBasicLightIsTurnedOnAndOffItsValueIsOff) {
     EXPECT_FALSE(mBasicLight.isOn());
 }
 
+TEST_F(BasicLightTests, GivenBasicLightIsTurnedOnNextDeadlineIsItsTimeLeft) {
+    EXPECT_EQ(mBasicLight.nextDeadline(), hal::kForever);
+
+    mBasicLight.turnOn(1000);
+    mBasicLight.update(300);
+    EXPECT_EQ(mBasicLight.nextDeadline(), 700);
+
+    mBasicLight.turnOff();
+    EXPECT_EQ(mBasicLight.nextDeadline(), hal::kForever);
+}
+
+// A pin which is just a bit in a word, the way a GPIO output register is.
+class OutputWordPin {
+  public:
+    OutputWordPin(std::uint32_t &word, std::uint32_t mask) noexcept
+        : mWord{&word}, mMask{mask} {}
+
+    void writeValue(hal::BinaryValue value) noexcept {
+        if (value == hal::BinaryValue::HIGH) {
+            *mWord |= mMask;
+        } else {
+            *mWord &= ~mMask;
+        }
+    }
+
+  private:
+    std::uint32_t *mWord;
+    std::uint32_t mMask;
+};
+
+TEST(StaticBasicLightTests, GivenConcretePinsEachLightDrivesItsOwnBit) {
+    std::uint32_t word = ~std::uint32_t{0};
+    staircase::StaticBasicLight<OutputWordPin> first{
+        OutputWordPin{word, 0b01}};
+    staircase::StaticBasicLight<OutputWordPin> second{
+        OutputWordPin{word, 0b10}};
+    EXPECT_EQ(word & 0b11, 0);
+
+    second.turnOn(1000);
+    EXPECT_EQ(word & 0b11, 0b10);
+
+    first.turnOn(300);
+    second.update(300);
+    first.update(300);
+    EXPECT_EQ(word & 0b11, 0b10);
+    EXPECT_TRUE(first.isOff());
+    EXPECT_EQ(second.nextDeadline(), 700);
+}
+
+TEST_F(BasicLightTestsInitialization,
+       GivenStaticBasicLightIsBuiltOverTheAdapterItWritesThroughTheMock) {
+    EXPECT_CALL(mBinaryValueWriter, writeValue(hal::BinaryValue::LOW))
+        .Times(Exactly(1));
+    staircase::StaticBasicLight<hal::BinaryWriterAdapter> light{
+        mBinaryValueWriter};
+
+    EXPECT_CALL(mBinaryValueWriter, writeValue(hal::BinaryValue::HIGH))
+        .Times(Exactly(1));
+    light.turnOn();
+}
+
 } // namespace tests
\ No newline at end of file
@@ -18,22 +18,22 @@ TEST(ClippedSquaredMovingDurationCalculatorTests,
 }
 
 TEST(ClippedSquaredMovingDurationCalculatorTests,
-     GivenCalculateDeltaIsCalledWithIndex1ItReturns850) {
+     GivenCalculateDeltaIsCalledWithIndex1ItReturns750) {
     staircase::ClippedSquaredMovingDurationCalculator calculator;
-    EXPECT_EQ(calculator.calculateDelta(1, 8000), 850);
+    EXPECT_EQ(calculator.calculateDelta(1, 8000), 750);
 }
 
 TEST(ClippedSquaredMovingDurationCalculatorTests,
-     GivenCalculateDeltaIsCalledWithIndex2ItReturns1500) {
+     GivenCalculateDeltaIsCalledWithIndex2ItReturns1200) {
     staircase::ClippedSquaredMovingDurationCalculator calculator;
-    EXPECT_EQ(calculator.calculateDelta(2, 8000), 1500);
+    EXPECT_EQ(calculator.calculateDelta(2, 8000), 1200);
 }
 
 TEST(ClippedSquaredMovingDurationCalculatorTests,
      GivenCalculateDeltaIsCalledWithOtherIndexesItReturnsPercentage) {
     staircase::ClippedSquaredMovingDurationCalculator calculator;
     constexpr hal::Milliseconds delta =
-        8000 / staircase::IBasicLight::kLightsNum;
+        8000 / (staircase::IBasicLight::kLightsNum + 1);
     EXPECT_EQ(calculator.calculateDelta(3, 8000), delta);
     EXPECT_EQ(calculator.calculateDelta(4, 8000), delta);
     EXPECT_EQ(calculator.calculateDelta(5, 8000), delta);
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <hal/INTP.hxx>
+#include <hal/Timing.hxx>
+
+#include <staircase/ClockDiscipline.hxx>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+
+namespace tests {
+
+using staircase::ClockDiscipline;
+
+class ClockDisciplineTests : public ::testing::Test {
+  protected:
+    // Runs for millis in one second updates and returns the corrections.
+    hal::Milliseconds runFor(hal::Milliseconds millis) {
+        hal::Milliseconds corrected = 0;
+        for (hal::Milliseconds passed = 0; passed < millis; passed += 1000) {
+            corrected += mDiscipline.update(1000);
+        }
+
+        return corrected;
+    }
+
+    ClockDiscipline mDiscipline;
+};
+
+TEST_F(ClockDisciplineTests, GIVENFirstSampleTHENItIsStepped) {
+    EXPECT_FALSE(mDiscipline.isSynchronised());
+    EXPECT_EQ(mDiscipline.nextDeadline(), hal::kForever);
+
+    mDiscipline.addSample({-3000, 40});
+
+    EXPECT_TRUE(mDiscipline.isSynchronised());
+    EXPECT_EQ(mDiscipline.nextDeadline(), 0);
+    EXPECT_EQ(mDiscipline.update(0), -3000);
+    EXPECT_EQ(mDiscipline.nextDeadline(), hal::kForever);
+}
+
+TEST_F(ClockDisciplineTests, GIVENSmallOffsetTHENItIsSlewedAtTheLimitedRate) {
+    mDiscipline.addSample({0, 10});
+    mDiscipline.update(0);
+
+    mDiscipline.addSample({100, 10});
+
+    EXPECT_EQ(mDiscipline.nextDeadline(), 2000);
+    EXPECT_EQ(runFor(100 * 1000), 50);
+    EXPECT_EQ(runFor(100 * 1000), 50);
+    EXPECT_EQ(runFor(100 * 1000), 0);
+    EXPECT_EQ(mDiscipline.nextDeadline(), hal::kForever);
+}
+
+TEST_F(ClockDisciplineTests, GIVENLargeOffsetOnceSynchronisedTHENItIsStepped) {
+    mDiscipline.addSample({0, 10});
+    mDiscipline.update(0);
+
+    mDiscipline.addSample({ClockDiscipline::kStepThreshold + 1, 10});
+
+    EXPECT_EQ(mDiscipline.update(0), ClockDiscipline::kStepThreshold + 1);
+}
+
+TEST_F(ClockDisciplineTests, GIVENSamplesAgreeTHENThePollIntervalBacksOff) {
+    mDiscipline.addSample({0, 10});
+    for (std::uint32_t sample = 0; sample < ClockDiscipline::kAgreeingSamples;
+         ++sample) {
+        EXPECT_EQ(mDiscipline.getPollInterval(),
+                  ClockDiscipline::kMinPollInterval);
+        runFor(mDiscipline.getPollInterval());
+        mDiscipline.addSample({1, 10});
+    }
+    EXPECT_EQ(mDiscipline.getPollInterval(),
+              2 * ClockDiscipline::kMinPollInterval);
+
+    runFor(mDiscipline.getPollInterval());
+    mDiscipline.addSample({50, 10});
+    EXPECT_EQ(mDiscipline.getPollInterval(),
+              ClockDiscipline::kMinPollInterval);
+}
+
+TEST_F(ClockDisciplineTests, GIVENSlowRtcTHENItsDriftIsLearntAndCompensated) {
+    constexpr std::int32_t kDriftPpm = 120;
+    // RTC minus the true time, in milliseconds.
+    double error = -2500;
+    hal::Milliseconds untilSample = 0;
+
+    for (int second = 0; second < 12 * 60 * 60; ++second) {
+        if (untilSample <= 0) {
+            mDiscipline.addSample(
+                {static_cast<hal::Milliseconds>(std::lround(-error)), 10});
+            untilSample = mDiscipline.getPollInterval();
+        }
+
+        error += mDiscipline.update(1000) - kDriftPpm / 1000.0;
+        untilSample -= 1000;
+    }
+
+    EXPECT_NEAR(mDiscipline.getDriftPpm(), kDriftPpm, 10);
+    EXPECT_LT(std::abs(error), 3);
+    EXPECT_GT(mDiscipline.getPollInterval(),
+              4 * ClockDiscipline::kMinPollInterval);
+}
+
+} // namespace tests
\ No newline at end of file
@@ -0,0 +1,46 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <hal/Timing.hxx>
+
+#include <staircase/EWMAMovingTimeFilter.hxx>
+
+namespace tests {
+
+TEST(EWMAMovingTimeFilterTests,
+     GivenGetCurrentTimeIsCalledAfterInitializationItReturnsInitialValue) {
+    staircase::EWMAMovingTimeFilter<> timeFilter{10000};
+    EXPECT_EQ(timeFilter.getCurrentMovingTime(), 10000);
+}
+
+TEST(EWMAMovingTimeFilterTests,
+     GivenProcessNewMovingTimeIsCalledItMovesByTheSmoothingFactor) {
+    staircase::EWMAMovingTimeFilter<2> timeFilter{10000};
+
+    timeFilter.processNewMovingTime(6000);
+    EXPECT_EQ(timeFilter.getCurrentMovingTime(), 9000);
+
+    timeFilter.processNewMovingTime(6000);
+    EXPECT_EQ(timeFilter.getCurrentMovingTime(), 8250);
+}
+
+TEST(EWMAMovingTimeFilterTests,
+     GivenSameMovingTimeIsRepeatedItConvergesToItExactly) {
+    staircase::EWMAMovingTimeFilter<3> timeFilter{12000};
+
+    for (int i = 0; i < 200; ++i) {
+        timeFilter.processNewMovingTime(9001);
+    }
+    EXPECT_EQ(timeFilter.getCurrentMovingTime(), 9001);
+}
+
+TEST(EWMAMovingTimeFilterTests,
+     GivenProcessNewMovingTimeIsCalledResetReturnsToOldValue) {
+    staircase::EWMAMovingTimeFilter<> timeFilter{10000};
+
+    timeFilter.processNewMovingTime(2000);
+    timeFilter.reset(10000);
+    EXPECT_EQ(timeFilter.getCurrentMovingTime(), 10000);
+}
+
+} // namespace tests
@@ -0,0 +1,266 @@
+#include <gtest/gtest.h>
+
+#include <hal/Executor.hxx>
+#include <hal/ITask.hxx>
+#include <hal/Timing.hxx>
+
+#include <staircase/IRunnable.hxx>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace tests {
+
+// Executor on a virtual clock: sleeping only moves the clock. An open ended
+// sleep or running out of sleeps stops the loop.
+class VirtualClockExecutor final : public hal::Executor {
+  public:
+    hal::Timestamp now() const noexcept override { return clock; }
+
+    void wake() noexcept override { ++wakes; }
+
+    void park() noexcept override {
+        ++parks;
+        stop();
+    }
+
+    void sleepFor(hal::Milliseconds millis) noexcept override {
+        sleeps.push_back(millis);
+        if (millis == hal::kForever || sleeps.size() == maxSleeps) {
+            stop();
+        }
+        if (millis != hal::kForever) {
+            clock += millis;
+        }
+    }
+
+    hal::Timestamp clock = 5000;
+    std::size_t maxSleeps = 3;
+    std::uint32_t wakes = 0;
+    std::uint32_t parks = 0;
+    std::vector<hal::Milliseconds> sleeps;
+};
+
+// Logs its runs into a shared journal and takes the given time per run.
+class JournalRunnable final : public staircase::IRunnable {
+  public:
+    JournalRunnable(std::string name, VirtualClockExecutor &executor,
+                    std::vector<std::string> &journal)
+        : mName{std::move(name)}, mExecutor{executor}, mJournal{journal} {}
+
+    hal::Milliseconds nextDeadline() const noexcept override {
+        return (deadline == 0) ? IRunnable::nextDeadline() : deadline;
+    }
+
+    bool isIdle() const noexcept override { return idle; }
+
+    void run() noexcept override {
+        mJournal.push_back(mName + "@" + std::to_string(mExecutor.clock));
+        deltas.push_back(mTask->delta());
+        mExecutor.clock += cost;
+    }
+
+    // Zero for the task period.
+    hal::Milliseconds deadline = 0;
+    hal::Milliseconds cost = 0;
+    bool idle = false;
+    std::vector<hal::Milliseconds> deltas;
+
+  private:
+    std::string mName;
+    VirtualClockExecutor &mExecutor;
+    std::vector<std::string> &mJournal;
+};
+
+class ExecutorTests : public ::testing::Test {
+  protected:
+    ExecutorTests()
+        : mTick{"tick", mExecutor, mJournal},
+          mHousekeeping{"housekeeping", mExecutor, mJournal} {}
+
+    void runFor(hal::Milliseconds millis) {
+        hal::Timestamp end = mExecutor.clock + millis;
+        while (hal::elapsed(mExecutor.clock, end) > 0) {
+            if (!mExecutor.runOnce()) {
+                mExecutor.clock += 1;
+            }
+        }
+    }
+
+    VirtualClockExecutor mExecutor;
+    std::vector<std::string> mJournal;
+    JournalRunnable mTick;
+    JournalRunnable mHousekeeping;
+};
+
+TEST_F(ExecutorTests, GIVENRunnablesWithDifferentPeriodsTHENEachRunsAtItsOwn) {
+    mExecutor.add(mHousekeeping, 25, hal::Executor::Priority::BACKGROUND);
+    mExecutor.add(mTick, 10, hal::Executor::Priority::CONTROL);
+
+    runFor(51);
+
+    EXPECT_EQ(mJournal, (std::vector<std::string>{
+                            "tick@5000", "housekeeping@5000", "tick@5010",
+                            "tick@5020", "housekeeping@5025", "tick@5030",
+                            "tick@5040", "tick@5050", "housekeeping@5050"}));
+    EXPECT_EQ(mTick.deltas,
+              (std::vector<hal::Milliseconds>{0, 10, 10, 10, 10, 10}));
+    EXPECT_EQ(mHousekeeping.deltas,
+              (std::vector<hal::Milliseconds>{0, 25, 25}));
+}
+
+TEST_F(ExecutorTests, GIVENZeroPeriodTHENLateRunsCountNoMissedPeriods) {
+    auto *tick = mExecutor.add(mTick, 0, hal::Executor::Priority::CONTROL);
+    mTick.deadline = 10;
+    mTick.cost = 15;
+
+    runFor(40);
+
+    EXPECT_EQ(mJournal, (std::vector<std::string>{"tick@5000", "tick@5015",
+                                                  "tick@5030"}));
+
+    auto stats = tick->getStats();
+    EXPECT_EQ(stats.overruns, 0);
+    EXPECT_EQ(stats.missedPeriods, 0);
+    EXPECT_EQ(stats.maxLateness, 5);
+}
+
+TEST_F(ExecutorTests, GIVENBothAreDueTHENHigherPriorityRunsFirst) {
+    mExecutor.add(mHousekeeping, 10, hal::Executor::Priority::BACKGROUND);
+    mExecutor.add(mTick, 10, hal::Executor::Priority::CONTROL);
+    mHousekeeping.cost = 3;
+
+    runFor(11);
+
+    EXPECT_EQ(mJournal,
+              (std::vector<std::string>{"tick@5000", "housekeeping@5000",
+                                        "tick@5010", "housekeeping@5010"}));
+}
+
+TEST_F(ExecutorTests, GIVENLongHousekeepingTHENTickIsLateByOneRunOnly) {
+    auto *tick = mExecutor.add(mTick, 10, hal::Executor::Priority::CONTROL);
+    mExecutor.add(mHousekeeping, 1000, hal::Executor::Priority::BACKGROUND);
+    mHousekeeping.cost = 14;
+
+    runFor(40);
+
+    EXPECT_EQ(mJournal,
+              (std::vector<std::string>{"tick@5000", "housekeeping@5000",
+                                        "tick@5014", "tick@5020",
+                                        "tick@5030"}));
+    // The tick stays on its grid and its deltas add up to the real time.
+    EXPECT_EQ(mTick.deltas, (std::vector<hal::Milliseconds>{0, 14, 6, 10}));
+
+    auto stats = tick->getStats();
+    EXPECT_EQ(stats.runs, 4);
+    EXPECT_EQ(stats.maxLateness, 4);
+    EXPECT_EQ(stats.overruns, 0);
+}
+
+TEST_F(ExecutorTests, GIVENDeadlineBeyondTheWheelTHENItStillFires) {
+    constexpr auto kLong = static_cast<hal::Milliseconds>(
+        3 * hal::Executor::kWheelSize + 7);
+    mExecutor.add(mHousekeeping, kLong, hal::Executor::Priority::BACKGROUND);
+
+    ASSERT_TRUE(mExecutor.runOnce());
+    EXPECT_FALSE(mExecutor.runOnce());
+    mExecutor.clock += kLong - 1;
+    EXPECT_FALSE(mExecutor.runOnce());
+    mExecutor.clock += 1;
+    EXPECT_TRUE(mExecutor.runOnce());
+
+    EXPECT_EQ(mHousekeeping.deltas,
+              (std::vector<hal::Milliseconds>{0, kLong}));
+}
+
+TEST_F(ExecutorTests, GIVENTaskIsWokenTHENItRunsBeforeItsTimer) {
+    auto *tick = mExecutor.add(mTick, 10, hal::Executor::Priority::CONTROL);
+    mTick.deadline = 500;
+    ASSERT_TRUE(mExecutor.runOnce());
+
+    mExecutor.clock += 123;
+    tick->wake();
+
+    EXPECT_EQ(mExecutor.wakes, 1);
+    ASSERT_TRUE(mExecutor.runOnce());
+    EXPECT_EQ(mTick.deltas, (std::vector<hal::Milliseconds>{0, 123}));
+    EXPECT_EQ(tick->getStats().maxLateness, 0);
+
+    // The woken run re-armed the timer from its own start.
+    mExecutor.clock += 499;
+    EXPECT_FALSE(mExecutor.runOnce());
+    mExecutor.clock += 1;
+    EXPECT_TRUE(mExecutor.runOnce());
+}
+
+TEST_F(ExecutorTests, GIVENLoopRunsTHENItSleepsUntilTheEarliestTimer) {
+    mExecutor.add(mTick, 10, hal::Executor::Priority::CONTROL);
+    mExecutor.add(mHousekeeping, 25, hal::Executor::Priority::BACKGROUND);
+    mTick.cost = 2;
+    mTick.deadline = hal::kForever;
+
+    mExecutor.loop();
+
+    // The tick parks for a wake(), only the housekeeping timer is left.
+    EXPECT_EQ(mJournal, (std::vector<std::string>{
+                            "tick@5000", "housekeeping@5002",
+                            "housekeeping@5027", "housekeeping@5052"}));
+    EXPECT_EQ(mExecutor.sleeps, (std::vector<hal::Milliseconds>{25, 25, 25}));
+}
+
+TEST_F(ExecutorTests, GIVENNothingIsArmedTHENLoopSleepsUntilWoken) {
+    mExecutor.add(mTick, 10, hal::Executor::Priority::CONTROL);
+    mTick.deadline = hal::kForever;
+
+    mExecutor.loop();
+
+    EXPECT_EQ(mJournal, (std::vector<std::string>{"tick@5000"}));
+    EXPECT_EQ(mExecutor.sleeps,
+              (std::vector<hal::Milliseconds>{hal::kForever}));
+}
+
+TEST_F(ExecutorTests, GIVENEveryRunnableIsIdleTHENLoopParks) {
+    auto *tick = mExecutor.add(mTick, 10, hal::Executor::Priority::CONTROL);
+    auto *housekeeping =
+        mExecutor.add(mHousekeeping, 25, hal::Executor::Priority::BACKGROUND);
+    mTick.deadline = hal::kForever;
+    mTick.idle = true;
+    mHousekeeping.deadline = hal::kForever;
+    mHousekeeping.idle = true;
+
+    mExecutor.loop();
+
+    EXPECT_EQ(mJournal, (std::vector<std::string>{"tick@5000",
+                                                  "housekeeping@5000"}));
+    EXPECT_TRUE(mExecutor.sleeps.empty());
+    EXPECT_EQ(mExecutor.parks, 1);
+    EXPECT_EQ(tick->getStats().parks, 1);
+    EXPECT_EQ(housekeeping->getStats().parks, 1);
+}
+
+TEST_F(ExecutorTests, GIVENOneRunnableIsBusyTHENLoopDoesNotPark) {
+    mExecutor.add(mTick, 10, hal::Executor::Priority::CONTROL);
+    mExecutor.add(mHousekeeping, 25, hal::Executor::Priority::BACKGROUND);
+    mTick.deadline = hal::kForever;
+    mTick.idle = true;
+    mHousekeeping.deadline = hal::kForever;
+
+    mExecutor.loop();
+
+    EXPECT_EQ(mExecutor.parks, 0);
+    EXPECT_EQ(mExecutor.sleeps,
+              (std::vector<hal::Milliseconds>{hal::kForever}));
+}
+
+TEST_F(ExecutorTests, GIVENTooManyRunnablesTHENAddFails) {
+    for (std::size_t index = 0; index < hal::Executor::kMaxTasks; ++index) {
+        EXPECT_NE(mExecutor.add(mTick, 10, hal::Executor::Priority::NORMAL),
+                  nullptr);
+    }
+
+    EXPECT_EQ(mExecutor.add(mTick, 10, hal::Executor::Priority::NORMAL),
+              nullptr);
+}
+
+} // namespace tests
\ No newline at end of file
@@ -0,0 +1,374 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <mocks/BinaryValueWriterMock.hxx>
+#include <mocks/MovingDurationCalculatorMock.hxx>
+#include <mocks/MovingTimeFilterMock.hxx>
+
+#include <hal/BinaryValue.hxx>
+#include <hal/IBinaryValueReader.hxx>
+#include <hal/ITask.hxx>
+#include <hal/Timing.hxx>
+
+#include <staircase/BasicLight.hxx>
+#include <staircase/BasicMovingFactory.hxx>
+#include <staircase/IBasicLight.hxx>
+#include <staircase/IRunnable.hxx>
+#include <staircase/IStaircaseLooper.hxx>
+#include <staircase/ProximitySensor.hxx>
+#include <staircase/StaircaseLooper.hxx>
+#include <staircase/StaticProximitySensor.hxx>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace tests {
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+// Task on a virtual clock: sleeping only moves the clock.
+class VirtualClockTask final : public hal::ITask {
+  public:
+    VirtualClockTask(staircase::IRunnable &runnable, hal::Milliseconds period)
+        : ITask{runnable, period} {}
+
+    hal::Milliseconds getDelta() const noexcept override { return mPeriod; }
+    hal::Timestamp now() const noexcept override { return clock; }
+
+    hal::Timestamp clock = 1000;
+    // How long an open ended sleep lasts before the sensor wakes it.
+    hal::Milliseconds wakeAfter = 0;
+    std::vector<hal::Milliseconds> sleeps;
+    // Simulated sensor edges which end a park, in time order.
+    std::vector<hal::Timestamp> edges;
+    std::size_t nextEdge = 0;
+
+  protected:
+    void sleep() noexcept override { sleepFor(mPeriod); }
+
+    void sleepFor(hal::Milliseconds millis) noexcept override {
+        sleeps.push_back(millis);
+        clock += (millis == hal::kForever) ? wakeAfter : millis;
+    }
+
+    void park() noexcept override {
+        if (nextEdge < edges.size()) {
+            clock = edges[nextEdge++];
+        }
+    }
+};
+
+// Records the delta of every run, takes the given time to run and stops the
+// task after the given number of runs.
+class ScriptedRunnable final : public staircase::IRunnable {
+  public:
+    explicit ScriptedRunnable(VirtualClockTask *&task) : mClockTask{task} {}
+
+    hal::Milliseconds nextDeadline() const noexcept override {
+        return deadline;
+    }
+
+    bool isIdle() const noexcept override {
+        return deltas.size() <= idleRuns;
+    }
+
+    void run() noexcept override {
+        deltas.push_back(mTask->delta());
+        auto index = deltas.size() - 1;
+        mClockTask->clock += (index < costs.size()) ? costs[index] : 0;
+        if (deltas.size() == stopAfter) {
+            mTask->stop();
+        }
+    }
+
+    std::vector<hal::Milliseconds> deltas;
+    // Run time of each run, zero past the end.
+    std::vector<hal::Milliseconds> costs;
+    hal::Milliseconds deadline = 10;
+    // Idle after each of the first idleRuns runs.
+    std::size_t idleRuns = 0;
+    std::size_t stopAfter = 5;
+
+  private:
+    VirtualClockTask *&mClockTask;
+};
+
+class ITaskTests : public ::testing::Test {
+  protected:
+    static constexpr hal::Milliseconds kPeriod = 10;
+
+    ITaskTests() : mRunnable{mTaskPtr}, mTask{mRunnable, kPeriod} {
+        mTaskPtr = &mTask;
+    }
+
+    VirtualClockTask *mTaskPtr = nullptr;
+    ScriptedRunnable mRunnable;
+    VirtualClockTask mTask;
+};
+
+TEST_F(ITaskTests, GIVENStopIsCalledBeforeLoopTHENLoopReturnsAtOnce) {
+    mTask.stop();
+    mTask.loop();
+
+    EXPECT_FALSE(mTask.isRunning());
+    EXPECT_TRUE(mRunnable.deltas.empty());
+}
+
+TEST_F(ITaskTests, GIVENRelativeModeTHENRunTimeAddsUpToDrift) {
+    mRunnable.costs = {3, 3, 3, 3, 3};
+
+    mTask.loop();
+
+    EXPECT_EQ(mTask.sleeps, (std::vector<hal::Milliseconds>{10, 10, 10, 10}));
+    EXPECT_EQ(mTask.clock, 1000 + 5 * 3 + 4 * 10);
+    EXPECT_EQ(mTask.getStats().runs, 5);
+}
+
+TEST_F(ITaskTests, GIVENDeadlineModeTHENRunsStayOnThePeriodGrid) {
+    mRunnable.costs = {3, 3, 3, 3, 3};
+    mTask.setDeadlineMode(hal::ITask::OverrunPolicy::COALESCE);
+
+    mTask.loop();
+
+    EXPECT_EQ(mTask.sleeps, (std::vector<hal::Milliseconds>{7, 7, 7, 7}));
+    EXPECT_EQ(mRunnable.deltas,
+              (std::vector<hal::Milliseconds>{0, 10, 10, 10, 10}));
+    EXPECT_EQ(mTask.clock, 1000 + 4 * 10 + 3);
+
+    auto stats = mTask.getStats();
+    EXPECT_EQ(stats.runs, 5);
+    EXPECT_EQ(stats.overruns, 0);
+    EXPECT_EQ(stats.maxLateness, 0);
+}
+
+TEST_F(ITaskTests, GIVENOverrunWithCoalesceTHENOneRunGetsAllTheTime) {
+    mRunnable.costs = {0, 25};
+    mTask.setDeadlineMode(hal::ITask::OverrunPolicy::COALESCE);
+
+    mTask.loop();
+
+    EXPECT_EQ(mRunnable.deltas,
+              (std::vector<hal::Milliseconds>{0, 10, 25, 5, 10}));
+
+    auto stats = mTask.getStats();
+    EXPECT_EQ(stats.overruns, 1);
+    EXPECT_EQ(stats.missedPeriods, 1);
+    EXPECT_EQ(stats.maxLateness, 15);
+}
+
+TEST_F(ITaskTests, GIVENZeroPeriodTHENReleasesFollowTheDeadlineAlone) {
+    VirtualClockTask *taskPtr = nullptr;
+    ScriptedRunnable runnable{taskPtr};
+    VirtualClockTask task{runnable, 0};
+    taskPtr = &task;
+    runnable.costs = {3, 25};
+    task.setDeadlineMode(hal::ITask::OverrunPolicy::REPLAY);
+
+    task.loop();
+
+    EXPECT_EQ(runnable.deltas,
+              (std::vector<hal::Milliseconds>{0, 10, 25, 10, 10}));
+
+    auto stats = task.getStats();
+    EXPECT_EQ(stats.runs, 5);
+    EXPECT_EQ(stats.overruns, 0);
+    EXPECT_EQ(stats.maxLateness, 15);
+}
+
+TEST_F(ITaskTests, GIVENOverrunWithReplayTHENMissedPeriodsAreRunOneByOne) {
+    mRunnable.costs = {0, 25};
+    mTask.setDeadlineMode(hal::ITask::OverrunPolicy::REPLAY);
+
+    mTask.loop();
+
+    EXPECT_EQ(mRunnable.deltas,
+              (std::vector<hal::Milliseconds>{0, 10, 10, 15, 5}));
+    EXPECT_EQ(mTask.getStats().missedPeriods, 1);
+}
+
+TEST_F(ITaskTests, GIVENOverrunWithSkipTHENMissedPeriodsAreLeftOut) {
+    mRunnable.costs = {0, 25};
+    mTask.setDeadlineMode(hal::ITask::OverrunPolicy::SKIP);
+
+    mTask.loop();
+
+    EXPECT_EQ(mRunnable.deltas,
+              (std::vector<hal::Milliseconds>{0, 10, 15, 5, 10}));
+    EXPECT_EQ(mTask.getStats().overruns, 1);
+}
+
+TEST_F(ITaskTests, GIVENLongReplayTHENItIsCappedAndTheRestCoalesced) {
+    constexpr auto kMissed = hal::ITask::kMaxReplays + 4;
+    mRunnable.costs = {0, kPeriod * (kMissed + 1)};
+    mRunnable.stopAfter = 2 + hal::ITask::kMaxReplays + 1;
+    mTask.setDeadlineMode(hal::ITask::OverrunPolicy::REPLAY);
+
+    mTask.loop();
+
+    ASSERT_EQ(mRunnable.deltas.size(), mRunnable.stopAfter);
+    EXPECT_EQ(mTask.getStats().missedPeriods, kMissed);
+    EXPECT_EQ(mRunnable.deltas[2], kPeriod);
+    EXPECT_EQ(mRunnable.deltas[1 + hal::ITask::kMaxReplays], kPeriod);
+    EXPECT_EQ(mRunnable.deltas.back(),
+              kPeriod * (kMissed + 1 - hal::ITask::kMaxReplays));
+}
+
+TEST_F(ITaskTests, GIVENNoDeadlineTHENTheGridRestartsAfterTheWake) {
+    mRunnable.deadline = hal::kForever;
+    mTask.wakeAfter = 1234;
+    mTask.setDeadlineMode(hal::ITask::OverrunPolicy::COALESCE);
+
+    mTask.loop();
+
+    EXPECT_EQ(mRunnable.deltas,
+              (std::vector<hal::Milliseconds>{0, 1234, 1234, 1234, 1234}));
+    EXPECT_EQ(mTask.getStats().overruns, 0);
+    EXPECT_EQ(mTask.getStats().maxLateness, 0);
+}
+
+TEST_F(ITaskTests, GIVENRunnableIsIdleTHENTaskParksInsteadOfSleeping) {
+    mRunnable.idleRuns = 5;
+    mTask.edges = {1500, 4000, 4005, 9000};
+
+    mTask.loop();
+
+    EXPECT_TRUE(mTask.sleeps.empty());
+    EXPECT_EQ(mTask.clock, 9000);
+    EXPECT_EQ(mTask.getStats().parks, 4);
+    EXPECT_EQ(mTask.getStats().runs, 5);
+}
+
+TEST_F(ITaskTests, GIVENDeadlineModeTHENParkedTimeIsInTheNextDelta) {
+    mRunnable.idleRuns = 4;
+    mTask.edges = {1500, 4000, 4005};
+    mRunnable.stopAfter = 4;
+    mTask.setDeadlineMode(hal::ITask::OverrunPolicy::REPLAY);
+
+    mTask.loop();
+
+    EXPECT_EQ(mRunnable.deltas,
+              (std::vector<hal::Milliseconds>{0, 500, 2500, 5}));
+    EXPECT_EQ(mTask.getStats().overruns, 0);
+    EXPECT_EQ(mTask.getStats().parks, 3);
+}
+
+TEST_F(ITaskTests, GIVENRunnableTurnsBusyAfterTheWakeTHENTheGridStartsThere) {
+    mRunnable.idleRuns = 1;
+    mTask.edges = {1503};
+    mRunnable.stopAfter = 4;
+    mTask.setDeadlineMode(hal::ITask::OverrunPolicy::COALESCE);
+
+    mTask.loop();
+
+    EXPECT_EQ(mRunnable.deltas,
+              (std::vector<hal::Milliseconds>{0, 503, 10, 10}));
+    EXPECT_EQ(mTask.sleeps, (std::vector<hal::Milliseconds>{10, 10}));
+    EXPECT_EQ(mTask.getStats().parks, 1);
+}
+
+// Pin whose level the test sets.
+class LevelPin final : public hal::IBinaryValueReader {
+  public:
+    hal::BinaryValue readValue() noexcept override { return value; }
+
+    hal::BinaryValue value = hal::BinaryValue::LOW;
+};
+
+// Runs a looper, raises the up pin once the clock reaches raiseAt and stops
+// the task when a moving has started or after maxRuns runs.
+class PolledLooperRunnable final : public staircase::IRunnable {
+  public:
+    PolledLooperRunnable(VirtualClockTask *&task,
+                         staircase::IStaircaseLooper &looper, LevelPin &pin)
+        : mClockTask{task}, mLooper{looper}, mPin{pin} {}
+
+    hal::Milliseconds nextDeadline() const noexcept override {
+        return mLooper.nextDeadline();
+    }
+
+    bool isIdle() const noexcept override { return mLooper.isIdle(); }
+
+    void run() noexcept override {
+        if (mClockTask->clock >= raiseAt) {
+            mPin.value = hal::BinaryValue::HIGH;
+        }
+        mLooper.update(mTask->delta());
+        ++runs;
+        if (mLooper.snapshot().downMovings.count > 0 || runs == maxRuns) {
+            mTask->stop();
+        }
+    }
+
+    hal::Timestamp raiseAt = 5000;
+    std::size_t runs = 0;
+    std::size_t maxRuns = 10000;
+
+  private:
+    VirtualClockTask *&mClockTask;
+    staircase::IStaircaseLooper &mLooper;
+    LevelPin &mPin;
+};
+
+// A real looper on polled sensors: no interrupt ever wakes the task, so it
+// has to keep sampling the pins while nothing else is going on.
+class ITaskPolledLooperTests : public ::testing::Test {
+  protected:
+    ITaskPolledLooperTests()
+        : mLights{mWriters[0], mWriters[1], mWriters[2], mWriters[3],
+                  mWriters[4], mWriters[5], mWriters[6], mWriters[7]},
+          mLightRefs{mLights[0], mLights[1], mLights[2], mLights[3],
+                     mLights[4], mLights[5], mLights[6], mLights[7]},
+          mDownSensor{mDownPin}, mUpSensor{mUpPin},
+          mLooper{mLightRefs,      mDownSensor,         mUpSensor,
+                  mMovingFactory,  mDurationCalculator, mDownFilter,
+                  mUpFilter},
+          mRunnable{mTaskPtr, mLooper, mUpPin}, mTask{mRunnable, 0} {
+        mTaskPtr = &mTask;
+        ON_CALL(mDurationCalculator, calculateDelta(_, _))
+            .WillByDefault(Return(500));
+        ON_CALL(mDownFilter, getCurrentMovingTime())
+            .WillByDefault(Return(4000));
+        mTask.setDeadlineMode(hal::ITask::OverrunPolicy::COALESCE);
+    }
+
+    std::array<NiceMock<mocks::BinaryValueWriterMock>,
+               staircase::IBasicLight::kLightsNum>
+        mWriters;
+    std::array<staircase::BasicLight, staircase::IBasicLight::kLightsNum>
+        mLights;
+    staircase::BasicLights mLightRefs;
+    LevelPin mDownPin;
+    LevelPin mUpPin;
+    staircase::ProximitySensor mDownSensor;
+    staircase::ProximitySensor mUpSensor;
+    staircase::BasicMovingFactory mMovingFactory;
+    NiceMock<mocks::MovingDurationCalculatorMock> mDurationCalculator;
+    NiceMock<mocks::MovingTimeFilterMock> mDownFilter;
+    NiceMock<mocks::MovingTimeFilterMock> mUpFilter;
+    staircase::StaircaseLooper mLooper;
+    VirtualClockTask *mTaskPtr = nullptr;
+    PolledLooperRunnable mRunnable;
+    VirtualClockTask mTask;
+};
+
+TEST_F(ITaskPolledLooperTests,
+       GIVENLooperHasNothingToDoTHENPolledPinIsStillSampledAndStartsAMoving) {
+    mTask.loop();
+
+    EXPECT_EQ(mLooper.snapshot().downMovings.count, 1);
+    EXPECT_EQ(mTask.getStats().parks, 0);
+    EXPECT_LE(mTask.clock, mRunnable.raiseAt + DEBOUNCE_PERIOD +
+                               2 * staircase::kSensorSamplePeriod);
+}
+
+TEST_F(ITaskPolledLooperTests, GIVENSensorsArePolledTHENLooperIsNeverIdle) {
+    mLooper.update(1000);
+
+    EXPECT_EQ(mLooper.nextDeadline(), staircase::kSensorSamplePeriod);
+    EXPECT_FALSE(mLooper.isIdle());
+}
+
+} // namespace tests
@@ -0,0 +1,181 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <mocks/BinaryPortWriterMock.hxx>
+
+#include <hal/IBinaryPortWriter.hxx>
+#include <hal/Timing.hxx>
+
+#include <staircase/IBasicLight.hxx>
+#include <staircase/LightBank.hxx>
+
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace tests {
+
+using ::testing::_;
+using ::testing::Exactly;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+
+class LightBankTests : public ::testing::Test {
+  protected:
+    static constexpr std::size_t kLightsNum = 40;
+
+    void expectWrite(std::vector<hal::IBinaryPortWriter::Word> expected) {
+        EXPECT_CALL(mPortWriter, writePort(_))
+            .WillOnce(Invoke([expected](auto values) {
+                EXPECT_TRUE(std::equal(std::begin(values), std::end(values),
+                                       std::begin(expected),
+                                       std::end(expected)));
+            }));
+    }
+
+    NiceMock<mocks::BinaryPortWriterMock> mPortWriter;
+    staircase::LightBank<kLightsNum> mLightBank{mPortWriter};
+};
+
+TEST_F(LightBankTests, GivenLightBankIsCreatedAllLightsAreOff) {
+    for (std::size_t index = 0; index < kLightsNum; ++index) {
+        EXPECT_FALSE(mLightBank.isOn(index));
+        EXPECT_TRUE(mLightBank.getLights()[index].get().isOff());
+    }
+}
+
+TEST_F(LightBankTests, GivenLightIsTurnedOnItStaysOnUntilItsTimeExpires) {
+    mLightBank.turnOn(3, 1000);
+
+    mLightBank.update(600);
+    EXPECT_TRUE(mLightBank.isOn(3));
+
+    mLightBank.update(400);
+    EXPECT_FALSE(mLightBank.isOn(3));
+}
+
+TEST_F(LightBankTests, GivenLightIsTurnedOnByDefaultItUsesDefaultPeriod) {
+    mLightBank.getLights()[5].get().turnOn();
+
+    mLightBank.update(staircase::IBasicLight::kDefaultOnPeriod - 1);
+    EXPECT_TRUE(mLightBank.isOn(5));
+
+    mLightBank.update(1);
+    EXPECT_FALSE(mLightBank.isOn(5));
+}
+
+TEST_F(LightBankTests, GivenLightIsTurnedOnAgainTheLongerTimeIsKept) {
+    mLightBank.turnOn(1, 1000);
+    mLightBank.turnOn(1, 300);
+
+    mLightBank.update(500);
+    EXPECT_TRUE(mLightBank.isOn(1));
+
+    mLightBank.turnOn(1, 2000);
+    mLightBank.update(1500);
+    EXPECT_TRUE(mLightBank.isOn(1));
+
+    mLightBank.update(500);
+    EXPECT_FALSE(mLightBank.isOn(1));
+}
+
+TEST_F(LightBankTests, GivenLightIsTurnedOnForeverItNeverExpires) {
+    mLightBank.turnOn(7, hal::kForever);
+
+    mLightBank.update(1000000);
+    EXPECT_TRUE(mLightBank.isOn(7));
+
+    mLightBank.turnOff(7);
+    EXPECT_FALSE(mLightBank.isOn(7));
+}
+
+TEST_F(LightBankTests, GivenSingleLightIsUpdatedOnlyThatLightChanges) {
+    mLightBank.turnOn(0, 100);
+    mLightBank.turnOn(1, 100);
+
+    mLightBank.getLights()[0].get().update(100);
+
+    EXPECT_FALSE(mLightBank.isOn(0));
+    EXPECT_TRUE(mLightBank.isOn(1));
+}
+
+TEST_F(LightBankTests, GivenLightsInSeveralWordsChangeFlushWritesAllWords) {
+    mLightBank.turnOn(0, 100);
+    mLightBank.turnOn(33, 500);
+
+    expectWrite({0b1, 0b10});
+    mLightBank.flush();
+
+    expectWrite({0, 0b10});
+    mLightBank.update(200);
+    mLightBank.flush();
+}
+
+TEST_F(LightBankTests, GivenNothingChangedWithinATickFlushDoesNotWrite) {
+    mLightBank.turnOn(2, 100);
+    mLightBank.flush();
+
+    EXPECT_CALL(mPortWriter, writePort(_)).Times(Exactly(0));
+
+    mLightBank.update(100);
+    mLightBank.turnOn(2);
+    mLightBank.turnOn(2);
+    mLightBank.flush();
+}
+
+TEST_F(LightBankTests, GivenLightsAreOnNextDeadlineIsTheEarliestExpiry) {
+    EXPECT_EQ(mLightBank.nextDeadline(), hal::kForever);
+
+    mLightBank.turnOn(3, 800);
+    mLightBank.turnOn(39, 300);
+    mLightBank.turnOn(7, hal::kForever);
+    EXPECT_EQ(mLightBank.nextDeadline(), 300);
+    EXPECT_EQ(mLightBank.nextDeadline(7), hal::kForever);
+
+    mLightBank.update(300);
+    EXPECT_EQ(mLightBank.nextDeadline(), 500);
+}
+
+TEST_F(LightBankTests, GivenEarliestLightIsReArmedDeadlineIsNeverLate) {
+    mLightBank.turnOn(0, 100);
+    mLightBank.turnOn(1, 500);
+    mLightBank.turnOn(0, 1000);
+    EXPECT_LE(mLightBank.nextDeadline(), 100);
+
+    mLightBank.update(100);
+    EXPECT_TRUE(mLightBank.isOn(0));
+    EXPECT_EQ(mLightBank.nextDeadline(), 400);
+    EXPECT_EQ(mLightBank.nextDeadline(0), 900);
+
+    mLightBank.update(400);
+    EXPECT_FALSE(mLightBank.isOn(1));
+    EXPECT_EQ(mLightBank.nextDeadline(), 500);
+}
+
+TEST_F(LightBankTests, GivenForeverLightGetsATimerItStaysOnWhenTheTimerEnds) {
+    mLightBank.turnOn(4, hal::kForever);
+    mLightBank.turnOn(4, 200);
+
+    mLightBank.update(200);
+    EXPECT_TRUE(mLightBank.isOn(4));
+    EXPECT_EQ(mLightBank.nextDeadline(), hal::kForever);
+}
+
+TEST_F(LightBankTests, GivenBankClockWrapsTimersStillExpireOnTime) {
+    mLightBank.update(std::numeric_limits<hal::Milliseconds>::max());
+    mLightBank.update(std::numeric_limits<hal::Milliseconds>::max());
+    mLightBank.update(1000);
+
+    mLightBank.turnOn(2, 1000);
+    mLightBank.turnOn(3, 3000);
+    mLightBank.update(999);
+    EXPECT_TRUE(mLightBank.isOn(2));
+
+    mLightBank.update(1);
+    EXPECT_FALSE(mLightBank.isOn(2));
+    EXPECT_TRUE(mLightBank.isOn(3));
+    EXPECT_EQ(mLightBank.nextDeadline(), 2000);
+}
+
+} // namespace tests
@@ -0,0 +1,104 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <mocks/BinaryPortWriterMock.hxx>
+
+#include <hal/BinaryValue.hxx>
+#include <hal/IBinaryPortWriter.hxx>
+
+#include <staircase/BasicLight.hxx>
+#include <staircase/IBasicLight.hxx>
+#include <staircase/LightPort.hxx>
+
+#include <span>
+#include <vector>
+
+namespace tests {
+
+using ::testing::_;
+using ::testing::Exactly;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+
+class LightPortTestsInitialization : public ::testing::Test {
+  protected:
+    NiceMock<mocks::BinaryPortWriterMock> mPortWriter;
+};
+
+TEST_F(LightPortTestsInitialization, GivenLightPortIsCreatedAllOutputsAreLow) {
+    EXPECT_CALL(mPortWriter, writePort(_))
+        .WillOnce(Invoke([](auto values) {
+            for (auto value : values) {
+                EXPECT_EQ(value, 0);
+            }
+        }));
+
+    staircase::LightPort lightPort{mPortWriter};
+}
+
+class LightPortTests : public LightPortTestsInitialization {
+  protected:
+    void expectWrite(std::vector<hal::IBinaryPortWriter::Word> expected) {
+        EXPECT_CALL(mPortWriter, writePort(_))
+            .WillOnce(Invoke([expected](auto values) {
+                EXPECT_TRUE(std::equal(std::begin(values), std::end(values),
+                                       std::begin(expected),
+                                       std::end(expected)));
+            }));
+    }
+
+    staircase::LightPort mLightPort{mPortWriter};
+};
+
+TEST_F(LightPortTests, GivenNothingChangedFlushDoesNotWrite) {
+    EXPECT_CALL(mPortWriter, writePort(_)).Times(Exactly(0));
+
+    mLightPort.flush();
+}
+
+TEST_F(LightPortTests, GivenPinsAreWrittenTheyAreOnlyMarkedUntilFlush) {
+    EXPECT_CALL(mPortWriter, writePort(_)).Times(Exactly(0));
+
+    mLightPort.getPin(0).writeValue(hal::BinaryValue::HIGH);
+    mLightPort.getPin(2).writeValue(hal::BinaryValue::HIGH);
+
+    EXPECT_TRUE(mLightPort.isSet(0));
+    EXPECT_FALSE(mLightPort.isSet(1));
+    EXPECT_TRUE(mLightPort.isSet(2));
+    EXPECT_TRUE(mLightPort.isDirty());
+}
+
+TEST_F(LightPortTests, GivenSeveralPinsChangedFlushWritesThemAllAtOnce) {
+    expectWrite({0b101});
+
+    mLightPort.getPin(0).writeValue(hal::BinaryValue::HIGH);
+    mLightPort.getPin(2).writeValue(hal::BinaryValue::HIGH);
+    mLightPort.flush();
+
+    EXPECT_FALSE(mLightPort.isDirty());
+}
+
+TEST_F(LightPortTests, GivenPinTogglesBackWithinATickFlushDoesNotWrite) {
+    EXPECT_CALL(mPortWriter, writePort(_)).Times(Exactly(0));
+
+    mLightPort.getPin(1).writeValue(hal::BinaryValue::HIGH);
+    mLightPort.getPin(1).writeValue(hal::BinaryValue::LOW);
+    mLightPort.flush();
+}
+
+TEST_F(LightPortTests, GivenBasicLightsOnPinsTurnOnsAreCoalesced) {
+    staircase::BasicLight first{mLightPort.getPin(0)};
+    staircase::BasicLight last{
+        mLightPort.getPin(staircase::IBasicLight::kLightsNum - 1)};
+
+    expectWrite({hal::IBinaryPortWriter::Word{1}
+                 << (staircase::IBasicLight::kLightsNum - 1)});
+
+    last.turnOn();
+    last.turnOn(5000);
+    last.turnOn();
+    mLightPort.flush();
+    mLightPort.flush();
+}
+
+} // namespace tests
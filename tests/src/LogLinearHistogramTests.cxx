@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <util/LogLinearHistogram.hxx>
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <thread>
+
+namespace tests {
+
+using Histogram = util::LogLinearHistogram<4>;
+
+TEST(LogLinearHistogramTests, SmallValuesGetABucketEach) {
+    for (std::uint32_t value = 0; value < Histogram::kSubBucketsNum;
+         ++value) {
+        EXPECT_EQ(Histogram::bucketOf(value), value);
+        EXPECT_EQ(Histogram::bucketLimit(value), value);
+    }
+}
+
+TEST(LogLinearHistogramTests, BucketsCoverEveryValueWithBoundedError) {
+    constexpr std::uint32_t kValues[] = {
+        16,     17,      18,         31,         32,        35,
+        36,     1000,    12345,      1u << 20,   (1u << 20) - 1,
+        999999, 8000000, 0x7FFFFFFF, 0x80000000, 0xFFFFFFFF};
+
+    for (auto value : kValues) {
+        auto bucket = Histogram::bucketOf(value);
+        ASSERT_LT(bucket, Histogram::kBucketsNum);
+        auto limit = Histogram::bucketLimit(bucket);
+        EXPECT_GE(limit, value);
+        // Within one eighth with four sub-bucket bits.
+        EXPECT_LE(limit - value, value / 8);
+        EXPECT_EQ(Histogram::bucketOf(limit), bucket);
+    }
+
+    EXPECT_EQ(Histogram::bucketOf(std::numeric_limits<std::uint32_t>::max()),
+              Histogram::kBucketsNum - 1);
+}
+
+TEST(LogLinearHistogramTests, EmptyHistogramReportsZeros) {
+    auto histogram = std::make_unique<Histogram>();
+
+    auto summary = histogram->summary();
+    EXPECT_EQ(summary.count, 0);
+    EXPECT_EQ(summary.p50, 0);
+    EXPECT_EQ(summary.p99, 0);
+    EXPECT_EQ(summary.max, 0);
+}
+
+TEST(LogLinearHistogramTests, PercentilesFollowTheRecordedDistribution) {
+    auto histogram = std::make_unique<Histogram>();
+
+    for (std::uint32_t value = 1; value <= 1000; ++value) {
+        histogram->record(value);
+    }
+
+    auto summary = histogram->summary();
+    EXPECT_EQ(summary.count, 1000);
+    EXPECT_GE(summary.p50, 500);
+    EXPECT_LE(summary.p50, 500 + 500 / 8);
+    EXPECT_GE(summary.p99, 990);
+    EXPECT_LE(summary.p99, 1000);
+    EXPECT_EQ(summary.max, 1000);
+    EXPECT_EQ(histogram->valueAt(1000), 1000);
+    EXPECT_EQ(histogram->valueAt(0), 1);
+}
+
+TEST(LogLinearHistogramTests, RareOutlierOnlyShowsInTheMaximum) {
+    auto histogram = std::make_unique<Histogram>();
+
+    for (int i = 0; i < 999; ++i) {
+        histogram->record(10);
+    }
+    histogram->record(100000);
+
+    auto summary = histogram->summary();
+    EXPECT_EQ(summary.p50, 10);
+    EXPECT_EQ(summary.p99, 10);
+    EXPECT_EQ(summary.max, 100000);
+}
+
+TEST(LogLinearHistogramTests, ResetForgetsEverySample) {
+    auto histogram = std::make_unique<Histogram>();
+    histogram->record(42);
+
+    histogram->reset();
+
+    EXPECT_EQ(histogram->count(), 0);
+    EXPECT_EQ(histogram->max(), 0);
+    EXPECT_EQ(histogram->summary().count, 0);
+}
+
+TEST(LogLinearHistogramTests, ConcurrentReaderSeesAConsistentSummary) {
+    constexpr std::uint32_t kSamples = 200000;
+    auto histogram = std::make_unique<Histogram>();
+    std::atomic_bool done{false};
+
+    std::thread reader{[&histogram, &done]() {
+        while (!done.load()) {
+            auto summary = histogram->summary();
+            ASSERT_LE(summary.p50, summary.p99);
+            ASSERT_LE(summary.p99, 1000);
+            std::this_thread::yield();
+        }
+    }};
+
+    for (std::uint32_t i = 0; i < kSamples; ++i) {
+        histogram->record(i % 1000);
+    }
+    done.store(true);
+    reader.join();
+
+    EXPECT_EQ(histogram->summary().count, kSamples);
+}
+
+} // namespace tests
\ No newline at end of file
@@ -0,0 +1,239 @@
+#include <gtest/gtest.h>
+
+#include <hal/IPersistence.hxx>
+#include <hal/IStorage.hxx>
+
+#include <staircase/LogStore.hxx>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace tests {
+
+// NOR-like flash in RAM: writes can only clear bits and stop short once the
+// write budget is spent, as if power was lost.
+class FlashStorage final : public hal::IStorage {
+  public:
+    static constexpr std::size_t kUnlimited =
+        std::numeric_limits<std::size_t>::max();
+
+    FlashStorage(std::size_t size, std::size_t sectorSize)
+        : mData(size, kErased), mSectorSize{sectorSize},
+          mWriteBudget{kUnlimited}, mWritten{0} {}
+
+    void setWriteBudget(std::size_t bytes) { mWriteBudget = bytes; }
+    std::size_t written() const { return mWritten; }
+
+    std::size_t size() const noexcept override { return mData.size(); }
+    std::size_t sectorSize() const noexcept override { return mSectorSize; }
+
+    bool read(std::size_t offset,
+              std::span<std::byte> data) const noexcept override {
+        if (offset + data.size() > mData.size()) {
+            return false;
+        }
+        std::copy_n(mData.begin() + offset, data.size(), data.begin());
+        return true;
+    }
+
+    bool write(std::size_t offset,
+               std::span<const std::byte> data) noexcept override {
+        if (offset + data.size() > mData.size()) {
+            return false;
+        }
+        auto length = std::min(data.size(), mWriteBudget);
+        for (std::size_t index = 0; index < length; ++index) {
+            mData[offset + index] &= data[index];
+        }
+        if (mWriteBudget != kUnlimited) {
+            mWriteBudget -= length;
+        }
+        mWritten += length;
+        return length == data.size();
+    }
+
+    bool erase(std::size_t offset, std::size_t length) noexcept override {
+        if (mWriteBudget == 0 || offset % mSectorSize != 0 ||
+            length % mSectorSize != 0 || offset + length > mData.size()) {
+            return false;
+        }
+        std::fill_n(mData.begin() + offset, length, kErased);
+        return true;
+    }
+
+  private:
+    std::vector<std::byte> mData;
+    std::size_t mSectorSize;
+    std::size_t mWriteBudget;
+    std::size_t mWritten;
+};
+
+class LogStoreTests : public ::testing::Test {
+  public:
+    LogStoreTests() : mStorage{kStorageSize, kSectorSize}, mStore{mStorage} {}
+
+    void SetUp() override { ASSERT_TRUE(mStore.mount()); }
+
+    std::optional<std::int32_t> remountAndGet(const std::string &key) {
+        staircase::LogStore store{mStorage};
+        EXPECT_TRUE(store.mount());
+        return store.tryGet(key);
+    }
+
+  protected:
+    static constexpr std::size_t kSectorSize = 512;
+    static constexpr std::size_t kStorageSize = 8 * kSectorSize;
+
+    FlashStorage mStorage;
+    staircase::LogStore mStore;
+};
+
+TEST_F(LogStoreTests, GIVENStorageIsErasedTHENItIsFormattedEmpty) {
+    EXPECT_EQ(mStore.keysNum(), 0);
+    EXPECT_FALSE(mStore.keyExists("down_time"));
+    EXPECT_EQ(mStore.tryGet("down_time"), std::nullopt);
+    EXPECT_EQ(mStore.getValue("down_time"), 0);
+}
+
+TEST_F(LogStoreTests, GIVENValueIsSetTHENItIsReadBackAfterRemount) {
+    mStore.setValue("down_time", 9000);
+    mStore.setValue("up_time", -5);
+    mStore.setValue("down_time", 9500);
+
+    EXPECT_EQ(mStore.tryGet("down_time"), 9500);
+    EXPECT_EQ(remountAndGet("down_time"), 9500);
+    EXPECT_EQ(remountAndGet("up_time"), -5);
+}
+
+TEST_F(LogStoreTests, GIVENBatchIsSetTHENItIsReadBackInOneBatch) {
+    std::array<hal::IPersistence::Entry, 3> entries{{
+        {"a", 1, false},
+        {"b", 2, false},
+        {"c", 3, false},
+    }};
+    mStore.setValues(entries);
+
+    std::array<hal::IPersistence::Entry, 2> lookup{{
+        {"c", 0, false},
+        {"missing", 0, false},
+    }};
+    mStore.getValues(lookup);
+    EXPECT_TRUE(lookup[0].found);
+    EXPECT_EQ(lookup[0].value, 3);
+    EXPECT_FALSE(lookup[1].found);
+}
+
+TEST_F(LogStoreTests, GIVENValueIsUnchangedTHENNothingIsAppended) {
+    mStore.setValue("a", 1);
+    auto used = mStore.usedBytes();
+    auto written = mStorage.written();
+
+    mStore.setValue("a", 1);
+
+    EXPECT_EQ(mStore.usedBytes(), used);
+    EXPECT_EQ(mStorage.written(), written);
+}
+
+TEST_F(LogStoreTests, GIVENKeyIsTooLongOrThereAreTooManyTHENItIsDropped) {
+    mStore.setValue("a_key_which_is_too_long", 1);
+    EXPECT_EQ(mStore.keysNum(), 0);
+
+    for (std::size_t index = 0; index < staircase::LogStore::kMaxKeys + 2;
+         ++index) {
+        mStore.setValue("key" + std::to_string(index), 1);
+    }
+    EXPECT_EQ(mStore.keysNum(), staircase::LogStore::kMaxKeys);
+    EXPECT_FALSE(mStore.keyExists(
+        "key" + std::to_string(staircase::LogStore::kMaxKeys)));
+}
+
+TEST_F(LogStoreTests, GIVENLogFillsUpTHENItIsCompactedAndKeepsTheValues) {
+    for (std::int32_t value = 0; value < 1000; ++value) {
+        mStore.setValue("counter", value);
+        mStore.setValue("other", -value);
+    }
+
+    EXPECT_LT(mStore.usedBytes(), mStore.bankSize());
+    EXPECT_EQ(remountAndGet("counter"), 999);
+    EXPECT_EQ(remountAndGet("other"), -999);
+}
+
+TEST_F(LogStoreTests, GIVENLogIsMostlyFullTHENMaintainCompactsIt) {
+    mStore.maintain();
+    auto empty = mStore.usedBytes();
+
+    std::int32_t value = 0;
+    while (mStore.usedBytes() <= mStore.bankSize() / 4 * 3) {
+        mStore.setValue("counter", ++value);
+    }
+
+    mStore.maintain();
+    EXPECT_LT(mStore.usedBytes(), empty + 32);
+    EXPECT_EQ(remountAndGet("counter"), value);
+}
+
+TEST_F(LogStoreTests, GIVENPowerIsLostDuringBatchTHENItIsAllOrNothing) {
+    std::array<hal::IPersistence::Entry, 3> before{{
+        {"a", 1, false},
+        {"b", 2, false},
+        {"c", 3, false},
+    }};
+    std::array<hal::IPersistence::Entry, 3> after{{
+        {"a", 10, false},
+        {"b", 20, false},
+        {"c", 30, false},
+    }};
+
+    for (std::size_t budget = 0; budget < 64; ++budget) {
+        FlashStorage storage{kStorageSize, kSectorSize};
+        staircase::LogStore store{storage};
+        ASSERT_TRUE(store.mount());
+        store.setValues(before);
+
+        storage.setWriteBudget(budget);
+        store.setValues(after);
+        storage.setWriteBudget(FlashStorage::kUnlimited);
+
+        staircase::LogStore recovered{storage};
+        ASSERT_TRUE(recovered.mount());
+        auto a = recovered.getValue("a");
+        EXPECT_TRUE(a == 1 || a == 10) << budget;
+        EXPECT_EQ(recovered.getValue("b"), a * 2) << budget;
+        EXPECT_EQ(recovered.getValue("c"), a * 3) << budget;
+
+        recovered.setValue("a", 100);
+        EXPECT_EQ(recovered.getValue("a"), 100);
+    }
+}
+
+TEST_F(LogStoreTests, GIVENPowerIsLostDuringCompactionTHENValuesSurvive) {
+    std::int32_t value = 0;
+    while (mStore.usedBytes() <= mStore.bankSize() / 4 * 3) {
+        mStore.setValue("counter", ++value);
+    }
+
+    for (std::size_t budget = 0; budget < 32; ++budget) {
+        mStorage.setWriteBudget(budget);
+        mStore.maintain();
+        mStorage.setWriteBudget(FlashStorage::kUnlimited);
+
+        EXPECT_EQ(remountAndGet("counter"), value) << budget;
+    }
+}
+
+TEST(LogStoreMountTests, GIVENStorageIsTooSmallTHENMountFails) {
+    FlashStorage storage{1024, 512};
+    staircase::LogStore store{storage};
+
+    EXPECT_FALSE(store.mount());
+    store.setValue("a", 1);
+    EXPECT_FALSE(store.keyExists("a"));
+}
+
+} // namespace tests
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <limits>
 
 namespace tests {
 
@@ -82,4 +83,44 @@ TEST(MTAMovingTimeFilterTests,
     EXPECT_EQ(timeFilter.getCurrentMovingTime(), expectedValue);
 }
 
+TEST(MTAMovingTimeFilterTests,
+     GivenLargerWindowEachNewMovingTimeWeighsLessAndLeavesAfterTheWindow) {
+    staircase::WindowedMTAMovingTimeFilter<16> timeFilter{10000};
+
+    timeFilter.processNewMovingTime(26000);
+    EXPECT_EQ(timeFilter.getCurrentMovingTime(), 11000);
+
+    for (std::size_t i = 0; i < 15; ++i) {
+        timeFilter.processNewMovingTime(10000);
+    }
+    EXPECT_EQ(timeFilter.getCurrentMovingTime(), 11000);
+
+    timeFilter.processNewMovingTime(10000);
+    EXPECT_EQ(timeFilter.getCurrentMovingTime(), 10000);
+}
+
+TEST(MTAMovingTimeFilterTests, GivenHugeMovingTimesTheSumDoesNotOverflow) {
+    constexpr hal::Milliseconds kHuge =
+        std::numeric_limits<hal::Milliseconds>::max() - 1;
+    staircase::WindowedMTAMovingTimeFilter<8> timeFilter{kHuge};
+
+    timeFilter.processNewMovingTime(kHuge);
+    EXPECT_EQ(timeFilter.getCurrentMovingTime(), kHuge);
+}
+
+TEST(MTAMovingTimeFilterTests,
+     GivenMovingTimeSwingsBetweenExtremesTheDifferenceDoesNotOverflow) {
+    constexpr hal::Milliseconds kMin =
+        std::numeric_limits<hal::Milliseconds>::min();
+    constexpr hal::Milliseconds kMax =
+        std::numeric_limits<hal::Milliseconds>::max();
+    staircase::WindowedMTAMovingTimeFilter<1> timeFilter{kMin};
+
+    timeFilter.processNewMovingTime(kMax);
+    EXPECT_EQ(timeFilter.getCurrentMovingTime(), kMax);
+
+    timeFilter.processNewMovingTime(kMin);
+    EXPECT_EQ(timeFilter.getCurrentMovingTime(), kMin);
+}
+
 } // namespace tests
\ No newline at end of file
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include <sim/MappedFileStorage.hxx>
+
+#include <staircase/LogStore.hxx>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include <unistd.h>
+
+namespace tests {
+
+class MappedFileStorageTests : public ::testing::Test {
+  public:
+    MappedFileStorageTests()
+        : mPath{"/tmp/staircase_storage_" + std::to_string(::getpid())} {}
+
+    void SetUp() override { std::remove(mPath.c_str()); }
+    void TearDown() override { std::remove(mPath.c_str()); }
+
+  protected:
+    static constexpr std::size_t kSize = 4 * 4096;
+
+    std::string mPath;
+};
+
+TEST_F(MappedFileStorageTests, GIVENNewFileTHENItIsErased) {
+    sim::MappedFileStorage storage{mPath, kSize};
+    ASSERT_TRUE(storage.isOpen());
+
+    std::byte data{};
+    ASSERT_TRUE(storage.read(kSize - 1, {&data, 1}));
+    EXPECT_EQ(data, hal::IStorage::kErased);
+    EXPECT_FALSE(storage.read(kSize, {&data, 1}));
+}
+
+TEST_F(MappedFileStorageTests, GIVENWriteBudgetIsSpentTHENWritesStopShort) {
+    sim::MappedFileStorage storage{mPath, kSize};
+    std::byte data[4]{std::byte{1}, std::byte{2}, std::byte{3},
+                      std::byte{4}};
+
+    storage.setWriteBudget(2);
+    EXPECT_FALSE(storage.write(0, data));
+
+    std::byte read[4]{};
+    ASSERT_TRUE(storage.read(0, read));
+    EXPECT_EQ(read[1], std::byte{2});
+    EXPECT_EQ(read[2], hal::IStorage::kErased);
+    EXPECT_FALSE(storage.erase(0, storage.sectorSize()));
+}
+
+TEST_F(MappedFileStorageTests, GIVENLogStoreOnFileTHENValuesSurviveReopen) {
+    {
+        sim::MappedFileStorage storage{mPath, kSize};
+        staircase::LogStore store{storage};
+        ASSERT_TRUE(store.mount());
+        for (std::int32_t value = 0; value < 2000; ++value) {
+            store.setValue("down_walks", value);
+        }
+    }
+
+    sim::MappedFileStorage storage{mPath, kSize};
+    staircase::LogStore store{storage};
+    ASSERT_TRUE(store.mount());
+    EXPECT_EQ(store.tryGet("down_walks"), 1999);
+}
+
+} // namespace tests
\ No newline at end of file
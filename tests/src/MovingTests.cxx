@@ -6,8 +6,10 @@
 
 #include <hal/Timing.hxx>
 
+#include <staircase/ClippedSquaredMovingDurationCalculator.hxx>
 #include <staircase/IBasicLight.hxx>
 #include <staircase/Moving.hxx>
+#include <staircase/StepTimeline.hxx>
 
 #include <algorithm>
 #include <array>
@@ -27,6 +29,7 @@ class MovingInitializationTests : public ::testing::Test {
                           mBasicLights[6], mBasicLights[7]} {
         ON_CALL(mDurationCalculator, calculateDelta(_, _))
             .WillByDefault(Return(100));
+        mTimeline = staircase::Moving::Timeline{mDurationCalculator, 12000};
     }
 
   protected:
@@ -35,6 +38,7 @@ class MovingInitializationTests : public ::testing::Test {
         mBasicLights;
     NiceMock<mocks::MovingDurationCalculatorMock> mDurationCalculator;
     staircase::BasicLights mBasicLightRefs;
+    staircase::Moving::Timeline mTimeline;
 };
 
 TEST_F(MovingInitializationTests,
@@ -42,8 +46,8 @@ TEST_F(MovingInitializationTests,
     EXPECT_CALL(mBasicLights[0],
                 turnOn(staircase::IBasicLight::kDefaultOnPeriod))
         .Times(Exactly(1));
-    staircase::Moving moving{mBasicLightRefs, mDurationCalculator,
-                             staircase::Moving::Direction::UP, 12000};
+    staircase::Moving moving{mBasicLightRefs, mTimeline,
+                             staircase::Moving::Direction::UP};
 }
 
 TEST_F(MovingInitializationTests,
@@ -51,24 +55,23 @@ TEST_F(MovingInitializationTests,
     EXPECT_CALL(mBasicLights[staircase::IBasicLight::kLightsNum - 1],
                 turnOn(staircase::IBasicLight::kDefaultOnPeriod))
         .Times(Exactly(1));
-    staircase::Moving moving{mBasicLightRefs, mDurationCalculator,
-                             staircase::Moving::Direction::DOWN, 12000};
+    staircase::Moving moving{mBasicLightRefs, mTimeline,
+                             staircase::Moving::Direction::DOWN};
 }
 
 TEST_F(MovingInitializationTests,
-       GivenDownMovingIsInitializedCalculateDeltaIsCalledForTheFirstTime) {
-    EXPECT_CALL(mDurationCalculator, calculateDelta(0, 12000))
-        .Times(Exactly(1));
-    staircase::Moving moving{mBasicLightRefs, mDurationCalculator,
-                             staircase::Moving::Direction::DOWN, 12000};
+       GivenDownMovingIsInitializedCalculateDeltaIsNotCalledAgain) {
+    EXPECT_CALL(mDurationCalculator, calculateDelta(_, _)).Times(Exactly(0));
+    staircase::Moving moving{mBasicLightRefs, mTimeline,
+                             staircase::Moving::Direction::DOWN};
 }
 
 class MovingTimeTests : public MovingInitializationTests {
   public:
     MovingTimeTests()
         : MovingInitializationTests{},
-          mMoving{mBasicLightRefs, mDurationCalculator,
-                  staircase::Moving::Direction::UP, 12000} {}
+          mMoving{mBasicLightRefs, mTimeline,
+                  staircase::Moving::Direction::UP} {}
 
   protected:
     staircase::Moving mMoving;
@@ -173,12 +176,20 @@ TEST_F(MovingTimeTests, GivenUpMovingIsFinishedCompletedReturnsTrue) {
     EXPECT_TRUE(mMoving.isCompleted());
 }
 
+TEST_F(MovingTimeTests, GivenUpMovingIsRunningNextDeadlineIsTheNextStep) {
+    EXPECT_EQ(mMoving.nextDeadline(), 100);
+    mMoving.update(30);
+    EXPECT_EQ(mMoving.nextDeadline(), 70);
+    mMoving.update(12000);
+    EXPECT_EQ(mMoving.nextDeadline(), hal::kForever);
+}
+
 class MovingUpLightTests : public MovingInitializationTests {
   public:
     MovingUpLightTests()
         : MovingInitializationTests{},
-          mMoving{mBasicLightRefs, mDurationCalculator,
-                  staircase::Moving::Direction::UP, 12000} {}
+          mMoving{mBasicLightRefs, mTimeline,
+                  staircase::Moving::Direction::UP} {}
 
   protected:
     staircase::Moving mMoving;
@@ -188,12 +199,11 @@ TEST_F(MovingUpLightTests,
        GivenNewUpMovingIsCreatedItCorrectlyTurningOnLights) {
     mMoving.update(50);
 
+    EXPECT_CALL(mDurationCalculator, calculateDelta(_, _)).Times(Exactly(0));
     for (std::size_t i = 1; i < mBasicLights.size(); ++i) {
         EXPECT_CALL(mBasicLights[i],
                     turnOn(staircase::IBasicLight::kDefaultOnPeriod))
             .Times(Exactly(1));
-        EXPECT_CALL(mDurationCalculator, calculateDelta(i, 12000))
-            .Times(Exactly(1));
         mMoving.update(100);
     }
 }
@@ -202,8 +212,8 @@ class MovingDownLightTests : public MovingInitializationTests {
   public:
     MovingDownLightTests()
         : MovingInitializationTests{},
-          mMoving{mBasicLightRefs, mDurationCalculator,
-                  staircase::Moving::Direction::DOWN, 12000} {}
+          mMoving{mBasicLightRefs, mTimeline,
+                  staircase::Moving::Direction::DOWN} {}
 
   protected:
     staircase::Moving mMoving;
@@ -212,14 +222,121 @@ class MovingDownLightTests : public MovingInitializationTests {
 TEST_F(MovingDownLightTests,
        GivenNewUpMovingIsCreatedItCorrectlyTurningOnLights) {
     mMoving.update(50);
+
+    EXPECT_CALL(mDurationCalculator, calculateDelta(_, _)).Times(Exactly(0));
     for (std::size_t i = 1; i < mBasicLights.size(); ++i) {
         EXPECT_CALL(mBasicLights[staircase::IBasicLight::kLightsNum - i - 1],
                     turnOn(staircase::IBasicLight::kDefaultOnPeriod))
             .Times(Exactly(1));
-        EXPECT_CALL(mDurationCalculator, calculateDelta(i, 12000))
-            .Times(Exactly(1));
         mMoving.update(100);
     }
 }
 
-} // namespace tests
\ No newline at end of file
+TEST_F(MovingUpLightTests,
+       GivenStalledUpdateCrossesManyStepsEveryLightStillDueIsTurnedOn) {
+    for (std::size_t i = 1; i < mBasicLights.size(); ++i) {
+        EXPECT_CALL(mBasicLights[i],
+                    turnOn(staircase::IBasicLight::kDefaultOnPeriod))
+            .Times(Exactly(1));
+    }
+    mMoving.update(staircase::IBasicLight::kLightsNum * 100 - 1);
+    EXPECT_FALSE(mMoving.isCompleted());
+    EXPECT_EQ(mMoving.nextDeadline(), 1);
+
+    mMoving.update(staircase::IBasicLight::kDefaultOnPeriod * 4);
+    EXPECT_TRUE(mMoving.isCompleted());
+}
+
+TEST_F(MovingUpLightTests,
+       GivenStalledUpdateOutlivesTheOnPeriodEveryCrossedLightIsTurnedOn) {
+    for (std::size_t i = 1; i < mBasicLights.size(); ++i) {
+        EXPECT_CALL(mBasicLights[i],
+                    turnOn(staircase::IBasicLight::kDefaultOnPeriod))
+            .Times(Exactly(1));
+    }
+    mMoving.update(staircase::IBasicLight::kLightsNum * 100 +
+                   staircase::IBasicLight::kDefaultOnPeriod);
+    EXPECT_TRUE(mMoving.isCompleted());
+}
+
+TEST(StepTimelineTests, GivenTimelineIsBuiltStepsFollowTheCalculatedDeltas) {
+    staircase::ClippedSquaredMovingDurationCalculator calculator;
+    staircase::StepTimeline<staircase::IBasicLight::kLightsNum> timeline{
+        calculator, 9000};
+
+    EXPECT_EQ(timeline.getDuration(), 9000);
+    EXPECT_EQ(timeline.stepAt(0), 0);
+    EXPECT_EQ(timeline.stepAt(499), 0);
+    EXPECT_EQ(timeline.stepAt(500), 1);
+    EXPECT_EQ(timeline.stepAt(1250), 2);
+    EXPECT_EQ(timeline.stepAt(2449), 2);
+    EXPECT_EQ(timeline.stepAt(2450), 3);
+    EXPECT_EQ(timeline.offset(staircase::IBasicLight::kLightsNum),
+              2450 + 1000 * (staircase::IBasicLight::kLightsNum - 3));
+    EXPECT_EQ(timeline.stepAt(1 << 30), staircase::IBasicLight::kLightsNum);
+}
+
+class StepTimelineSumTests
+    : public ::testing::TestWithParam<hal::Milliseconds> {};
+
+TEST_P(StepTimelineSumTests, GivenAnyDurationOffsetsAreTheSumsOfTheDeltas) {
+    staircase::ClippedSquaredMovingDurationCalculator calculator;
+    auto duration = GetParam();
+    staircase::StepTimeline<staircase::IBasicLight::kLightsNum> timeline{
+        calculator, duration};
+
+    hal::Milliseconds sum = 0;
+    EXPECT_EQ(timeline.offset(0), 0);
+    for (std::size_t step = 1; step <= staircase::IBasicLight::kLightsNum;
+         ++step) {
+        sum += calculator.calculateDelta(step - 1, duration);
+        EXPECT_EQ(timeline.offset(step), sum);
+        EXPECT_EQ(timeline.stepAt(sum - 1), step - 1);
+        EXPECT_EQ(timeline.stepAt(sum), step);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(StepTimelineTests, StepTimelineSumTests,
+                         ::testing::Values(9000, 12000, 12001, 12007, 30000));
+
+TEST(StepTimelineTests, GivenSameDurationIsRequestedCachedTimelineIsReused) {
+    NiceMock<mocks::MovingDurationCalculatorMock> calculator;
+    ON_CALL(calculator, calculateDelta(_, _)).WillByDefault(Return(100));
+    staircase::Moving::TimelineCache cache;
+
+    EXPECT_CALL(calculator, calculateDelta(_, 12000))
+        .Times(Exactly(staircase::IBasicLight::kLightsNum));
+    const auto &timeline = cache.get(calculator, 12000);
+    EXPECT_EQ(&cache.get(calculator, 12000), &timeline);
+    EXPECT_EQ(timeline.getDuration(), 12000);
+}
+
+TEST(StepTimelineTests, GivenOtherDurationIsRequestedItsOwnDeltasAreSummed) {
+    NiceMock<mocks::MovingDurationCalculatorMock> calculator;
+    ON_CALL(calculator, calculateDelta(_, _))
+        .WillByDefault(
+            [](std::size_t index, hal::Milliseconds duration)
+                -> hal::Milliseconds {
+                return static_cast<hal::Milliseconds>(index * index) +
+                       duration / 7;
+            });
+    staircase::Moving::TimelineCache cache;
+
+    EXPECT_EQ(cache.get(calculator, 12000).offset(3), 5 + 3 * (12000 / 7));
+    EXPECT_EQ(cache.get(calculator, 9001).offset(3), 5 + 3 * (9001 / 7));
+    EXPECT_EQ(cache.get(calculator, 12000).offset(3), 5 + 3 * (12000 / 7));
+}
+
+TEST(StepTimelineTests, GivenOtherCalculatorIsRequestedItGetsItsOwnTimeline) {
+    NiceMock<mocks::MovingDurationCalculatorMock> first;
+    NiceMock<mocks::MovingDurationCalculatorMock> second;
+    ON_CALL(first, calculateDelta(_, _)).WillByDefault(Return(100));
+    ON_CALL(second, calculateDelta(_, _)).WillByDefault(Return(300));
+    staircase::Moving::TimelineCache cache;
+
+    EXPECT_EQ(cache.get(first, 12000).offset(2), 200);
+    EXPECT_EQ(cache.get(second, 12000).offset(2), 600);
+    EXPECT_EQ(cache.get(first, 12000).offset(2), 200);
+}
+
+} // namespace tests
@@ -0,0 +1,85 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <util/MpscRing.hxx>
+
+#include <array>
+#include <cstdint>
+#include <thread>
+
+namespace tests {
+
+TEST(MpscRingTests, Initialization) {
+    util::MpscRing<int, 4> ring;
+    int value = 0;
+
+    EXPECT_EQ(ring.capacity(), 4);
+    EXPECT_FALSE(ring.pop(value));
+}
+
+TEST(MpscRingTests, PushUntilFull) {
+    util::MpscRing<int, 4> ring;
+
+    EXPECT_TRUE(ring.push(6));
+    EXPECT_TRUE(ring.push(7));
+    EXPECT_TRUE(ring.push(8));
+    EXPECT_TRUE(ring.push(9));
+    EXPECT_FALSE(ring.push(10));
+}
+
+TEST(MpscRingTests, PopIsFifoAcrossWrapAround) {
+    util::MpscRing<int, 4> ring;
+    int value = 0;
+
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(ring.push(i));
+        ASSERT_TRUE(ring.push(i + 100));
+        ASSERT_TRUE(ring.pop(value));
+        EXPECT_EQ(value, i);
+        ASSERT_TRUE(ring.pop(value));
+        EXPECT_EQ(value, i + 100);
+    }
+
+    EXPECT_FALSE(ring.pop(value));
+}
+
+TEST(MpscRingTests, ConcurrentProducersKeepTheirOwnOrder) {
+    constexpr std::uint32_t kProducers = 3;
+    constexpr std::uint32_t kCount = 10000;
+    util::MpscRing<std::uint32_t, 8> ring;
+
+    std::array<std::thread, kProducers> producers;
+    for (std::uint32_t producer = 0; producer < kProducers; ++producer) {
+        producers[producer] = std::thread{[&ring, producer]() {
+            for (std::uint32_t i = 0; i < kCount;) {
+                if (ring.push((producer << 24) | i)) {
+                    ++i;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }};
+    }
+
+    std::array<std::uint32_t, kProducers> expected{};
+    std::uint32_t received = 0;
+    std::uint32_t value = 0;
+    while (received < kProducers * kCount) {
+        if (ring.pop(value)) {
+            std::uint32_t producer = value >> 24;
+            ASSERT_LT(producer, kProducers);
+            ASSERT_EQ(value & 0xFFFFFF, expected[producer]);
+            ++expected[producer];
+            ++received;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    EXPECT_FALSE(ring.pop(value));
+}
+
+} // namespace tests
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <hal/Timing.hxx>
+
+#include <staircase/OccupancySchedule.hxx>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tests {
+
+using staircase::OccupancySchedule;
+
+class OccupancyScheduleTests : public ::testing::Test {
+  protected:
+    static constexpr hal::Milliseconds kMinute = 60 * 1000;
+    static constexpr hal::Milliseconds kHour = 60 * kMinute;
+
+    // A minute-by-minute day with a trigger every minute outside of
+    // 01:00-03:00.
+    void runNights(int days) {
+        for (int day = 0; day < days; ++day) {
+            for (hal::Milliseconds time = 0; time < OccupancySchedule::kDay;
+                 time += kMinute) {
+                bool night = time >= kHour && time < 3 * kHour;
+                mSchedule.update(time, night ? 0 : 1);
+            }
+        }
+        mSchedule.update(0, 1);
+    }
+
+    OccupancySchedule mSchedule;
+};
+
+TEST_F(OccupancyScheduleTests, GIVENNewScheduleTHENNothingIsQuiet) {
+    EXPECT_EQ(mSchedule.quietFor(0), 0);
+    EXPECT_EQ(mSchedule.quietFor(2 * kHour), 0);
+}
+
+TEST_F(OccupancyScheduleTests,
+       GIVENSlotsStayEmptyForTenDaysTHENTheyAreQuietUntilTheFirstBusyOne) {
+    runNights(9);
+    EXPECT_EQ(mSchedule.quietFor(kHour), 0);
+
+    runNights(1);
+    EXPECT_EQ(mSchedule.quietFor(kHour), 2 * kHour);
+    EXPECT_EQ(mSchedule.quietFor(kHour + 40 * kMinute), 80 * kMinute);
+    EXPECT_EQ(mSchedule.quietFor(3 * kHour), 0);
+    EXPECT_EQ(mSchedule.quietFor(0), 0);
+}
+
+TEST_F(OccupancyScheduleTests,
+       GIVENTrafficInAQuietSlotTHENItIsNoLongerQuiet) {
+    runNights(10);
+
+    mSchedule.update(kHour, 0);
+    EXPECT_EQ(mSchedule.quietFor(kHour + 5 * kMinute), 2 * kHour - 5 * kMinute);
+
+    mSchedule.update(kHour + 10 * kMinute, 1);
+    EXPECT_EQ(mSchedule.quietFor(kHour + 10 * kMinute), 0);
+
+    mSchedule.update(kHour + 30 * kMinute, 0);
+    EXPECT_GE(mSchedule.getScore(2), OccupancySchedule::kQuietScore);
+    EXPECT_EQ(mSchedule.quietFor(kHour + 30 * kMinute), 90 * kMinute);
+}
+
+TEST_F(OccupancyScheduleTests,
+       GIVENSlotIsOnlyPartlyWatchedTHENOnlyTrafficIsLearnt) {
+    // Booted in the middle of slot 2, then missed slot 5 to a hibernation.
+    mSchedule.update(kHour + 10 * kMinute, 0);
+    mSchedule.update(kHour + 30 * kMinute, 0);
+    mSchedule.update(2 * kHour, 0);
+    mSchedule.update(3 * kHour, 0);
+    mSchedule.update(3 * kHour + 30 * kMinute, 0);
+
+    EXPECT_EQ(mSchedule.getScore(2), OccupancySchedule::kOccupied);
+    EXPECT_LT(mSchedule.getScore(3), OccupancySchedule::kOccupied);
+    EXPECT_LT(mSchedule.getScore(4), OccupancySchedule::kOccupied);
+    EXPECT_EQ(mSchedule.getScore(5), OccupancySchedule::kOccupied);
+    EXPECT_EQ(mSchedule.getScore(6), OccupancySchedule::kOccupied);
+}
+
+TEST_F(OccupancyScheduleTests,
+       GIVENSlotsAreSleptThroughTHENTheyAreWatchedAgainEveryFewDays) {
+    auto sleepUntilWatched = [this]() {
+        int nights = 0;
+        while (mSchedule.quietFor(kHour) != 0) {
+            mSchedule.sleepThrough(kHour, 2 * kHour);
+            ++nights;
+        }
+        return nights;
+    };
+
+    runNights(20);
+    EXPECT_GT(sleepUntilWatched(), 0);
+
+    runNights(1);
+    auto nights = sleepUntilWatched();
+    EXPECT_GT(nights, 1);
+    EXPECT_LT(nights, 10);
+    EXPECT_EQ(mSchedule.getScore(1), OccupancySchedule::kOccupied);
+    EXPECT_EQ(mSchedule.getScore(6), OccupancySchedule::kOccupied);
+}
+
+TEST_F(OccupancyScheduleTests, GIVENScoresArePackedTHENWordsRestoreThem) {
+    runNights(3);
+
+    OccupancySchedule restored;
+    for (std::size_t word = 0; word < OccupancySchedule::kWordsNum; ++word) {
+        restored.setWord(word, mSchedule.getWord(word));
+    }
+
+    for (std::size_t slot = 0; slot < OccupancySchedule::kSlotsNum; ++slot) {
+        EXPECT_EQ(restored.getScore(slot), mSchedule.getScore(slot));
+    }
+}
+
+} // namespace tests
\ No newline at end of file
@@ -0,0 +1,162 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <mocks/PersistenceMock.hxx>
+#include <mocks/StaircaseLooperMock.hxx>
+
+#include <hal/IPersistence.hxx>
+#include <hal/Timing.hxx>
+
+#include <staircase/IMoving.hxx>
+#include <staircase/LooperCommand.hxx>
+#include <staircase/LooperSnapshot.hxx>
+#include <staircase/PersistenceRunnable.hxx>
+
+#include <functional>
+#include <map>
+#include <span>
+#include <string>
+
+namespace tests {
+
+using ::testing::_;
+using ::testing::AllOf;
+using ::testing::Exactly;
+using ::testing::Field;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+class PersistenceRunnableTests : public ::testing::Test {
+  public:
+    using Entry = hal::IPersistence::Entry;
+
+    PersistenceRunnableTests()
+        : mRunnable{mLooper, mPersistence, kQuietPeriod, kThreshold} {
+        ON_CALL(mPersistence, getValues(_))
+            .WillByDefault(Invoke([this](std::span<Entry> entries) {
+                for (auto &entry : entries) {
+                    auto stored = mStored.find(entry.key);
+                    entry.found = stored != mStored.end();
+                    entry.value = entry.found ? stored->second : 0;
+                }
+            }));
+        ON_CALL(mPersistence, setValues(_))
+            .WillByDefault(Invoke([this](std::span<const Entry> entries) {
+                ++mBatches;
+                for (const auto &entry : entries) {
+                    mStored[std::string{entry.key}] = entry.value;
+                }
+            }));
+        ON_CALL(mLooper, snapshot()).WillByDefault(Invoke([this]() {
+            return mSnapshot;
+        }));
+    }
+
+  protected:
+    static constexpr hal::Milliseconds kQuietPeriod = 5000;
+    static constexpr std::uint32_t kThreshold = 100;
+
+    void runFor(hal::Milliseconds millis) {
+        for (hal::Milliseconds passed = 0; passed < millis;
+             passed += staircase::PersistenceRunnable::kUpdateInterval) {
+            static_cast<staircase::IRunnable &>(mRunnable).run();
+        }
+    }
+
+    NiceMock<mocks::StaircaseLooperMock> mLooper;
+    NiceMock<mocks::PersistenceMock> mPersistence;
+    staircase::PersistenceRunnable mRunnable;
+    staircase::LooperSnapshot mSnapshot{};
+    std::map<std::string, std::int32_t, std::less<>> mStored;
+    int mBatches = 0;
+};
+
+TEST_F(PersistenceRunnableTests,
+       GIVENStoredMovingTimesTHENRestoreResetsTheFilters) {
+    mStored = {{"down_time", 9000}, {"up_time", 11000}};
+
+    EXPECT_CALL(mPersistence, getValues(_)).Times(Exactly(1));
+    EXPECT_CALL(
+        mLooper,
+        post(AllOf(Field(&staircase::LooperCommand::type,
+                         staircase::LooperCommand::Type::RESET_FILTER),
+                   Field(&staircase::LooperCommand::direction,
+                         staircase::IMoving::Direction::DOWN),
+                   Field(&staircase::LooperCommand::value, 9000))))
+        .WillOnce(Return(true));
+    EXPECT_CALL(
+        mLooper,
+        post(AllOf(Field(&staircase::LooperCommand::direction,
+                         staircase::IMoving::Direction::UP),
+                   Field(&staircase::LooperCommand::value, 11000))))
+        .WillOnce(Return(true));
+
+    mRunnable.restore();
+}
+
+TEST_F(PersistenceRunnableTests, GIVENNothingIsStoredTHENFiltersAreNotReset) {
+    EXPECT_CALL(mLooper, post(_)).Times(Exactly(0));
+
+    mRunnable.restore();
+}
+
+TEST_F(PersistenceRunnableTests,
+       GIVENLooperHasNotUpdatedYetTHENNothingIsWritten) {
+    mRunnable.restore();
+    runFor(2 * kQuietPeriod);
+
+    EXPECT_EQ(mBatches, 0);
+}
+
+TEST_F(PersistenceRunnableTests,
+       GIVENStateChangesTHENItIsWrittenInOneBatchAfterTheQuietPeriod) {
+    mRunnable.restore();
+    mSnapshot.updates = 1;
+    mSnapshot.downMovingTime = 9000;
+    mSnapshot.upMovingTime = 12000;
+    mSnapshot.downWalks = 2;
+
+    runFor(kQuietPeriod - staircase::PersistenceRunnable::kUpdateInterval);
+    EXPECT_EQ(mBatches, 0);
+
+    runFor(staircase::PersistenceRunnable::kUpdateInterval);
+    EXPECT_EQ(mBatches, 1);
+    EXPECT_EQ(mStored["down_time"], 9000);
+    EXPECT_EQ(mStored["up_time"], 12000);
+    EXPECT_EQ(mStored["down_walks"], 2);
+    EXPECT_EQ(mStored["up_walks"], 0);
+
+    runFor(2 * kQuietPeriod);
+    EXPECT_EQ(mBatches, 1);
+}
+
+TEST_F(PersistenceRunnableTests,
+       GIVENStoredWalkCountsTHENNewWalksAreAddedToThem) {
+    mStored = {{"down_walks", 40}, {"up_walks", 30}};
+    mRunnable.restore();
+    mSnapshot.updates = 1;
+    mSnapshot.downWalks = 1;
+    mSnapshot.upWalks = 2;
+
+    runFor(kQuietPeriod);
+    mRunnable.flush();
+
+    EXPECT_EQ(mStored["down_walks"], 41);
+    EXPECT_EQ(mStored["up_walks"], 32);
+}
+
+TEST_F(PersistenceRunnableTests,
+       GIVENStateIsPendingTHENPersistenceMaintenanceWaits) {
+    mRunnable.restore();
+    mSnapshot.updates = 1;
+    mSnapshot.downWalks = 1;
+
+    EXPECT_CALL(mPersistence, maintain()).Times(Exactly(0));
+    runFor(kQuietPeriod - staircase::PersistenceRunnable::kUpdateInterval);
+
+    EXPECT_CALL(mPersistence, maintain()).Times(Exactly(1));
+    runFor(staircase::PersistenceRunnable::kUpdateInterval);
+}
+
+} // namespace tests
\ No newline at end of file
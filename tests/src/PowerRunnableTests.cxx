@@ -0,0 +1,177 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <mocks/PersistenceMock.hxx>
+#include <mocks/PowerManagerMock.hxx>
+#include <mocks/RTCMock.hxx>
+#include <mocks/StaircaseLooperMock.hxx>
+
+#include <hal/IPersistence.hxx>
+#include <hal/Timing.hxx>
+
+#include <staircase/IRunnable.hxx>
+#include <staircase/LooperSnapshot.hxx>
+#include <staircase/OccupancySchedule.hxx>
+#include <staircase/PersistenceRunnable.hxx>
+#include <staircase/PowerRunnable.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <span>
+#include <string>
+
+namespace tests {
+
+using ::testing::_;
+using ::testing::Exactly;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+using staircase::OccupancySchedule;
+using staircase::PersistenceRunnable;
+using staircase::PowerRunnable;
+
+class PowerRunnableTests : public ::testing::Test {
+  public:
+    using Entry = hal::IPersistence::Entry;
+
+    PowerRunnableTests()
+        : mRunnable{mRtc, mPowerManager, mLooper, mPersistence} {
+        ON_CALL(mPersistence, getValues(_))
+            .WillByDefault(Invoke([this](std::span<Entry> entries) {
+                for (auto &entry : entries) {
+                    auto stored = mStored.find(entry.key);
+                    entry.found = stored != mStored.end();
+                    entry.value = entry.found ? stored->second : 0;
+                }
+            }));
+        ON_CALL(mPersistence, setValues(_))
+            .WillByDefault(Invoke([this](std::span<const Entry> entries) {
+                for (const auto &entry : entries) {
+                    mStored[std::string{entry.key}] = entry.value;
+                }
+            }));
+        ON_CALL(mLooper, snapshot()).WillByDefault(Invoke([this]() {
+            return mSnapshot;
+        }));
+    }
+
+  protected:
+    static constexpr hal::Milliseconds kMinute = 60 * 1000;
+    static constexpr hal::Milliseconds kHour = 60 * kMinute;
+
+    // Stores a schedule which is quiet in the slots from first to last.
+    void storeQuiet(std::size_t first, std::size_t last) {
+        for (std::size_t word = 0; word < OccupancySchedule::kWordsNum;
+             ++word) {
+            std::uint32_t packed = 0;
+            for (std::size_t index = 0;
+                 index < OccupancySchedule::kSlotsPerWord; ++index) {
+                auto slot = word * OccupancySchedule::kSlotsPerWord + index;
+                bool quiet = slot >= first && slot <= last;
+                packed |= (quiet ? 0u : OccupancySchedule::kOccupied)
+                          << (8 * index);
+            }
+            mStored["occupancy_" + std::to_string(word)] =
+                static_cast<std::int32_t>(packed);
+        }
+    }
+
+    void runAt(hal::Milliseconds timeOfDay) {
+        ON_CALL(mRtc, getCurrentTimeOfDay()).WillByDefault(Return(timeOfDay));
+        static_cast<staircase::IRunnable &>(mRunnable).run();
+    }
+
+    NiceMock<mocks::RTCMock> mRtc;
+    NiceMock<mocks::PowerManagerMock> mPowerManager;
+    NiceMock<mocks::StaircaseLooperMock> mLooper;
+    NiceMock<mocks::PersistenceMock> mPersistence;
+    PowerRunnable mRunnable;
+    staircase::LooperSnapshot mSnapshot{};
+    std::map<std::string, std::int32_t, std::less<>> mStored;
+};
+
+TEST_F(PowerRunnableTests, GIVENNothingIsLearntTHENItNeverHibernates) {
+    mRunnable.restore();
+
+    EXPECT_CALL(mPowerManager, hibernateFor(_)).Times(Exactly(0));
+    for (hal::Milliseconds time = 0; time < OccupancySchedule::kDay;
+         time += 10 * kMinute) {
+        runAt(time);
+    }
+}
+
+TEST_F(PowerRunnableTests,
+       GIVENQuietNightTHENItHibernatesUntilTheFirstBusySlotAndStoresIt) {
+    storeQuiet(2, 5);
+    mRunnable.restore();
+
+    EXPECT_CALL(mPowerManager, hibernateFor(90 * kMinute))
+        .WillOnce(Invoke([this](hal::Milliseconds) {
+            // Written out before the device goes down.
+            OccupancySchedule stored;
+            stored.setWord(0, mStored["occupancy_0"]);
+            stored.setWord(1, mStored["occupancy_1"]);
+            EXPECT_EQ(stored.getScore(2), 0);
+            EXPECT_EQ(stored.getScore(3), OccupancySchedule::kForgetStep);
+            EXPECT_EQ(stored.getScore(5), OccupancySchedule::kForgetStep);
+        }));
+    runAt(kHour + 30 * kMinute);
+}
+
+TEST_F(PowerRunnableTests, GIVENLightsAreOnOrTrafficWasSeenTHENItStaysAwake) {
+    storeQuiet(2, 5);
+    mRunnable.restore();
+
+    EXPECT_CALL(mPowerManager, hibernateFor(_)).Times(Exactly(0));
+    mSnapshot.lights[0] = 1;
+    runAt(kHour);
+
+    mSnapshot.lights[0] = 0;
+    mSnapshot.triggers = 1;
+    runAt(kHour + kMinute);
+    runAt(kHour + 2 * kMinute);
+}
+
+TEST_F(PowerRunnableTests, GIVENQuietSpellIsTooShortTHENItStaysAwake) {
+    storeQuiet(2, 2);
+    mRunnable.restore();
+
+    EXPECT_CALL(mPowerManager, hibernateFor(_)).Times(Exactly(0));
+    runAt(kHour + 20 * kMinute);
+}
+
+TEST_F(PowerRunnableTests,
+       GIVENWholeDayIsQuietTHENHibernationIsClampedWithoutOverflow) {
+    storeQuiet(0, OccupancySchedule::kSlotsNum - 1);
+    mRunnable.restore();
+
+    EXPECT_CALL(mPowerManager, hibernateFor(PowerRunnable::kMaxHibernation))
+        .Times(Exactly(1));
+    runAt(9 * kHour);
+}
+
+TEST_F(PowerRunnableTests,
+       GIVENWalkEndedWithinTheQuietPeriodTHENItIsStoredBeforeHibernating) {
+    PersistenceRunnable persistence{mLooper, mPersistence};
+    persistence.restore();
+    storeQuiet(2, 5);
+    mRunnable.restore();
+    mRunnable.setPersistence(&persistence);
+
+    mSnapshot.updates = 1;
+    mSnapshot.downMovingTime = 9000;
+    mSnapshot.downWalks = 3;
+
+    EXPECT_CALL(mPowerManager, hibernateFor(90 * kMinute))
+        .WillOnce(Invoke([this](hal::Milliseconds) {
+            EXPECT_EQ(mStored["down_time"], 9000);
+            EXPECT_EQ(mStored["down_walks"], 3);
+        }));
+    runAt(kHour + 30 * kMinute);
+}
+
+} // namespace tests
\ No newline at end of file
@@ -3,10 +3,16 @@
 
 #include <mocks/BinaryValueReaderMock.hxx>
 
+#include <hal/Adapters.hxx>
+#include <hal/BinaryEdge.hxx>
 #include <hal/BinaryValue.hxx>
 #include <hal/Timing.hxx>
 
 #include <staircase/ProximitySensor.hxx>
+#include <staircase/StaticProximitySensor.hxx>
+#include <staircase/TraceRing.hxx>
+
+#include <cstdint>
 
 namespace tests {
 
@@ -121,4 +127,217 @@ TEST_F(
     EXPECT_TRUE(proximitySensor.hasStateChanged());
 }
 
+TEST_F(ProximitySensorTestsInitialStateClose,
+       GivenStateChangeIsPendingNextDeadlineIsTheRestOfTheDebouncePeriod) {
+    staircase::ProximitySensor proximitySensor{mBinaryValueReader};
+    EXPECT_EQ(proximitySensor.nextDeadline(), staircase::kSensorSamplePeriod);
+
+    ON_CALL(mBinaryValueReader, readValue())
+        .WillByDefault(Return(hal::BinaryValue::LOW));
+    proximitySensor.update(100);
+    EXPECT_EQ(proximitySensor.nextDeadline(),
+              DEBOUNCE_PERIOD - 50);
+
+    proximitySensor.update(DEBOUNCE_PERIOD);
+    EXPECT_EQ(proximitySensor.nextDeadline(), staircase::kSensorSamplePeriod);
+}
+
+TEST_F(ProximitySensorTestsInitialStateClose,
+       GivenFirstUpdateAfterLongSleepSeesEdgeItIsTreatedAsFresh) {
+    staircase::ProximitySensor proximitySensor{mBinaryValueReader};
+
+    ON_CALL(mBinaryValueReader, readValue())
+        .WillByDefault(Return(hal::BinaryValue::LOW));
+    proximitySensor.update(5000);
+    EXPECT_TRUE(proximitySensor.isClose());
+    EXPECT_EQ(proximitySensor.nextDeadline(),
+              DEBOUNCE_PERIOD);
+}
+
+class ProximitySensorEdgeTests : public ::testing::Test {
+  protected:
+    static constexpr hal::Timestamp kStart = 1000;
+
+    void edge(hal::BinaryValue value, hal::Timestamp timestamp) {
+        ASSERT_TRUE(mEdges.push(hal::BinaryEdge{value, timestamp}));
+    }
+
+    // Fills the queue and then loses one more edge.
+    void overflow(hal::BinaryValue value, hal::Timestamp timestamp) {
+        while (mEdges.push(hal::BinaryEdge{value, timestamp})) {
+        }
+    }
+
+    staircase::ProximitySensor::EdgeQueue mEdges;
+    NiceMock<mocks::BinaryValueReaderMock> mLevel;
+    staircase::ProximitySensor mProximitySensor{mEdges, mLevel, kStart};
+};
+
+TEST_F(ProximitySensorEdgeTests,
+       GivenNoEdgesArriveStateStaysAndNothingIsPending) {
+    mProximitySensor.update(5000);
+
+    EXPECT_TRUE(mProximitySensor.isFar());
+    EXPECT_FALSE(mProximitySensor.hasStateChanged());
+    EXPECT_EQ(mProximitySensor.nextDeadline(), hal::kForever);
+}
+
+TEST_F(ProximitySensorEdgeTests,
+       GivenEdgeIsHeldStateChangesExactlyOneDebouncePeriodAfterIt) {
+    edge(hal::BinaryValue::HIGH, kStart + 70);
+    EXPECT_EQ(mProximitySensor.nextDeadline(), 0);
+
+    mProximitySensor.update(100);
+    EXPECT_FALSE(mProximitySensor.hasStateChanged());
+    EXPECT_EQ(mProximitySensor.nextDeadline(), DEBOUNCE_PERIOD - 30);
+
+    mProximitySensor.update(DEBOUNCE_PERIOD - 31);
+    EXPECT_FALSE(mProximitySensor.hasStateChanged());
+
+    mProximitySensor.update(1);
+    EXPECT_TRUE(mProximitySensor.hasStateChanged());
+    EXPECT_TRUE(mProximitySensor.isClose());
+    EXPECT_EQ(mProximitySensor.nextDeadline(), hal::kForever);
+}
+
+TEST_F(ProximitySensorEdgeTests, GivenPulseShorterThanDebounceItIsRejected) {
+    edge(hal::BinaryValue::HIGH, kStart + 10);
+    edge(hal::BinaryValue::LOW, kStart + 10 + DEBOUNCE_PERIOD - 1);
+
+    mProximitySensor.update(2 * DEBOUNCE_PERIOD);
+    EXPECT_FALSE(mProximitySensor.hasStateChanged());
+    EXPECT_TRUE(mProximitySensor.isFar());
+}
+
+TEST_F(ProximitySensorEdgeTests,
+       GivenLongPulseEndsBetweenUpdatesBothChangesAreReportedInOrder) {
+    edge(hal::BinaryValue::HIGH, kStart + 10);
+    edge(hal::BinaryValue::LOW, kStart + 10 + DEBOUNCE_PERIOD);
+
+    mProximitySensor.update(3 * DEBOUNCE_PERIOD);
+    EXPECT_TRUE(mProximitySensor.hasStateChanged());
+    EXPECT_TRUE(mProximitySensor.isClose());
+    EXPECT_EQ(mProximitySensor.nextDeadline(), 0);
+
+    mProximitySensor.update(0);
+    EXPECT_TRUE(mProximitySensor.hasStateChanged());
+    EXPECT_TRUE(mProximitySensor.isFar());
+}
+
+TEST_F(ProximitySensorEdgeTests, GivenClockWrapsDebounceStillUsesEdgeTimes) {
+    staircase::ProximitySensor::EdgeQueue edges;
+    staircase::ProximitySensor proximitySensor{edges, mLevel, 0xFFFFFF00};
+
+    ASSERT_TRUE(
+        edges.push(hal::BinaryEdge{hal::BinaryValue::HIGH, 0xFFFFFFF0}));
+    proximitySensor.update(DEBOUNCE_PERIOD + 0xF0 - 1);
+    EXPECT_FALSE(proximitySensor.hasStateChanged());
+
+    proximitySensor.update(1);
+    EXPECT_TRUE(proximitySensor.hasStateChanged());
+    EXPECT_TRUE(proximitySensor.isClose());
+}
+
+TEST_F(ProximitySensorEdgeTests,
+       GivenEdgesAreLostToAFullQueueTheLevelIsReadOnceAndDebounced) {
+    // A queue full of bounces, and the final rise lost.
+    overflow(hal::BinaryValue::LOW, kStart + 10);
+    EXPECT_EQ(mEdges.overflows(), 1);
+    EXPECT_EQ(mProximitySensor.nextDeadline(), 0);
+
+    EXPECT_CALL(mLevel, readValue())
+        .Times(1)
+        .WillOnce(Return(hal::BinaryValue::HIGH));
+    mProximitySensor.update(100);
+    EXPECT_FALSE(mProximitySensor.hasStateChanged());
+    EXPECT_EQ(mProximitySensor.getResyncs(), 1);
+    EXPECT_EQ(mProximitySensor.nextDeadline(), DEBOUNCE_PERIOD);
+
+    mProximitySensor.update(DEBOUNCE_PERIOD);
+    EXPECT_TRUE(mProximitySensor.hasStateChanged());
+    EXPECT_TRUE(mProximitySensor.isClose());
+    EXPECT_EQ(mProximitySensor.nextDeadline(), hal::kForever);
+}
+
+TEST_F(ProximitySensorEdgeTests,
+       GivenNothingIsLostTheLevelIsNotReadAfterConstruction) {
+    EXPECT_CALL(mLevel, readValue()).Times(0);
+
+    edge(hal::BinaryValue::HIGH, kStart + 10);
+    mProximitySensor.update(2 * DEBOUNCE_PERIOD);
+
+    EXPECT_TRUE(mProximitySensor.isClose());
+    EXPECT_EQ(mProximitySensor.getResyncs(), 0);
+}
+
+TEST_F(ProximitySensorEdgeTests, GivenTraceIsSetRawEdgesAreBackDatedIntoIt) {
+    if constexpr (!staircase::kTraceEnabled) {
+        GTEST_SKIP() << "built without STAIRCASE_TRACE";
+    }
+
+    staircase::TraceRing trace;
+    mProximitySensor.setTrace(&trace, staircase::kTraceUp);
+
+    edge(hal::BinaryValue::HIGH, kStart + 70);
+    edge(hal::BinaryValue::LOW, kStart + 90);
+    trace.advance(100);
+    mProximitySensor.update(100);
+
+    staircase::TraceRecord record;
+    ASSERT_TRUE(trace.pop(record));
+    EXPECT_EQ(record.event, staircase::TraceEvent::SENSOR_EDGE);
+    EXPECT_EQ(record.subject, staircase::kTraceUp);
+    EXPECT_EQ(record.time, 70);
+    EXPECT_EQ(record.value, 1);
+    ASSERT_TRUE(trace.pop(record));
+    EXPECT_EQ(record.time, 90);
+    EXPECT_EQ(record.value, 0);
+    EXPECT_FALSE(trace.pop(record));
+}
+
+// A pin which is just a bit in a word, the way a GPIO input register is.
+class InputWordPin {
+  public:
+    InputWordPin(const std::uint32_t &word, std::uint32_t mask) noexcept
+        : mWord{&word}, mMask{mask} {}
+
+    hal::BinaryValue readValue() noexcept {
+        return (*mWord & mMask) ? hal::BinaryValue::HIGH
+                                : hal::BinaryValue::LOW;
+    }
+
+  private:
+    const std::uint32_t *mWord;
+    std::uint32_t mMask;
+};
+
+TEST(StaticProximitySensorTests,
+     GivenConcretePinChangesItIsDebouncedAndSampledWithTheGivenPeriods) {
+    std::uint32_t word = 0;
+    staircase::StaticProximitySensor<InputWordPin, 100, 25> sensor{
+        InputWordPin{word, 0b100}};
+    EXPECT_TRUE(sensor.isFar());
+    EXPECT_EQ(sensor.nextDeadline(), 25);
+
+    word = 0b100;
+    sensor.update(10);
+    EXPECT_FALSE(sensor.hasStateChanged());
+    EXPECT_EQ(sensor.nextDeadline(), 95);
+
+    sensor.update(95);
+    EXPECT_TRUE(sensor.hasStateChanged());
+    EXPECT_TRUE(sensor.isClose());
+    EXPECT_EQ(sensor.nextDeadline(), 25);
+}
+
+TEST_F(ProximitySensorTestsInitialization,
+       GivenStaticProximitySensorIsBuiltOverTheAdapterItReadsTheMock) {
+    EXPECT_CALL(mBinaryValueReader, readValue())
+        .WillOnce(Return(hal::BinaryValue::HIGH));
+    staircase::StaticProximitySensor<hal::BinaryReaderAdapter> sensor{
+        mBinaryValueReader};
+
+    EXPECT_TRUE(sensor.isClose());
+}
+
 } // namespace tests
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <util/SeqLock.hxx>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace tests {
+
+struct Sample {
+    std::uint32_t first;
+    std::array<std::uint32_t, 5> rest;
+    std::uint8_t tail;
+};
+
+TEST(SeqLockTests, LoadReturnsInitialValue) {
+    util::SeqLock<Sample> lock{Sample{6, {7, 8, 9, 10, 11}, 12}};
+
+    Sample sample = lock.load();
+    EXPECT_EQ(sample.first, 6);
+    EXPECT_EQ(sample.rest[4], 11);
+    EXPECT_EQ(sample.tail, 12);
+}
+
+TEST(SeqLockTests, LoadReturnsLastStoredValue) {
+    util::SeqLock<Sample> lock;
+
+    lock.store(Sample{1, {}, 2});
+    lock.store(Sample{3, {}, 4});
+
+    Sample sample;
+    ASSERT_TRUE(lock.tryLoad(sample));
+    EXPECT_EQ(sample.first, 3);
+    EXPECT_EQ(sample.tail, 4);
+}
+
+TEST(SeqLockTests, ConcurrentReadersNeverSeeATornValue) {
+    constexpr std::uint32_t kStores = 20000;
+    util::SeqLock<Sample> lock;
+    std::atomic_bool done{false};
+
+    std::thread reader{[&lock, &done]() {
+        while (!done.load()) {
+            Sample sample = lock.load();
+            for (auto value : sample.rest) {
+                ASSERT_EQ(value, sample.first);
+            }
+            std::this_thread::yield();
+        }
+    }};
+
+    for (std::uint32_t i = 1; i <= kStores; ++i) {
+        lock.store(Sample{i, {i, i, i, i, i}, 0});
+    }
+    done.store(true);
+    reader.join();
+
+    EXPECT_EQ(lock.load().first, kStores);
+}
+
+} // namespace tests
@@ -0,0 +1,203 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <hal/BinaryValue.hxx>
+#include <hal/IStreamWriter.hxx>
+
+#include <sim/RecordingLight.hxx>
+#include <sim/Simulator.hxx>
+#include <sim/TraceDecoder.hxx>
+#include <sim/VirtualClock.hxx>
+
+#include <staircase/TraceRing.hxx>
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace tests {
+
+constexpr sim::VirtualClock::Time kDay = 24 * 60 * 60 * 1000;
+
+TEST(RecordingLightTests, GivenLightIsSwitchedItRecordsOnTimeAndSwitchOns) {
+    sim::VirtualClock clock;
+    sim::RecordingLight light{clock};
+
+    light.writeValue(hal::BinaryValue::HIGH);
+    clock.advanceTo(300);
+    light.writeValue(hal::BinaryValue::HIGH);
+    clock.advanceTo(500);
+    light.writeValue(hal::BinaryValue::LOW);
+    clock.advanceTo(900);
+    light.writeValue(hal::BinaryValue::HIGH);
+    clock.advanceTo(1000);
+
+    EXPECT_TRUE(light.isOn());
+    EXPECT_EQ(light.getSwitchOns(), 2);
+    EXPECT_EQ(light.getOnTime(), 600);
+}
+
+TEST(SimulatorTests, GivenSameSeedRunsAreIdentical) {
+    sim::SimulationConfig config;
+    config.seed = 7;
+
+    auto first = std::make_unique<sim::Simulator>(config);
+    auto second = std::make_unique<sim::Simulator>(config);
+    first->run(kDay);
+    second->run(kDay / 2);
+    second->run(kDay / 2);
+
+    auto firstReport = first->getReport();
+    auto secondReport = second->getReport();
+    EXPECT_EQ(firstReport.simulatedTime, kDay);
+    EXPECT_EQ(firstReport.simulatedTime, secondReport.simulatedTime);
+    EXPECT_EQ(firstReport.pedestrians, secondReport.pedestrians);
+    EXPECT_EQ(firstReport.darkCheckpoints, secondReport.darkCheckpoints);
+    EXPECT_EQ(firstReport.lightOnTime, secondReport.lightOnTime);
+    EXPECT_EQ(firstReport.downMovingTime, secondReport.downMovingTime);
+}
+
+TEST(SimulatorTests, GivenTrafficLightsFollowPedestriansAndFiltersLearn) {
+    sim::SimulationConfig config;
+    config.traffic.minWalkDuration = 11000;
+    config.traffic.maxWalkDuration = 11000;
+
+    auto simulator = std::make_unique<sim::Simulator>(config);
+    simulator->run(kDay);
+
+    auto report = simulator->getReport();
+    EXPECT_GT(report.pedestrians, 100);
+    EXPECT_GT(report.lightSwitchOns, report.pedestrians);
+    EXPECT_LT(report.darkCheckpoints, report.checkpoints);
+    EXPECT_EQ(report.downMovingTime, 11000);
+    EXPECT_EQ(report.upMovingTime, 11000);
+}
+
+TEST(SimulatorTests, GivenFixedTickTrafficIsTheSameAsTickless) {
+    sim::SimulationConfig config;
+    auto tickless = std::make_unique<sim::Simulator>(config);
+    config.tickless = false;
+    auto ticked = std::make_unique<sim::Simulator>(config);
+
+    tickless->run(kDay / 8);
+    ticked->run(kDay / 8);
+
+    EXPECT_EQ(tickless->getReport().pedestrians,
+              ticked->getReport().pedestrians);
+    EXPECT_LT(tickless->getReport().updates, ticked->getReport().updates);
+}
+
+TEST(SimulatorTests, GivenMultiRateLooperItDecidesAsTheSingleRateOne) {
+    sim::SimulationConfig config;
+    config.tickless = false;
+    config.tick = 5;
+    auto single = std::make_unique<sim::Simulator>(config);
+    config.periods = {5, 50, 50};
+    auto multi = std::make_unique<sim::Simulator>(config);
+
+    single->run(kDay / 8);
+    multi->run(kDay / 8);
+
+    auto singleReport = single->getReport();
+    auto multiReport = multi->getReport();
+    EXPECT_GT(singleReport.walks, 10);
+    EXPECT_EQ(multiReport.walks, singleReport.walks);
+    EXPECT_EQ(multiReport.downMovingTime, singleReport.downMovingTime);
+    EXPECT_EQ(multiReport.upMovingTime, singleReport.upMovingTime);
+    EXPECT_EQ(multiReport.lightSwitchOns, singleReport.lightSwitchOns);
+    // Lights only switch at the end of a lights or movings period, which
+    // can move a pedestrian into or out of the dark now and then.
+    EXPECT_NEAR(static_cast<double>(multiReport.darkCheckpoints),
+                static_cast<double>(singleReport.darkCheckpoints),
+                singleReport.checkpoints / 100.0);
+    auto slack = singleReport.lightSwitchOns * 50;
+    EXPECT_GE(multiReport.lightOnTime + slack, singleReport.lightOnTime);
+    EXPECT_LE(multiReport.lightOnTime, singleReport.lightOnTime + slack);
+}
+
+TEST(SimulatorTests, GivenIdleParkingItWakesFarLessAndDecidesTheSame) {
+    sim::SimulationConfig config;
+    config.tickless = false;
+    auto ticked = std::make_unique<sim::Simulator>(config);
+    config.parkWhenIdle = true;
+    auto parked = std::make_unique<sim::Simulator>(config);
+
+    ticked->run(kDay / 8);
+    parked->run(kDay / 8);
+
+    auto tickedReport = ticked->getReport();
+    auto parkedReport = parked->getReport();
+    EXPECT_EQ(tickedReport.parkedTime, 0);
+    EXPECT_GT(parkedReport.parkedTime, parkedReport.simulatedTime / 2);
+    EXPECT_LT(parkedReport.wakeups * 2, tickedReport.wakeups);
+    EXPECT_EQ(parkedReport.pedestrians, tickedReport.pedestrians);
+    EXPECT_EQ(parkedReport.walks, tickedReport.walks);
+    EXPECT_EQ(parkedReport.lightSwitchOns, tickedReport.lightSwitchOns);
+}
+
+TEST(SimulatorTests, GivenOtherFiltersPerDirectionTheyLearnTheWalkToo) {
+    sim::SimulationConfig config;
+    config.traffic.minWalkDuration = 11000;
+    config.traffic.maxWalkDuration = 11000;
+    config.downFilter = sim::FilterType::MEDIAN;
+    config.upFilter = sim::FilterType::EWMA;
+
+    auto simulator = std::make_unique<sim::Simulator>(config);
+    simulator->run(kDay);
+
+    auto report = simulator->getReport();
+    EXPECT_EQ(report.downMovingTime, 11000);
+    EXPECT_EQ(report.upMovingTime, 11000);
+}
+
+TEST(TraceDecoderTests, GivenDumpItIsSplitIntoRecordsAndFormatted) {
+    std::vector<std::byte> dump;
+    for (const auto &record : {
+             staircase::TraceRecord{12345,
+                                    staircase::TraceEvent::MOVING_CREATE,
+                                    staircase::kTraceUp, 12000},
+             staircase::TraceRecord{12500, staircase::TraceEvent::LIGHT_ON,
+                                    7, 0},
+         }) {
+        auto encoded = staircase::encodeTraceRecord(record);
+        dump.insert(dump.end(), encoded.begin(), encoded.end());
+    }
+    dump.push_back(std::byte{0});
+
+    auto records = sim::decodeTrace(dump);
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(sim::formatTraceRecord(records[0]),
+              "     12.345 s  MOVING_CREATE    up, expected 12000 ms");
+    EXPECT_EQ(sim::formatTraceRecord(records[1]),
+              "     12.500 s  LIGHT_ON         light 7");
+}
+
+TEST(SimulatorTests, GivenTraceOutputTheLooperDecisionsAreDumped) {
+    if constexpr (!staircase::kTraceEnabled) {
+        GTEST_SKIP() << "built without STAIRCASE_TRACE";
+    }
+
+    class Dump final : public hal::IStreamWriter {
+      public:
+        std::size_t write(std::span<const std::byte> data) noexcept override {
+            bytes.insert(bytes.end(), data.begin(), data.end());
+            return data.size();
+        }
+
+        std::vector<std::byte> bytes;
+    } dump;
+
+    auto simulator = std::make_unique<sim::Simulator>(sim::SimulationConfig{});
+    simulator->traceTo(dump);
+    simulator->run(kDay / 24);
+
+    std::size_t creates = 0;
+    for (const auto &record : sim::decodeTrace(dump.bytes)) {
+        EXPECT_NE(record.event, staircase::TraceEvent::DROPPED);
+        creates += record.event == staircase::TraceEvent::MOVING_CREATE;
+    }
+    EXPECT_GT(creates, 0);
+}
+
+} // namespace tests
\ No newline at end of file
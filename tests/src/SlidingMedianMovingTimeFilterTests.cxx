@@ -0,0 +1,64 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <hal/Timing.hxx>
+
+#include <staircase/SlidingMedianMovingTimeFilter.hxx>
+
+namespace tests {
+
+TEST(SlidingMedianMovingTimeFilterTests,
+     GivenGetCurrentTimeIsCalledAfterInitializationItReturnsInitialValue) {
+    staircase::SlidingMedianMovingTimeFilter<> timeFilter{10000};
+    EXPECT_EQ(timeFilter.getCurrentMovingTime(), 10000);
+}
+
+TEST(SlidingMedianMovingTimeFilterTests,
+     GivenOutliersAreAMinorityOfTheWindowTheyAreIgnored) {
+    staircase::SlidingMedianMovingTimeFilter<5> timeFilter{10000};
+
+    timeFilter.processNewMovingTime(60000);
+    timeFilter.processNewMovingTime(1000);
+    EXPECT_EQ(timeFilter.getCurrentMovingTime(), 10000);
+}
+
+TEST(SlidingMedianMovingTimeFilterTests,
+     GivenNewMovingTimesBecomeTheMajorityTheMedianFollowsThem) {
+    staircase::SlidingMedianMovingTimeFilter<5> timeFilter{10000};
+
+    timeFilter.processNewMovingTime(8000);
+    timeFilter.processNewMovingTime(9000);
+    EXPECT_EQ(timeFilter.getCurrentMovingTime(), 10000);
+
+    timeFilter.processNewMovingTime(7000);
+    EXPECT_EQ(timeFilter.getCurrentMovingTime(), 9000);
+
+    timeFilter.processNewMovingTime(12000);
+    timeFilter.processNewMovingTime(11000);
+    EXPECT_EQ(timeFilter.getCurrentMovingTime(), 9000);
+
+    timeFilter.processNewMovingTime(13000);
+    EXPECT_EQ(timeFilter.getCurrentMovingTime(), 11000);
+}
+
+TEST(SlidingMedianMovingTimeFilterTests,
+     GivenEvenWindowTheMedianIsTheMeanOfTheMiddleValues) {
+    staircase::SlidingMedianMovingTimeFilter<4> timeFilter{10000};
+
+    timeFilter.processNewMovingTime(6000);
+    timeFilter.processNewMovingTime(6000);
+    EXPECT_EQ(timeFilter.getCurrentMovingTime(), 8000);
+}
+
+TEST(SlidingMedianMovingTimeFilterTests,
+     GivenProcessNewMovingTimeIsCalledResetReturnsToOldValue) {
+    staircase::SlidingMedianMovingTimeFilter<> timeFilter{10000};
+
+    timeFilter.processNewMovingTime(8000);
+    timeFilter.processNewMovingTime(8000);
+    timeFilter.processNewMovingTime(8000);
+    timeFilter.reset(10000);
+    EXPECT_EQ(timeFilter.getCurrentMovingTime(), 10000);
+}
+
+} // namespace tests
@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+
+#include <hal/INTP.hxx>
+#include <hal/ITask.hxx>
+#include <hal/Timing.hxx>
+
+#include <sim/DriftingRtc.hxx>
+#include <sim/LoopbackSntpServer.hxx>
+#include <sim/VirtualClock.hxx>
+
+#include <staircase/ClockDiscipline.hxx>
+#include <staircase/IRunnable.hxx>
+#include <staircase/NTPRunnable.hxx>
+#include <staircase/SntpClient.hxx>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+namespace tests {
+
+constexpr sim::VirtualClock::Time kHour = 60 * 60 * 1000;
+
+class RecordingNtpListener final : public hal::INTP::IListener {
+  public:
+    void onSample(const hal::INTP::Sample &sample) noexcept override {
+        samples.push_back(sample);
+    }
+
+    void onFailure() noexcept override { ++failures; }
+
+    std::vector<hal::INTP::Sample> samples;
+    int failures = 0;
+};
+
+class SntpClientTests : public ::testing::Test {
+  protected:
+    SntpClientTests()
+        : mRtc{mClock, 0, -3000}, mServer{mClock, 20, 30},
+          mClient{mServer, mRtc} {
+        mClock.advanceTo(10 * kHour);
+    }
+
+    void advance(hal::Milliseconds millis) {
+        mClock.advanceTo(mClock.now() + millis);
+        mClient.update(millis);
+    }
+
+    sim::VirtualClock mClock;
+    sim::DriftingRtc mRtc;
+    sim::LoopbackSntpServer mServer;
+    staircase::SntpClient mClient;
+    RecordingNtpListener mListener;
+};
+
+TEST_F(SntpClientTests, GIVENReplyTHENOffsetAndDelayAreMeasured) {
+    ASSERT_TRUE(mClient.request(mListener));
+    EXPECT_EQ(mClient.nextDeadline(), staircase::SntpClient::kTimeout);
+    EXPECT_EQ(mServer.nextDelivery(), 51);
+
+    advance(50);
+    EXPECT_TRUE(mListener.samples.empty());
+    advance(1);
+
+    ASSERT_EQ(mListener.samples.size(), 1);
+    // Half the difference of the two ways shows up in the offset.
+    EXPECT_EQ(mListener.samples[0].offset, 3000 - 5);
+    EXPECT_EQ(mListener.samples[0].delay, 50);
+    EXPECT_EQ(mClient.nextDeadline(), hal::kForever);
+}
+
+TEST_F(SntpClientTests, GIVENRequestInFlightTHENAnotherOneIsRefused) {
+    ASSERT_TRUE(mClient.request(mListener));
+
+    EXPECT_FALSE(mClient.request(mListener));
+    EXPECT_EQ(mServer.getRequests(), 1);
+}
+
+TEST_F(SntpClientTests, GIVENSilentServerTHENRequestTimesOut) {
+    mServer.setSilent(true);
+    ASSERT_TRUE(mClient.request(mListener));
+
+    advance(staircase::SntpClient::kTimeout - 1);
+    EXPECT_EQ(mListener.failures, 0);
+    EXPECT_EQ(mClient.nextDeadline(), 1);
+    advance(1);
+
+    EXPECT_EQ(mListener.failures, 1);
+    EXPECT_TRUE(mListener.samples.empty());
+    EXPECT_EQ(mClient.nextDeadline(), hal::kForever);
+}
+
+TEST_F(SntpClientTests, GIVENKissOfDeathTHENReplyIsDropped) {
+    mServer.setStratum(0);
+    ASSERT_TRUE(mClient.request(mListener));
+
+    advance(100);
+    EXPECT_TRUE(mListener.samples.empty());
+    advance(staircase::SntpClient::kTimeout);
+
+    EXPECT_EQ(mListener.failures, 1);
+}
+
+TEST_F(SntpClientTests, GIVENLateReplyToEarlierRequestTHENItIsNotTaken) {
+    mServer.setDelays(1500, 1500);
+    ASSERT_TRUE(mClient.request(mListener));
+    advance(staircase::SntpClient::kTimeout);
+    ASSERT_EQ(mListener.failures, 1);
+
+    mServer.setDelays(500, 1000);
+    ASSERT_TRUE(mClient.request(mListener));
+    advance(1001);
+    EXPECT_TRUE(mListener.samples.empty());
+    advance(500);
+
+    ASSERT_EQ(mListener.samples.size(), 1);
+    EXPECT_EQ(mListener.samples[0].delay, 1500);
+    EXPECT_EQ(mListener.samples[0].offset, 3000 - 250);
+}
+
+// Task on the virtual clock which the test steps by hand.
+class SteppedTask final : public hal::ITask {
+  public:
+    SteppedTask(staircase::IRunnable &runnable, const sim::VirtualClock &clock)
+        : ITask{runnable, staircase::NTPRunnable::kUpdateInterval},
+          mClock{clock} {}
+
+    hal::Milliseconds getDelta() const noexcept override { return step; }
+
+    hal::Milliseconds step = 0;
+
+  protected:
+    void sleep() noexcept override {}
+
+    hal::Timestamp now() const noexcept override {
+        return static_cast<hal::Timestamp>(mClock.now());
+    }
+
+  private:
+    const sim::VirtualClock &mClock;
+};
+
+TEST(NTPRunnableTests, GIVENDriftingRtcTHENItIsKeptOnTheServerTime) {
+    constexpr std::int32_t kDriftPpm = -150;
+
+    sim::VirtualClock clock;
+    sim::DriftingRtc rtc{clock, kDriftPpm, 5000};
+    sim::LoopbackSntpServer server{clock, 15, 25};
+    staircase::SntpClient client{server, rtc};
+    staircase::NTPRunnable runnable{rtc, client};
+    SteppedTask task{runnable, clock};
+
+    std::uint64_t runs = 0;
+    std::int64_t worstError = 0;
+    while (clock.now() < 12 * kHour) {
+        // Woken by the reply as well as by the runnable's own deadline.
+        auto step = hal::earliestDeadline(runnable.nextDeadline(),
+                                          server.nextDelivery());
+        task.step = std::max(step, 1);
+        clock.advanceTo(clock.now() + task.step);
+        static_cast<staircase::IRunnable &>(runnable).run();
+        ++runs;
+
+        if (clock.now() > 2 * kHour) {
+            worstError = std::max(worstError, std::abs(rtc.getError()));
+        }
+    }
+
+    const auto &discipline = runnable.getDiscipline();
+    EXPECT_TRUE(discipline.isSynchronised());
+    EXPECT_NEAR(discipline.getDriftPpm(), -kDriftPpm, 15);
+    // The five millisecond difference between the two ways stays.
+    EXPECT_LE(worstError, 10);
+    EXPECT_GT(discipline.getPollInterval(),
+              4 * staircase::ClockDiscipline::kMinPollInterval);
+    EXPECT_LT(server.getRequests(), 12 * kHour / 64000 / 4);
+    EXPECT_LT(runs, 12 * kHour / staircase::NTPRunnable::kUpdateInterval);
+}
+
+} // namespace tests
\ No newline at end of file
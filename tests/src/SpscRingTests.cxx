@@ -0,0 +1,113 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <util/SpscRing.hxx>
+
+#include <cstdint>
+#include <thread>
+
+namespace tests {
+
+TEST(SpscRingTests, Initialization) {
+    util::SpscRing<int, 4> ring;
+    int value = 0;
+
+    EXPECT_TRUE(ring.empty());
+    EXPECT_EQ(ring.size(), 0);
+    EXPECT_EQ(ring.capacity(), 4);
+    EXPECT_FALSE(ring.peek(value));
+    EXPECT_FALSE(ring.pop(value));
+}
+
+TEST(SpscRingTests, PushUntilFull) {
+    util::SpscRing<int, 4> ring;
+
+    EXPECT_TRUE(ring.push(6));
+    EXPECT_TRUE(ring.push(7));
+    EXPECT_TRUE(ring.push(8));
+    EXPECT_TRUE(ring.push(9));
+    EXPECT_FALSE(ring.push(10));
+    EXPECT_EQ(ring.size(), 4);
+}
+
+TEST(SpscRingTests, FailedPushesAreCounted) {
+    util::SpscRing<int, 2> ring;
+    int value = 0;
+
+    ring.push(6);
+    ring.push(7);
+    EXPECT_EQ(ring.overflows(), 0);
+
+    EXPECT_FALSE(ring.push(8));
+    EXPECT_FALSE(ring.push(9));
+    EXPECT_EQ(ring.overflows(), 2);
+
+    ring.pop(value);
+    EXPECT_TRUE(ring.push(10));
+    EXPECT_EQ(ring.overflows(), 2);
+}
+
+TEST(SpscRingTests, PopIsFifo) {
+    util::SpscRing<int, 4> ring;
+    int value = 0;
+
+    ring.push(6);
+    ring.push(7);
+
+    EXPECT_TRUE(ring.peek(value));
+    EXPECT_EQ(value, 6);
+    EXPECT_EQ(ring.size(), 2);
+
+    EXPECT_TRUE(ring.pop(value));
+    EXPECT_EQ(value, 6);
+    EXPECT_TRUE(ring.pop(value));
+    EXPECT_EQ(value, 7);
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(SpscRingTests, WrapAround) {
+    util::SpscRing<int, 4> ring;
+    int value = 0;
+
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(ring.push(i));
+        ASSERT_TRUE(ring.push(i + 100));
+        ASSERT_TRUE(ring.pop(value));
+        EXPECT_EQ(value, i);
+        ASSERT_TRUE(ring.pop(value));
+        EXPECT_EQ(value, i + 100);
+    }
+
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(SpscRingTests, ConcurrentProducerAndConsumerKeepOrder) {
+    constexpr std::uint32_t kCount = 20000;
+    util::SpscRing<std::uint32_t, 16> ring;
+
+    std::thread producer{[&ring]() {
+        for (std::uint32_t i = 0; i < kCount;) {
+            if (ring.push(i)) {
+                ++i;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }};
+
+    std::uint32_t expected = 0;
+    std::uint32_t value = 0;
+    while (expected < kCount) {
+        if (ring.pop(value)) {
+            ASSERT_EQ(value, expected);
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+    EXPECT_TRUE(ring.empty());
+}
+
+} // namespace tests
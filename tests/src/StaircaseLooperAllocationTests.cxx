@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+
+#include <hal/BinaryValue.hxx>
+#include <hal/IBinaryValueReader.hxx>
+#include <hal/IBinaryValueWriter.hxx>
+#include <hal/Timing.hxx>
+
+#include <staircase/BasicLight.hxx>
+#include <staircase/ClippedSquaredMovingDurationCalculator.hxx>
+#include <staircase/IBasicLight.hxx>
+#include <staircase/IMoving.hxx>
+#include <staircase/MTAMovingTimeFilter.hxx>
+#include <staircase/ProximitySensor.hxx>
+#include <staircase/StaircaseLooper.hxx>
+#include <staircase/StaticMovingFactory.hxx>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic_bool gCountAllocations{false};
+std::atomic<std::size_t> gAllocations{0};
+
+void *allocate(std::size_t size) {
+    if (gCountAllocations.load()) {
+        ++gAllocations;
+    }
+
+    void *memory = std::malloc(size == 0 ? 1 : size);
+    if (memory == nullptr) {
+        std::abort();
+    }
+
+    return memory;
+}
+
+} // namespace
+
+void *operator new(std::size_t size) { return allocate(size); }
+void *operator new[](std::size_t size) { return allocate(size); }
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete[](void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+namespace tests {
+
+class BinaryValueReaderStub final : public hal::IBinaryValueReader {
+  public:
+    hal::BinaryValue readValue() noexcept final { return mValue; }
+    void setValue(hal::BinaryValue value) noexcept { mValue = value; }
+
+  private:
+    hal::BinaryValue mValue{hal::BinaryValue::LOW};
+};
+
+class BinaryValueWriterStub final : public hal::IBinaryValueWriter {
+  public:
+    void writeValue(hal::BinaryValue value) noexcept final {
+        if (value == hal::BinaryValue::HIGH) {
+            ++mHighWrites;
+        }
+    }
+    std::size_t getHighWrites() const noexcept { return mHighWrites; }
+
+  private:
+    std::size_t mHighWrites{0};
+};
+
+class StaircaseLooperAllocationTests : public ::testing::Test {
+  public:
+    StaircaseLooperAllocationTests()
+        : mBasicLights{makeLights(std::make_index_sequence<kLightsNum>{})},
+          mBasicLightRefs{
+              makeLightRefs(std::make_index_sequence<kLightsNum>{})},
+          mDownSensor{mDownReader}, mUpSensor{mUpReader},
+          mDownFilter{INITIAL_MOVING_DURATION},
+          mUpFilter{INITIAL_MOVING_DURATION},
+          mStaircaseLooper{mBasicLightRefs, mDownSensor,         mUpSensor,
+                           mMovingFactory,  mDurationCalculator, mDownFilter,
+                           mUpFilter} {}
+
+    void SetUp() override {
+        gAllocations = 0;
+        gCountAllocations = true;
+    }
+
+    void TearDown() override { gCountAllocations = false; }
+
+  protected:
+    static constexpr std::size_t kLightsNum = staircase::IBasicLight::kLightsNum;
+    static constexpr hal::Milliseconds kTick = 10;
+    static constexpr hal::Milliseconds kTriggerTime = DEBOUNCE_PERIOD + 100;
+
+    template <std::size_t... I>
+    std::array<staircase::BasicLight, kLightsNum>
+    makeLights(std::index_sequence<I...>) {
+        return {staircase::BasicLight{mWriters[I]}...};
+    }
+
+    template <std::size_t... I>
+    staircase::BasicLights makeLightRefs(std::index_sequence<I...>) {
+        return {mBasicLights[I]...};
+    }
+
+    void run(hal::Milliseconds time) noexcept {
+        for (hal::Milliseconds passed = 0; passed < time; passed += kTick) {
+            mStaircaseLooper.update(kTick);
+        }
+    }
+
+    void trigger(BinaryValueReaderStub &reader) noexcept {
+        reader.setValue(hal::BinaryValue::HIGH);
+        run(kTriggerTime);
+        reader.setValue(hal::BinaryValue::LOW);
+        run(kTriggerTime);
+    }
+
+    std::size_t stopCounting() noexcept {
+        gCountAllocations = false;
+        return gAllocations.load();
+    }
+
+    std::array<BinaryValueWriterStub, kLightsNum> mWriters;
+    std::array<staircase::BasicLight, kLightsNum> mBasicLights;
+    staircase::BasicLights mBasicLightRefs;
+    BinaryValueReaderStub mDownReader;
+    BinaryValueReaderStub mUpReader;
+    staircase::ProximitySensor mDownSensor;
+    staircase::ProximitySensor mUpSensor;
+    staircase::StaticMovingFactory<2 * staircase::IMoving::kMaxMovings>
+        mMovingFactory;
+    staircase::ClippedSquaredMovingDurationCalculator mDurationCalculator;
+    staircase::MTAMovingTimeFilter mDownFilter;
+    staircase::MTAMovingTimeFilter mUpFilter;
+    staircase::StaircaseLooper mStaircaseLooper;
+};
+
+TEST_F(StaircaseLooperAllocationTests, GivenIdleStaircaseUpdateNeverAllocates) {
+    run(10 * INITIAL_MOVING_DURATION);
+
+    EXPECT_EQ(stopCounting(), 0);
+}
+
+TEST_F(StaircaseLooperAllocationTests,
+       GivenWalksInBothDirectionsUpdateAndSensorHandlingNeverAllocate) {
+    trigger(mDownReader);
+    run(INITIAL_MOVING_DURATION - MOVING_FINISH_DELTA);
+    trigger(mUpReader);
+
+    trigger(mUpReader);
+    run(INITIAL_MOVING_DURATION - MOVING_FINISH_DELTA);
+    trigger(mDownReader);
+
+    run(2 * INITIAL_MOVING_DURATION);
+
+    EXPECT_EQ(stopCounting(), 0);
+    EXPECT_NE(mUpFilter.getCurrentMovingTime(), INITIAL_MOVING_DURATION);
+    EXPECT_NE(mDownFilter.getCurrentMovingTime(), INITIAL_MOVING_DURATION);
+    EXPECT_GT(mWriters.front().getHighWrites(), 0);
+    EXPECT_GT(mWriters.back().getHighWrites(), 0);
+}
+
+TEST_F(StaircaseLooperAllocationTests,
+       GivenMaxMovingsInBothDirectionsUpdateNeverAllocates) {
+    for (std::size_t i = 0; i < staircase::IMoving::kMaxMovings + 1; ++i) {
+        trigger(mDownReader);
+        trigger(mUpReader);
+        run(MOVING_FINISH_DELTA);
+    }
+
+    run(2 * INITIAL_MOVING_DURATION);
+
+    EXPECT_EQ(stopCounting(), 0);
+}
+
+} // namespace tests
@@ -2,25 +2,38 @@
 #include <gtest/gtest.h>
 
 #include <mocks/BasicLightMock.hxx>
+#include <mocks/BinaryValueWriterMock.hxx>
+#include <mocks/LightBankMock.hxx>
+#include <mocks/LightPortMock.hxx>
 #include <mocks/MovingDurationCalculatorMock.hxx>
 #include <mocks/MovingFactoryMock.hxx>
 #include <mocks/MovingMock.hxx>
 #include <mocks/MovingTimeFilterMock.hxx>
 #include <mocks/ProximitySensorMock.hxx>
 
+#include <hal/ICycleCounter.hxx>
 #include <hal/Timing.hxx>
 
+#include <staircase/BasicLight.hxx>
+#include <staircase/BasicMovingFactory.hxx>
 #include <staircase/IBasicLight.hxx>
 #include <staircase/IMoving.hxx>
+#include <staircase/LooperCommand.hxx>
 #include <staircase/Moving.hxx>
 #include <staircase/StaircaseLooper.hxx>
+#include <staircase/TickProfile.hxx>
+#include <staircase/TraceRing.hxx>
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
 
 namespace tests {
 
 using ::testing::_;
+using ::testing::ByMove;
 using ::testing::Exactly;
 using ::testing::InSequence;
 using ::testing::Invoke;
@@ -28,6 +41,15 @@ using ::testing::NiceMock;
 using ::testing::Ref;
 using ::testing::Return;
 
+// Each test runs against the IStaircaseLooper adapter and against the
+// template it wraps, so the two cannot drift apart.
+using Loopers = ::testing::Types<staircase::StaircaseLooper,
+                                 staircase::InterfaceStaircaseLooper>;
+
+constexpr hal::Milliseconds kDefaultTime = 123;
+constexpr hal::Milliseconds kDefaultMovingTime = 12100;
+constexpr hal::Milliseconds kTick = 10;
+
 template <typename T> class ReturnOnce {
   public:
     ReturnOnce(const T &first, const T &other)
@@ -48,6 +70,7 @@ template <typename T> class ReturnOnce {
     bool mIsFirst;
 };
 
+template <class Looper>
 class StaircaseLooperTests : public ::testing::Test {
   public:
     void SetUp() {
@@ -66,9 +89,6 @@ class StaircaseLooperTests : public ::testing::Test {
                            mUpFilter} {}
 
   protected:
-    static constexpr hal::Milliseconds kDefaultTime = 123;
-    static constexpr hal::Milliseconds kDefaultMovingTime = 12100;
-
     std::array<NiceMock<mocks::BasicLightMock>,
                staircase::IBasicLight::kLightsNum>
         mBasicLights;
@@ -80,84 +100,104 @@ class StaircaseLooperTests : public ::testing::Test {
     NiceMock<mocks::MovingTimeFilterMock> mDownFilter;
     NiceMock<mocks::MovingTimeFilterMock> mUpFilter;
 
-    staircase::StaircaseLooper mStaircaseLooper;
+    Looper mStaircaseLooper;
 };
 
-class StaircaseLooperUpdateTests : public StaircaseLooperTests {};
+TYPED_TEST_SUITE(StaircaseLooperTests, Loopers);
+
+template <class Looper>
+class StaircaseLooperUpdateTests : public StaircaseLooperTests<Looper> {};
+
+TYPED_TEST_SUITE(StaircaseLooperUpdateTests, Loopers);
 
-TEST_F(StaircaseLooperUpdateTests, GIVENUpdateIsCalledTHENItUpdatesAllLights) {
-    std::for_each(
-        std::begin(mBasicLights), std::end(mBasicLights), [](auto &basicLight) {
-            EXPECT_CALL(basicLight, update(kDefaultTime)).Times(Exactly(1));
-        });
+TYPED_TEST(StaircaseLooperUpdateTests,
+           GIVENUpdateIsCalledTHENItUpdatesAllLights) {
+    std::for_each(std::begin(this->mBasicLights), std::end(this->mBasicLights),
+                  [](auto &basicLight) {
+                      EXPECT_CALL(basicLight, update(kDefaultTime))
+                          .Times(Exactly(1));
+                  });
 
-    mStaircaseLooper.update(kDefaultTime);
+    this->mStaircaseLooper.update(kDefaultTime);
 }
 
-TEST_F(StaircaseLooperUpdateTests, GIVENUpdateIsCalledTHENItUpdatesUpSensor) {
-    EXPECT_CALL(mUpSensor, update(kDefaultTime)).Times(Exactly(1));
-    mStaircaseLooper.update(kDefaultTime);
+TYPED_TEST(StaircaseLooperUpdateTests,
+           GIVENUpdateIsCalledTHENItUpdatesUpSensor) {
+    EXPECT_CALL(this->mUpSensor, update(kDefaultTime)).Times(Exactly(1));
+    this->mStaircaseLooper.update(kDefaultTime);
 }
 
-TEST_F(StaircaseLooperUpdateTests, GIVENUpdateIsCalledTHENItUpdatesDownSensor) {
-    EXPECT_CALL(mDownSensor, update(kDefaultTime)).Times(Exactly(1));
-    mStaircaseLooper.update(kDefaultTime);
+TYPED_TEST(StaircaseLooperUpdateTests,
+           GIVENUpdateIsCalledTHENItUpdatesDownSensor) {
+    EXPECT_CALL(this->mDownSensor, update(kDefaultTime)).Times(Exactly(1));
+    this->mStaircaseLooper.update(kDefaultTime);
 }
 
-class StaircaseLooperDownMovingCreateTests : public StaircaseLooperTests {};
+template <class Looper>
+class StaircaseLooperDownMovingCreateTests
+    : public StaircaseLooperTests<Looper> {};
 
-TEST_F(
+TYPED_TEST_SUITE(StaircaseLooperDownMovingCreateTests, Loopers);
+
+TYPED_TEST(
     StaircaseLooperDownMovingCreateTests,
     GIVENUpSensorChangesToCloseAndThereAreNoOtherMovingsDuringUpdateTHENNewDownMovingIsCreated) {
-    EXPECT_CALL(mUpSensor, hasStateChanged()).WillOnce(Return(true));
-    EXPECT_CALL(mUpSensor, isClose()).WillOnce(Return(true));
-    EXPECT_CALL(mDownFilter, getCurrentMovingTime())
+    EXPECT_CALL(this->mUpSensor, hasStateChanged()).WillOnce(Return(true));
+    EXPECT_CALL(this->mUpSensor, isClose()).WillOnce(Return(true));
+    EXPECT_CALL(this->mDownFilter, getCurrentMovingTime())
         .WillOnce(Return(kDefaultMovingTime));
-    EXPECT_CALL(mMovingFactory,
-                create(Ref(mBasicLightRefs), Ref(mDurationCalculator),
+    EXPECT_CALL(this->mMovingFactory,
+                create(Ref(this->mBasicLightRefs),
+                       Ref(this->mDurationCalculator),
                        staircase::IMoving::Direction::DOWN, kDefaultMovingTime))
-        .WillOnce(Return(nullptr));
+        .WillOnce(Return(ByMove(staircase::MovingPtr{})));
 
-    mStaircaseLooper.update(kDefaultTime);
+    this->mStaircaseLooper.update(kDefaultTime);
 }
 
-TEST_F(
+TYPED_TEST(
     StaircaseLooperDownMovingCreateTests,
     GIVENUpSensorChangesToCloseOnlyOnceAndThereAreNoOtherMovingsDuringUpdateTHENOnlyOneNewDownMovingIsCreated) {
-    EXPECT_CALL(mUpSensor, hasStateChanged())
+    EXPECT_CALL(this->mUpSensor, hasStateChanged())
         .WillOnce(Return(true))
         .WillRepeatedly(Return(false));
-    EXPECT_CALL(mUpSensor, isClose()).Times(Exactly(1)).WillOnce(Return(true));
-    EXPECT_CALL(mDownFilter, getCurrentMovingTime())
+    EXPECT_CALL(this->mUpSensor, isClose())
+        .Times(Exactly(1))
+        .WillOnce(Return(true));
+    EXPECT_CALL(this->mDownFilter, getCurrentMovingTime())
         .Times(Exactly(1))
         .WillOnce(Return(kDefaultMovingTime));
-    EXPECT_CALL(mMovingFactory,
-                create(Ref(mBasicLightRefs), Ref(mDurationCalculator),
+    EXPECT_CALL(this->mMovingFactory,
+                create(Ref(this->mBasicLightRefs),
+                       Ref(this->mDurationCalculator),
                        staircase::IMoving::Direction::DOWN, kDefaultMovingTime))
         .Times(Exactly(1))
-        .WillOnce(Return(nullptr));
+        .WillOnce(Return(ByMove(staircase::MovingPtr{})));
 
-    mStaircaseLooper.update(kDefaultTime);
-    mStaircaseLooper.update(kDefaultTime);
-    mStaircaseLooper.update(kDefaultTime);
+    this->mStaircaseLooper.update(kDefaultTime);
+    this->mStaircaseLooper.update(kDefaultTime);
+    this->mStaircaseLooper.update(kDefaultTime);
 }
 
-class StaircaseLooperDownMovingCreatedTests : public StaircaseLooperTests {
+template <class Looper>
+class StaircaseLooperDownMovingCreatedTests
+    : public StaircaseLooperTests<Looper> {
   public:
     void SetUp() override {
-        StaircaseLooperTests::SetUp();
-        ON_CALL(mUpSensor, hasStateChanged())
+        StaircaseLooperTests<Looper>::SetUp();
+        ON_CALL(this->mUpSensor, hasStateChanged())
             .WillByDefault(ReturnOnce(true, false));
-        ON_CALL(mUpSensor, isClose()).WillByDefault(Return(true));
-        ON_CALL(mDownFilter, getCurrentMovingTime())
+        ON_CALL(this->mUpSensor, isClose()).WillByDefault(Return(true));
+        ON_CALL(this->mDownFilter, getCurrentMovingTime())
             .WillByDefault(Return(kDefaultMovingTime));
-        ON_CALL(mMovingFactory,
-                create(Ref(mBasicLightRefs), Ref(mDurationCalculator),
+        ON_CALL(this->mMovingFactory,
+                create(Ref(this->mBasicLightRefs),
+                       Ref(this->mDurationCalculator),
                        staircase::IMoving::Direction::DOWN, kDefaultMovingTime))
             .WillByDefault(Invoke(
                 this, &StaircaseLooperDownMovingCreatedTests::createMovingPtr));
 
-        mStaircaseLooper.update(kDefaultTime);
+        this->mStaircaseLooper.update(kDefaultTime);
     }
 
     staircase::MovingPtr createMovingPtr() noexcept {
@@ -168,140 +208,183 @@ class StaircaseLooperDownMovingCreatedTests : public StaircaseLooperTests {
     NiceMock<mocks::MovingMock> mMoving;
 };
 
+TYPED_TEST_SUITE(StaircaseLooperDownMovingCreatedTests, Loopers);
+
+template <class Looper>
 class StaircaseLooperDownMovingUpdateTests
-    : public StaircaseLooperDownMovingCreatedTests {};
+    : public StaircaseLooperDownMovingCreatedTests<Looper> {};
 
-TEST_F(StaircaseLooperDownMovingUpdateTests,
-       GIVENThereIsOneMovingDuringUpdateTHENThatMovingIsUpdate) {
-    EXPECT_CALL(mMoving, update(kDefaultTime)).Times(1);
-    mStaircaseLooper.update(kDefaultTime);
+TYPED_TEST_SUITE(StaircaseLooperDownMovingUpdateTests, Loopers);
+
+TYPED_TEST(StaircaseLooperDownMovingUpdateTests,
+           GIVENThereIsOneMovingDuringUpdateTHENThatMovingIsUpdate) {
+    EXPECT_CALL(this->mMoving, update(kDefaultTime)).Times(1);
+    this->mStaircaseLooper.update(kDefaultTime);
 }
 
+template <class Looper>
 class StaircaseLooperDownMovingFinishesTests
-    : public StaircaseLooperDownMovingCreatedTests {
+    : public StaircaseLooperDownMovingCreatedTests<Looper> {
   public:
     void SetUp() override {
-        StaircaseLooperDownMovingCreatedTests::SetUp();
-        EXPECT_CALL(mDownSensor, hasStateChanged())
+        StaircaseLooperDownMovingCreatedTests<Looper>::SetUp();
+        EXPECT_CALL(this->mDownSensor, hasStateChanged())
             .WillOnce(Return(true))
             .WillRepeatedly(Return(false));
-        EXPECT_CALL(mDownSensor, isClose()).WillOnce(Return(true));
+        EXPECT_CALL(this->mDownSensor, isClose()).WillOnce(Return(true));
     }
 };
 
-TEST_F(
+TYPED_TEST_SUITE(StaircaseLooperDownMovingFinishesTests, Loopers);
+
+TYPED_TEST(
     StaircaseLooperDownMovingFinishesTests,
     GIVENThereIsOneMovingAndDownSensorIsTriggeredAndTheMovingIsNotCloseToTheEndDuringUpdateTHENMovingIsNotFinishedAndIsUpdatedNextTime) {
-    EXPECT_CALL(mMoving, isNearEnd()).Times(Exactly(1)).WillOnce(Return(false));
-    mStaircaseLooper.update(kDefaultTime);
+    EXPECT_CALL(this->mMoving, isNearEnd())
+        .Times(Exactly(1))
+        .WillOnce(Return(false));
+    this->mStaircaseLooper.update(kDefaultTime);
 
-    EXPECT_CALL(mMoving, update(kDefaultTime)).Times(1);
-    mStaircaseLooper.update(kDefaultTime);
+    EXPECT_CALL(this->mMoving, update(kDefaultTime)).Times(1);
+    this->mStaircaseLooper.update(kDefaultTime);
 }
 
-TEST_F(
+TYPED_TEST(
     StaircaseLooperDownMovingFinishesTests,
     GIVENThereIsOneMovingAndDownSensorIsTriggeredAndTheMovingIsCloseToTheEndDuringUpdateTHENMovingIsFinished) {
-    EXPECT_CALL(mMoving, isNearEnd()).Times(Exactly(1)).WillOnce(Return(true));
-    mStaircaseLooper.update(kDefaultTime);
+    EXPECT_CALL(this->mMoving, isNearEnd())
+        .Times(Exactly(1))
+        .WillOnce(Return(true));
+    this->mStaircaseLooper.update(kDefaultTime);
 
-    EXPECT_CALL(mMoving, update(kDefaultTime)).Times(Exactly(0));
-    mStaircaseLooper.update(kDefaultTime);
+    EXPECT_CALL(this->mMoving, update(kDefaultTime)).Times(Exactly(0));
+    this->mStaircaseLooper.update(kDefaultTime);
 }
 
-TEST_F(StaircaseLooperDownMovingFinishesTests,
-       GIVENThereIsOneMovingAndItIsNotStaleTHENItIsUpdated) {
-    EXPECT_CALL(mMoving, isTooOld()).Times(2).WillRepeatedly(Return(false));
-    mStaircaseLooper.update(kDefaultTime);
+TYPED_TEST(StaircaseLooperDownMovingFinishesTests,
+           GIVENMovingIsFinishedBySensorTHENSnapshotCountsTheWalk) {
+    EXPECT_CALL(this->mMoving, isNearEnd()).WillOnce(Return(true));
+    this->mStaircaseLooper.update(kDefaultTime);
 
-    EXPECT_CALL(mMoving, update(kDefaultTime)).Times(1);
-    mStaircaseLooper.update(kDefaultTime);
+    auto snapshot = this->mStaircaseLooper.snapshot();
+    EXPECT_EQ(snapshot.downWalks, 1);
+    EXPECT_EQ(snapshot.upWalks, 0);
+    EXPECT_EQ(snapshot.triggers, 2);
 }
 
-TEST_F(StaircaseLooperDownMovingFinishesTests,
-       GIVENThereIsOneMovingAndItIsStaleTHENItIsRemoved) {
-    EXPECT_CALL(mMoving, isTooOld()).Times(Exactly(1)).WillOnce(Return(true));
-    mStaircaseLooper.update(kDefaultTime);
+TYPED_TEST(StaircaseLooperDownMovingFinishesTests,
+           GIVENMovingIsNotNearEndTHENSnapshotDoesNotCountTheWalk) {
+    EXPECT_CALL(this->mMoving, isNearEnd()).WillOnce(Return(false));
+    this->mStaircaseLooper.update(kDefaultTime);
 
-    EXPECT_CALL(mMoving, update(kDefaultTime)).Times(Exactly(0));
-    mStaircaseLooper.update(kDefaultTime);
+    auto snapshot = this->mStaircaseLooper.snapshot();
+    EXPECT_EQ(snapshot.downWalks, 0);
+    EXPECT_EQ(snapshot.triggers, 2);
 }
 
+TYPED_TEST(StaircaseLooperDownMovingFinishesTests,
+           GIVENThereIsOneMovingAndItIsNotStaleTHENItIsUpdated) {
+    EXPECT_CALL(this->mMoving, isTooOld())
+        .Times(2)
+        .WillRepeatedly(Return(false));
+    this->mStaircaseLooper.update(kDefaultTime);
+
+    EXPECT_CALL(this->mMoving, update(kDefaultTime)).Times(1);
+    this->mStaircaseLooper.update(kDefaultTime);
+}
+
+TYPED_TEST(StaircaseLooperDownMovingFinishesTests,
+           GIVENThereIsOneMovingAndItIsStaleTHENItIsRemoved) {
+    EXPECT_CALL(this->mMoving, isTooOld())
+        .Times(Exactly(1))
+        .WillOnce(Return(true));
+    this->mStaircaseLooper.update(kDefaultTime);
+
+    EXPECT_CALL(this->mMoving, update(kDefaultTime)).Times(Exactly(0));
+    this->mStaircaseLooper.update(kDefaultTime);
+}
+
+template <class Looper>
 class StaircaseLooperDownMovingJustStarted
-    : public StaircaseLooperDownMovingCreatedTests {};
+    : public StaircaseLooperDownMovingCreatedTests<Looper> {};
+
+TYPED_TEST_SUITE(StaircaseLooperDownMovingJustStarted, Loopers);
 
-TEST_F(
+TYPED_TEST(
     StaircaseLooperDownMovingJustStarted,
     GIVENNewMovingHasJustBeenCreatedAndItHasJustStartedAndSensorIsCloseTHENNewMovingCannotBeCreated) {
-    EXPECT_CALL(mMoving, isNearBegin())
+    EXPECT_CALL(this->mMoving, isNearBegin())
         .Times(Exactly(1))
         .WillOnce(Return(true));
-    EXPECT_CALL(mUpSensor, hasStateChanged()).WillOnce(Return(true));
-    EXPECT_CALL(mUpSensor, isClose()).WillOnce(Return(true));
-    EXPECT_CALL(mMovingFactory, create(_, _, _, _)).Times(Exactly(0));
+    EXPECT_CALL(this->mUpSensor, hasStateChanged()).WillOnce(Return(true));
+    EXPECT_CALL(this->mUpSensor, isClose()).WillOnce(Return(true));
+    EXPECT_CALL(this->mMovingFactory, create(_, _, _, _)).Times(Exactly(0));
 
-    mStaircaseLooper.update(kDefaultTime);
+    this->mStaircaseLooper.update(kDefaultTime);
 }
 
-TEST_F(
+TYPED_TEST(
     StaircaseLooperDownMovingJustStarted,
     GIVENNewMovingHasJustBeenCreatedAndItHasNotJustStartedAndSensorIsCloseTHENNewMovingIsCreated) {
     NiceMock<mocks::MovingMock> newMoving;
-    EXPECT_CALL(mMoving, isNearBegin())
+    EXPECT_CALL(this->mMoving, isNearBegin())
         .Times(Exactly(1))
         .WillOnce(Return(false));
-    EXPECT_CALL(mUpSensor, hasStateChanged()).WillOnce(Return(true));
-    EXPECT_CALL(mUpSensor, isClose()).WillOnce(Return(true));
-    EXPECT_CALL(mDownFilter, getCurrentMovingTime())
+    EXPECT_CALL(this->mUpSensor, hasStateChanged()).WillOnce(Return(true));
+    EXPECT_CALL(this->mUpSensor, isClose()).WillOnce(Return(true));
+    EXPECT_CALL(this->mDownFilter, getCurrentMovingTime())
         .WillOnce(Return(kDefaultMovingTime));
-    EXPECT_CALL(mMovingFactory,
-                create(Ref(mBasicLightRefs), Ref(mDurationCalculator),
+    EXPECT_CALL(this->mMovingFactory,
+                create(Ref(this->mBasicLightRefs),
+                       Ref(this->mDurationCalculator),
                        staircase::IMoving::Direction::DOWN, kDefaultMovingTime))
         .WillOnce(Invoke([&]() {
             return staircase::MovingPtr{&newMoving,
                                         [](staircase::IMoving *) {}};
         }));
 
-    mStaircaseLooper.update(kDefaultTime);
+    this->mStaircaseLooper.update(kDefaultTime);
 }
 
-class StaircaseLooperTwoDownMovingsCreated
-    : public StaircaseLooperDownMovingCreatedTests
-
-      TEST_F(StaircaseLooperTests,
-             GivenDownSensorStateChangedToCloseNewUpMovingIsCreated) {
+TYPED_TEST(StaircaseLooperTests,
+           GivenDownSensorStateChangedToCloseNewUpMovingIsCreated) {
     InSequence s;
 
-    EXPECT_CALL(mDownSensor, hasStateChanged()).WillOnce(Return(true));
-    EXPECT_CALL(mDownSensor, isClose()).WillOnce(Return(true));
-    EXPECT_CALL(mUpFilter, getCurrentMovingTime()).WillOnce(Return(12000));
-    EXPECT_CALL(mMovingFactory,
-                create(Ref(mBasicLightRefs), Ref(mDurationCalculator),
+    EXPECT_CALL(this->mDownSensor, hasStateChanged()).WillOnce(Return(true));
+    EXPECT_CALL(this->mDownSensor, isClose()).WillOnce(Return(true));
+    EXPECT_CALL(this->mUpFilter, getCurrentMovingTime())
+        .WillOnce(Return(12000));
+    EXPECT_CALL(this->mMovingFactory,
+                create(Ref(this->mBasicLightRefs),
+                       Ref(this->mDurationCalculator),
                        staircase::IMoving::Direction::UP, 12000))
         .WillOnce(Invoke([]() {
             return staircase::MovingPtr{nullptr,
                                         [](staircase::IMoving *moving) {}};
         }));
-    mStaircaseLooper.update(100);
+    this->mStaircaseLooper.update(100);
 }
 
-TEST_F(StaircaseLooperTests, OneUpMovingToStale) {
+TYPED_TEST(StaircaseLooperTests, OneUpMovingToStale) {
     NiceMock<mocks::MovingMock> moving;
 
     {
         InSequence s;
 
-        EXPECT_CALL(mDownSensor, hasStateChanged()).WillOnce(Return(true));
-        EXPECT_CALL(mDownSensor, isClose()).WillOnce(Return(true));
-        EXPECT_CALL(mUpFilter, getCurrentMovingTime()).WillOnce(Return(12000));
-        EXPECT_CALL(mMovingFactory,
-                    create(Ref(mBasicLightRefs), Ref(mDurationCalculator),
+        EXPECT_CALL(this->mDownSensor, hasStateChanged())
+            .WillOnce(Return(true));
+        EXPECT_CALL(this->mDownSensor, isClose()).WillOnce(Return(true));
+        EXPECT_CALL(this->mUpFilter, getCurrentMovingTime())
+            .WillOnce(Return(12000));
+        EXPECT_CALL(this->mMovingFactory,
+                    create(Ref(this->mBasicLightRefs),
+                           Ref(this->mDurationCalculator),
                            staircase::IMoving::Direction::UP, 12000))
             .WillOnce(Invoke([&moving]() {
                 return staircase::MovingPtr{&moving,
                                             [](staircase::IMoving *moving) {}};
             }));
-        mStaircaseLooper.update(100);
+        this->mStaircaseLooper.update(100);
     }
 
     {
@@ -309,96 +392,109 @@ TEST_F(StaircaseLooperTests, OneUpMovingToStale) {
 
         EXPECT_CALL(moving, update(100)).Times(Exactly(1));
         EXPECT_CALL(moving, isTooOld()).WillOnce(Return(true));
-        EXPECT_CALL(mDownSensor, hasStateChanged()).WillOnce(Return(false));
-        mStaircaseLooper.update(100);
+        EXPECT_CALL(this->mDownSensor, hasStateChanged())
+            .WillOnce(Return(false));
+        this->mStaircaseLooper.update(100);
     }
 
     {
         InSequence s;
 
         EXPECT_CALL(moving, update(_)).Times(Exactly(0));
-        EXPECT_CALL(mDownSensor, hasStateChanged()).WillOnce(Return(false));
-        mStaircaseLooper.update(100);
+        EXPECT_CALL(this->mDownSensor, hasStateChanged())
+            .WillOnce(Return(false));
+        this->mStaircaseLooper.update(100);
     }
 }
 
-TEST_F(StaircaseLooperTests, OneUpMovingEndBySensor) {
+TYPED_TEST(StaircaseLooperTests, OneUpMovingEndBySensor) {
     NiceMock<mocks::MovingMock> moving;
 
     {
         InSequence s;
 
-        EXPECT_CALL(mDownSensor, hasStateChanged()).WillOnce(Return(true));
-        EXPECT_CALL(mDownSensor, isClose()).WillOnce(Return(true));
-        EXPECT_CALL(mUpFilter, getCurrentMovingTime()).WillOnce(Return(12000));
-        EXPECT_CALL(mMovingFactory,
-                    create(Ref(mBasicLightRefs), Ref(mDurationCalculator),
+        EXPECT_CALL(this->mDownSensor, hasStateChanged())
+            .WillOnce(Return(true));
+        EXPECT_CALL(this->mDownSensor, isClose()).WillOnce(Return(true));
+        EXPECT_CALL(this->mUpFilter, getCurrentMovingTime())
+            .WillOnce(Return(12000));
+        EXPECT_CALL(this->mMovingFactory,
+                    create(Ref(this->mBasicLightRefs),
+                           Ref(this->mDurationCalculator),
                            staircase::IMoving::Direction::UP, 12000))
             .WillOnce(Invoke([&moving]() {
                 return staircase::MovingPtr{&moving,
                                             [](staircase::IMoving *moving) {}};
             }));
-        mStaircaseLooper.update(100);
+        this->mStaircaseLooper.update(100);
     }
 
     {
         InSequence s;
 
         EXPECT_CALL(moving, update(100)).Times(Exactly(1));
-        EXPECT_CALL(mDownSensor, hasStateChanged()).WillOnce(Return(false));
-        EXPECT_CALL(mUpSensor, hasStateChanged()).WillOnce(Return(true));
-        EXPECT_CALL(mUpSensor, isClose()).WillOnce(Return(true));
+        EXPECT_CALL(this->mDownSensor, hasStateChanged())
+            .WillOnce(Return(false));
+        EXPECT_CALL(this->mUpSensor, hasStateChanged()).WillOnce(Return(true));
+        EXPECT_CALL(this->mUpSensor, isClose()).WillOnce(Return(true));
         EXPECT_CALL(moving, isNearEnd()).WillOnce(Return(true));
         EXPECT_CALL(moving, getTimePassed()).WillOnce(Return(8000));
-        EXPECT_CALL(mUpFilter, processNewMovingTime(8000)).Times(Exactly(1));
-        mStaircaseLooper.update(100);
+        EXPECT_CALL(this->mUpFilter, processNewMovingTime(8000))
+            .Times(Exactly(1));
+        EXPECT_CALL(this->mUpFilter, getCurrentMovingTime())
+            .WillOnce(Return(9600));
+        this->mStaircaseLooper.update(100);
     }
 
     {
         InSequence s;
 
         EXPECT_CALL(moving, update(_)).Times(Exactly(0));
-        EXPECT_CALL(mDownSensor, hasStateChanged()).WillOnce(Return(false));
-        EXPECT_CALL(mUpSensor, hasStateChanged()).WillOnce(Return(false));
-        mStaircaseLooper.update(100);
+        EXPECT_CALL(this->mDownSensor, hasStateChanged())
+            .WillOnce(Return(false));
+        EXPECT_CALL(this->mUpSensor, hasStateChanged()).WillOnce(Return(false));
+        this->mStaircaseLooper.update(100);
     }
 }
 
-TEST_F(StaircaseLooperTests,
-       GivenUpSensorStateChangedToCloseNewDownMovingIsCreated) {
+TYPED_TEST(StaircaseLooperTests,
+           GivenUpSensorStateChangedToCloseNewDownMovingIsCreated) {
     InSequence s;
 
-    EXPECT_CALL(mUpSensor, hasStateChanged()).WillOnce(Return(true));
-    EXPECT_CALL(mUpSensor, isClose()).WillOnce(Return(true));
-    EXPECT_CALL(mDownFilter, getCurrentMovingTime()).WillOnce(Return(12000));
-    EXPECT_CALL(mMovingFactory,
-                create(Ref(mBasicLightRefs), Ref(mDurationCalculator),
+    EXPECT_CALL(this->mUpSensor, hasStateChanged()).WillOnce(Return(true));
+    EXPECT_CALL(this->mUpSensor, isClose()).WillOnce(Return(true));
+    EXPECT_CALL(this->mDownFilter, getCurrentMovingTime())
+        .WillOnce(Return(12000));
+    EXPECT_CALL(this->mMovingFactory,
+                create(Ref(this->mBasicLightRefs),
+                       Ref(this->mDurationCalculator),
                        staircase::IMoving::Direction::DOWN, 12000))
         .WillOnce(Invoke([]() {
             return staircase::MovingPtr{nullptr,
                                         [](staircase::IMoving *moving) {}};
         }));
-    mStaircaseLooper.update(100);
+    this->mStaircaseLooper.update(100);
 }
 
-TEST_F(StaircaseLooperTests, OneDownMovingToStale) {
+TYPED_TEST(StaircaseLooperTests, OneDownMovingToStale) {
     NiceMock<mocks::MovingMock> moving;
 
     {
         InSequence s;
 
-        EXPECT_CALL(mUpSensor, hasStateChanged()).WillOnce(Return(true));
-        EXPECT_CALL(mUpSensor, isClose()).WillOnce(Return(true));
-        EXPECT_CALL(mDownFilter, getCurrentMovingTime())
+        EXPECT_CALL(this->mUpSensor, hasStateChanged()).WillOnce(Return(true));
+        EXPECT_CALL(this->mUpSensor, isClose()).WillOnce(Return(true));
+        EXPECT_CALL(this->mDownFilter, getCurrentMovingTime())
             .WillOnce(Return(12000));
-        EXPECT_CALL(mMovingFactory,
-                    create(Ref(mBasicLightRefs), Ref(mDurationCalculator),
+        EXPECT_CALL(this->mMovingFactory,
+                    create(Ref(this->mBasicLightRefs),
+                           Ref(this->mDurationCalculator),
                            staircase::IMoving::Direction::DOWN, 12000))
             .WillOnce(Invoke([&moving]() {
                 return staircase::MovingPtr{&moving,
                                             [](staircase::IMoving *moving) {}};
             }));
-        mStaircaseLooper.update(100);
+        this->mStaircaseLooper.update(100);
     }
 
     {
@@ -406,60 +502,823 @@ TEST_F(StaircaseLooperTests, OneDownMovingToStale) {
 
         EXPECT_CALL(moving, update(100)).Times(Exactly(1));
         EXPECT_CALL(moving, isTooOld()).WillOnce(Return(true));
-        EXPECT_CALL(mUpSensor, hasStateChanged()).WillOnce(Return(false));
-        mStaircaseLooper.update(100);
+        EXPECT_CALL(this->mUpSensor, hasStateChanged()).WillOnce(Return(false));
+        this->mStaircaseLooper.update(100);
     }
 
     {
         InSequence s;
 
         EXPECT_CALL(moving, update(_)).Times(Exactly(0));
-        EXPECT_CALL(mUpSensor, hasStateChanged()).WillOnce(Return(false));
-        mStaircaseLooper.update(100);
+        EXPECT_CALL(this->mUpSensor, hasStateChanged()).WillOnce(Return(false));
+        this->mStaircaseLooper.update(100);
     }
 }
 
-TEST_F(StaircaseLooperTests, OneDownMovingEndBySensor) {
+TYPED_TEST(StaircaseLooperTests, OneDownMovingEndBySensor) {
     NiceMock<mocks::MovingMock> moving;
 
     {
         InSequence s;
 
-        EXPECT_CALL(mUpSensor, hasStateChanged()).WillOnce(Return(true));
-        EXPECT_CALL(mUpSensor, isClose()).WillOnce(Return(true));
-        EXPECT_CALL(mDownFilter, getCurrentMovingTime())
+        EXPECT_CALL(this->mUpSensor, hasStateChanged()).WillOnce(Return(true));
+        EXPECT_CALL(this->mUpSensor, isClose()).WillOnce(Return(true));
+        EXPECT_CALL(this->mDownFilter, getCurrentMovingTime())
             .WillOnce(Return(12000));
-        EXPECT_CALL(mMovingFactory,
-                    create(Ref(mBasicLightRefs), Ref(mDurationCalculator),
+        EXPECT_CALL(this->mMovingFactory,
+                    create(Ref(this->mBasicLightRefs),
+                           Ref(this->mDurationCalculator),
                            staircase::IMoving::Direction::DOWN, 12000))
             .WillOnce(Invoke([&moving]() {
                 return staircase::MovingPtr{&moving,
                                             [](staircase::IMoving *moving) {}};
             }));
-        mStaircaseLooper.update(100);
+        this->mStaircaseLooper.update(100);
     }
 
     {
         InSequence s;
 
         EXPECT_CALL(moving, update(100)).Times(Exactly(1));
-        EXPECT_CALL(mDownSensor, hasStateChanged()).WillOnce(Return(true));
-        EXPECT_CALL(mDownSensor, isClose()).WillOnce(Return(true));
+        EXPECT_CALL(this->mDownSensor, hasStateChanged())
+            .WillOnce(Return(true));
+        EXPECT_CALL(this->mDownSensor, isClose()).WillOnce(Return(true));
         EXPECT_CALL(moving, isNearEnd()).WillOnce(Return(true));
         EXPECT_CALL(moving, getTimePassed()).WillOnce(Return(8000));
-        EXPECT_CALL(mDownFilter, processNewMovingTime(8000)).Times(Exactly(1));
-        EXPECT_CALL(mUpSensor, hasStateChanged()).WillOnce(Return(false));
-        mStaircaseLooper.update(100);
+        EXPECT_CALL(this->mDownFilter, processNewMovingTime(8000))
+            .Times(Exactly(1));
+        EXPECT_CALL(this->mDownFilter, getCurrentMovingTime())
+            .WillOnce(Return(9600));
+        EXPECT_CALL(this->mUpSensor, hasStateChanged()).WillOnce(Return(false));
+        this->mStaircaseLooper.update(100);
     }
 
     {
         InSequence s;
 
         EXPECT_CALL(moving, update(_)).Times(Exactly(0));
-        EXPECT_CALL(mDownSensor, hasStateChanged()).WillOnce(Return(false));
-        EXPECT_CALL(mUpSensor, hasStateChanged()).WillOnce(Return(false));
-        mStaircaseLooper.update(100);
+        EXPECT_CALL(this->mDownSensor, hasStateChanged())
+            .WillOnce(Return(false));
+        EXPECT_CALL(this->mUpSensor, hasStateChanged()).WillOnce(Return(false));
+        this->mStaircaseLooper.update(100);
+    }
+}
+
+template <class Looper>
+class StaircaseLooperLightPortTests : public StaircaseLooperTests<Looper> {
+  public:
+    StaircaseLooperLightPortTests()
+        : mPortStaircaseLooper{this->mBasicLightRefs, mLightPort,
+                               this->mDownSensor, this->mUpSensor,
+                               this->mMovingFactory,
+                               this->mDurationCalculator, this->mDownFilter,
+                               this->mUpFilter} {}
+
+  protected:
+    NiceMock<mocks::LightPortMock> mLightPort;
+    Looper mPortStaircaseLooper;
+};
+
+TYPED_TEST_SUITE(StaircaseLooperLightPortTests, Loopers);
+
+TYPED_TEST(StaircaseLooperLightPortTests,
+           GIVENUpdateIsCalledTHENLightPortIsFlushedOnceAfterLightsAndMovings) {
+    NiceMock<mocks::MovingMock> moving;
+
+    InSequence s;
+
+    EXPECT_CALL(this->mBasicLights.back(), update(kDefaultTime))
+        .Times(Exactly(1));
+    EXPECT_CALL(this->mUpSensor, hasStateChanged()).WillOnce(Return(true));
+    EXPECT_CALL(this->mUpSensor, isClose()).WillOnce(Return(true));
+    EXPECT_CALL(this->mMovingFactory, create(_, _, _, _))
+        .WillOnce(Invoke([&moving]() {
+            return staircase::MovingPtr{&moving, [](staircase::IMoving *) {}};
+        }));
+    EXPECT_CALL(this->mLightPort, flush()).Times(Exactly(1));
+
+    this->mPortStaircaseLooper.update(kDefaultTime);
+}
+
+template <class Looper>
+class StaircaseLooperLightBankTests : public StaircaseLooperTests<Looper> {
+  public:
+    StaircaseLooperLightBankTests()
+        : mBankStaircaseLooper{this->mBasicLightRefs, mLightBank,
+                               this->mDownSensor, this->mUpSensor,
+                               this->mMovingFactory,
+                               this->mDurationCalculator, this->mDownFilter,
+                               this->mUpFilter} {}
+
+  protected:
+    NiceMock<mocks::LightBankMock> mLightBank;
+    Looper mBankStaircaseLooper;
+};
+
+TYPED_TEST_SUITE(StaircaseLooperLightBankTests, Loopers);
+
+TYPED_TEST(StaircaseLooperLightBankTests,
+           GIVENUpdateIsCalledTHENLightBankIsUpdatedOnceInsteadOfEachLight) {
+    std::for_each(std::begin(this->mBasicLights), std::end(this->mBasicLights),
+                  [](auto &basicLight) {
+                      EXPECT_CALL(basicLight, update(_)).Times(Exactly(0));
+                  });
+
+    InSequence s;
+
+    EXPECT_CALL(this->mLightBank, update(kDefaultTime)).Times(Exactly(1));
+    EXPECT_CALL(this->mLightBank, flush()).Times(Exactly(1));
+
+    this->mBankStaircaseLooper.update(kDefaultTime);
+}
+
+TYPED_TEST(StaircaseLooperLightBankTests,
+           GIVENUpdateIsCalledTHENSnapshotCopiesBankStateInsteadOfEachLight) {
+    std::for_each(std::begin(this->mBasicLights), std::end(this->mBasicLights),
+                  [](auto &basicLight) {
+                      EXPECT_CALL(basicLight, isOn()).Times(Exactly(0));
+                  });
+    EXPECT_CALL(this->mLightBank, copyState(_))
+        .WillOnce(Invoke([](std::span<std::uint32_t> words) {
+            words[0] = (1u << 0) | (1u << 5);
+        }));
+
+    this->mBankStaircaseLooper.update(kDefaultTime);
+
+    auto snapshot = this->mBankStaircaseLooper.snapshot();
+    EXPECT_TRUE(snapshot.isOn(0));
+    EXPECT_FALSE(snapshot.isOn(1));
+    EXPECT_TRUE(snapshot.isOn(5));
+}
+
+template <class Looper>
+class StaircaseLooperDeadlineTests : public StaircaseLooperTests<Looper> {
+  public:
+    void SetUp() {
+        StaircaseLooperTests<Looper>::SetUp();
+
+        std::for_each(std::begin(this->mBasicLights),
+                      std::end(this->mBasicLights), [](auto &basicLight) {
+                          ON_CALL(basicLight, nextDeadline())
+                              .WillByDefault(Return(hal::kForever));
+                      });
+        ON_CALL(this->mDownSensor, nextDeadline())
+            .WillByDefault(Return(hal::kForever));
+        ON_CALL(this->mUpSensor, nextDeadline())
+            .WillByDefault(Return(hal::kForever));
+    }
+};
+
+TYPED_TEST_SUITE(StaircaseLooperDeadlineTests, Loopers);
+
+TYPED_TEST(StaircaseLooperDeadlineTests,
+           GIVENNothingIsPendingTHENNextDeadlineIsForever) {
+    EXPECT_EQ(this->mStaircaseLooper.nextDeadline(), hal::kForever);
+}
+
+TYPED_TEST(StaircaseLooperDeadlineTests,
+           GIVENLightsAndSensorsArePendingTHENNextDeadlineIsTheEarliestOne) {
+    ON_CALL(this->mBasicLights[2], nextDeadline()).WillByDefault(Return(900));
+    ON_CALL(this->mBasicLights[5], nextDeadline()).WillByDefault(Return(400));
+    EXPECT_EQ(this->mStaircaseLooper.nextDeadline(), 400);
+
+    ON_CALL(this->mUpSensor, nextDeadline()).WillByDefault(Return(150));
+    EXPECT_EQ(this->mStaircaseLooper.nextDeadline(), 150);
+}
+
+TYPED_TEST(StaircaseLooperDeadlineTests,
+           GIVENMovingIsActiveTHENItsNextStepIsPartOfNextDeadline) {
+    NiceMock<mocks::MovingMock> moving;
+    ON_CALL(moving, nextDeadline()).WillByDefault(Return(70));
+    ON_CALL(this->mBasicLights[0], nextDeadline()).WillByDefault(Return(3000));
+
+    EXPECT_CALL(this->mUpSensor, hasStateChanged()).WillOnce(Return(true));
+    EXPECT_CALL(this->mUpSensor, isClose()).WillOnce(Return(true));
+    EXPECT_CALL(this->mMovingFactory, create(_, _, _, _))
+        .WillOnce(Invoke([&moving]() {
+            return staircase::MovingPtr{&moving, [](staircase::IMoving *) {}};
+        }));
+    this->mStaircaseLooper.update(kDefaultTime);
+
+    EXPECT_EQ(this->mStaircaseLooper.nextDeadline(), 70);
+}
+
+template <class Looper>
+class StaircaseLooperLightBankDeadlineTests
+    : public StaircaseLooperLightBankTests<Looper> {};
+
+TYPED_TEST_SUITE(StaircaseLooperLightBankDeadlineTests, Loopers);
+
+TYPED_TEST(StaircaseLooperLightBankDeadlineTests,
+           GIVENLightBankIsUsedTHENItsDeadlineReplacesPerLightDeadlines) {
+    std::for_each(std::begin(this->mBasicLights), std::end(this->mBasicLights),
+                  [](auto &basicLight) {
+                      EXPECT_CALL(basicLight, nextDeadline()).Times(Exactly(0));
+                  });
+    ON_CALL(this->mDownSensor, nextDeadline())
+        .WillByDefault(Return(hal::kForever));
+    ON_CALL(this->mUpSensor, nextDeadline())
+        .WillByDefault(Return(hal::kForever));
+    EXPECT_CALL(this->mLightBank, nextDeadline()).WillOnce(Return(250));
+
+    EXPECT_EQ(this->mBankStaircaseLooper.nextDeadline(), 250);
+}
+
+template <class Looper>
+class StaircaseLooperCommandTests : public StaircaseLooperTests<Looper> {};
+
+TYPED_TEST_SUITE(StaircaseLooperCommandTests, Loopers);
+
+TYPED_TEST(StaircaseLooperCommandTests,
+           GIVENForceOnIsPostedTHENAllLightsAreTurnedOnBeforeTheyAreUpdated) {
+    ASSERT_TRUE(
+        this->mStaircaseLooper.post(staircase::LooperCommand::forceOn(5000)));
+
+    std::for_each(std::begin(this->mBasicLights), std::end(this->mBasicLights),
+                  [](auto &basicLight) {
+                      InSequence s;
+                      EXPECT_CALL(basicLight, turnOn(5000)).Times(Exactly(1));
+                      EXPECT_CALL(basicLight, update(kDefaultTime))
+                          .Times(Exactly(1));
+                  });
+
+    this->mStaircaseLooper.update(kDefaultTime);
+}
+
+TYPED_TEST(StaircaseLooperCommandTests,
+           GIVENForceOffIsPostedTHENMovingsAreDroppedAndAllLightsAreTurnedOff) {
+    NiceMock<mocks::MovingMock> moving;
+
+    EXPECT_CALL(this->mMovingFactory, create(_, _, _, _))
+        .WillOnce(Invoke([&moving]() {
+            return staircase::MovingPtr{&moving, [](staircase::IMoving *) {}};
+        }));
+    ASSERT_TRUE(
+        this->mStaircaseLooper.post(staircase::LooperCommand::injectTrigger(
+            staircase::IMoving::Direction::UP)));
+    this->mStaircaseLooper.update(kDefaultTime);
+
+    std::for_each(std::begin(this->mBasicLights), std::end(this->mBasicLights),
+                  [](auto &basicLight) {
+                      EXPECT_CALL(basicLight, turnOff()).Times(Exactly(1));
+                  });
+    EXPECT_CALL(moving, update(_)).Times(Exactly(0));
+
+    ASSERT_TRUE(this->mStaircaseLooper.post(
+        staircase::LooperCommand::forceOff()));
+    this->mStaircaseLooper.update(kDefaultTime);
+}
+
+TYPED_TEST(StaircaseLooperCommandTests,
+           GIVENInjectTriggerIsPostedTHENMovingIsCreatedInThatDirection) {
+    EXPECT_CALL(this->mDownFilter, getCurrentMovingTime())
+        .WillOnce(Return(kDefaultMovingTime));
+    EXPECT_CALL(this->mMovingFactory,
+                create(Ref(this->mBasicLightRefs),
+                       Ref(this->mDurationCalculator),
+                       staircase::IMoving::Direction::DOWN,
+                       kDefaultMovingTime))
+        .WillOnce(Return(ByMove(staircase::MovingPtr{})));
+
+    ASSERT_TRUE(
+        this->mStaircaseLooper.post(staircase::LooperCommand::injectTrigger(
+            staircase::IMoving::Direction::DOWN)));
+    this->mStaircaseLooper.update(kDefaultTime);
+}
+
+TYPED_TEST(
+    StaircaseLooperCommandTests,
+    GIVENInjectTriggerMeetsAMovingTHENThatMovingIsNotFinishedOrFiltered) {
+    NiceMock<mocks::MovingMock> down;
+    ON_CALL(down, isNearEnd()).WillByDefault(Return(true));
+    EXPECT_CALL(this->mMovingFactory, create(_, _, _, _))
+        .WillOnce(Invoke([&down]() {
+            return staircase::MovingPtr{&down, [](staircase::IMoving *) {}};
+        }));
+    ASSERT_TRUE(
+        this->mStaircaseLooper.post(staircase::LooperCommand::injectTrigger(
+            staircase::IMoving::Direction::DOWN)));
+    this->mStaircaseLooper.update(kDefaultTime);
+
+    EXPECT_CALL(this->mDownFilter, processNewMovingTime(_)).Times(Exactly(0));
+    EXPECT_CALL(this->mMovingFactory,
+                create(_, _, staircase::IMoving::Direction::UP, _))
+        .WillOnce(Return(ByMove(staircase::MovingPtr{})));
+    EXPECT_CALL(down, update(kDefaultTime)).Times(Exactly(1));
+
+    ASSERT_TRUE(
+        this->mStaircaseLooper.post(staircase::LooperCommand::injectTrigger(
+            staircase::IMoving::Direction::UP)));
+    this->mStaircaseLooper.update(kDefaultTime);
+
+    EXPECT_EQ(this->mStaircaseLooper.snapshot().downWalks, 0);
+}
+
+TYPED_TEST(StaircaseLooperCommandTests,
+           GIVENInjectTriggerIsPostedTHENSnapshotCountsTheTrigger) {
+    ASSERT_TRUE(
+        this->mStaircaseLooper.post(staircase::LooperCommand::injectTrigger(
+            staircase::IMoving::Direction::UP)));
+    this->mStaircaseLooper.update(kDefaultTime);
+
+    EXPECT_EQ(this->mStaircaseLooper.snapshot().triggers, 1);
+}
+
+TYPED_TEST(StaircaseLooperCommandTests,
+           GIVENResetFilterIsPostedTHENOnlyThatFilterIsReset) {
+    EXPECT_CALL(this->mUpFilter, reset(9000)).Times(Exactly(1));
+    EXPECT_CALL(this->mDownFilter, reset(_)).Times(Exactly(0));
+
+    ASSERT_TRUE(
+        this->mStaircaseLooper.post(staircase::LooperCommand::resetFilter(
+            staircase::IMoving::Direction::UP, 9000)));
+    this->mStaircaseLooper.update(kDefaultTime);
+}
+
+TYPED_TEST(StaircaseLooperCommandTests,
+           GIVENQueueIsFullTHENPostFailsUntilTheNextUpdateDrainsIt) {
+    for (std::size_t i = 0; i < TypeParam::kCommandQueueSize; ++i) {
+        ASSERT_TRUE(this->mStaircaseLooper.post(
+            staircase::LooperCommand::forceOn(100)));
+    }
+    EXPECT_FALSE(this->mStaircaseLooper.post(
+        staircase::LooperCommand::forceOff()));
+
+    this->mStaircaseLooper.update(kDefaultTime);
+    EXPECT_TRUE(this->mStaircaseLooper.post(
+        staircase::LooperCommand::forceOff()));
+}
+
+TYPED_TEST(StaircaseLooperCommandTests,
+           GIVENBlockGuardIsHeldTHENUpdateIsDeferredInsteadOfWaiting) {
+    std::for_each(std::begin(this->mBasicLights), std::end(this->mBasicLights),
+                  [](auto &basicLight) {
+                      EXPECT_CALL(basicLight, update(2 * kDefaultTime))
+                          .Times(Exactly(1));
+                  });
+
+    {
+        auto guard = this->mStaircaseLooper.block();
+        this->mStaircaseLooper.update(kDefaultTime);
+    }
+
+    this->mStaircaseLooper.update(kDefaultTime);
+}
+
+// Real lights and movings, so what a moving does to a forced light shows.
+template <class Looper>
+class StaircaseLooperForceOnTests : public ::testing::Test {
+  public:
+    StaircaseLooperForceOnTests()
+        : mLights{mWriters[0], mWriters[1], mWriters[2], mWriters[3],
+                  mWriters[4], mWriters[5], mWriters[6], mWriters[7]},
+          mLightRefs{mLights[0], mLights[1], mLights[2], mLights[3],
+                     mLights[4], mLights[5], mLights[6], mLights[7]},
+          mStaircaseLooper{mLightRefs,    mDownSensor,         mUpSensor,
+                           mMovingFactory, mDurationCalculator, mDownFilter,
+                           mUpFilter} {
+        ON_CALL(mDownSensor, hasStateChanged()).WillByDefault(Return(false));
+        ON_CALL(mUpSensor, hasStateChanged()).WillByDefault(Return(false));
+        ON_CALL(mDurationCalculator, calculateDelta(_, _))
+            .WillByDefault(Return(500));
+        ON_CALL(mUpFilter, getCurrentMovingTime())
+            .WillByDefault(Return(4000));
+    }
+
+  protected:
+
+    void runFor(hal::Milliseconds millis) {
+        for (hal::Milliseconds passed = 0; passed < millis; passed += kTick) {
+            mStaircaseLooper.update(kTick);
+        }
+    }
+
+    std::array<NiceMock<mocks::BinaryValueWriterMock>,
+               staircase::IBasicLight::kLightsNum>
+        mWriters;
+    std::array<staircase::BasicLight, staircase::IBasicLight::kLightsNum>
+        mLights;
+    staircase::BasicLights mLightRefs;
+    NiceMock<mocks::ProximitySensorMock> mDownSensor;
+    NiceMock<mocks::ProximitySensorMock> mUpSensor;
+    staircase::BasicMovingFactory mMovingFactory;
+    NiceMock<mocks::MovingDurationCalculatorMock> mDurationCalculator;
+    NiceMock<mocks::MovingTimeFilterMock> mDownFilter;
+    NiceMock<mocks::MovingTimeFilterMock> mUpFilter;
+
+    Looper mStaircaseLooper;
+};
+
+TYPED_TEST_SUITE(StaircaseLooperForceOnTests, Loopers);
+
+TYPED_TEST(StaircaseLooperForceOnTests,
+           GIVENLightsAreForcedOnTHENAWalkDoesNotTurnThemIntoTimers) {
+    ASSERT_TRUE(this->mStaircaseLooper.post(
+        staircase::LooperCommand::forceOn()));
+    this->mStaircaseLooper.update(kTick);
+
+    EXPECT_CALL(this->mDownSensor, hasStateChanged())
+        .WillOnce(Return(true))
+        .WillRepeatedly(Return(false));
+    ON_CALL(this->mDownSensor, isClose()).WillByDefault(Return(true));
+    this->runFor(4000 + 2 * staircase::IBasicLight::kDefaultOnPeriod);
+
+    for (const auto &light : this->mLights) {
+        EXPECT_TRUE(light.isOn());
+    }
+}
+
+template <class Looper>
+class StaircaseLooperSnapshotTests : public StaircaseLooperTests<Looper> {};
+
+TYPED_TEST_SUITE(StaircaseLooperSnapshotTests, Loopers);
+
+TYPED_TEST(StaircaseLooperSnapshotTests,
+           GIVENLooperIsCreatedTHENSnapshotIsAlreadyPublished) {
+    auto snapshot = this->mStaircaseLooper.snapshot();
+
+    EXPECT_EQ(snapshot.updates, 0);
+    EXPECT_EQ(snapshot.downMovings.count, 0);
+    EXPECT_EQ(snapshot.upMovings.count, 0);
+}
+
+TYPED_TEST(StaircaseLooperSnapshotTests,
+           GIVENUpdateIsCalledTHENSnapshotHoldsLightsAndMovings) {
+    NiceMock<mocks::MovingMock> moving;
+    ON_CALL(moving, getTimePassed()).WillByDefault(Return(kDefaultTime));
+    ON_CALL(this->mBasicLights[0], isOn()).WillByDefault(Return(true));
+    ON_CALL(this->mBasicLights[5], isOn()).WillByDefault(Return(true));
+
+    EXPECT_CALL(this->mUpSensor, hasStateChanged()).WillOnce(Return(true));
+    EXPECT_CALL(this->mUpSensor, isClose()).WillOnce(Return(true));
+    EXPECT_CALL(this->mMovingFactory, create(_, _, _, _))
+        .WillOnce(Invoke([&moving]() {
+            return staircase::MovingPtr{&moving, [](staircase::IMoving *) {}};
+        }));
+    this->mStaircaseLooper.update(kDefaultTime);
+
+    auto snapshot = this->mStaircaseLooper.snapshot();
+    EXPECT_EQ(snapshot.updates, 1);
+    EXPECT_TRUE(snapshot.isOn(0));
+    EXPECT_FALSE(snapshot.isOn(1));
+    EXPECT_TRUE(snapshot.isOn(5));
+    EXPECT_EQ(snapshot.upMovings.count, 0);
+    ASSERT_EQ(snapshot.downMovings.count, 1);
+    EXPECT_EQ(snapshot.downMovings.timePassed[0], kDefaultTime);
+}
+
+TYPED_TEST(StaircaseLooperSnapshotTests,
+           GIVENFilterIsResetTHENSnapshotHoldsItsNewMovingTime) {
+    EXPECT_CALL(this->mDownFilter, reset(9000)).Times(Exactly(1));
+    EXPECT_CALL(this->mDownFilter, getCurrentMovingTime())
+        .WillOnce(Return(9000));
+
+    this->mStaircaseLooper.post(staircase::LooperCommand::resetFilter(
+        staircase::IMoving::Direction::DOWN, 9000));
+    this->mStaircaseLooper.update(kDefaultTime);
+
+    EXPECT_EQ(this->mStaircaseLooper.snapshot().downMovingTime, 9000);
+}
+
+template <class Looper>
+class StaircaseLooperTraceTests : public StaircaseLooperTests<Looper> {
+  public:
+    void SetUp() override {
+        if constexpr (!staircase::kTraceEnabled) {
+            GTEST_SKIP() << "built without STAIRCASE_TRACE";
+        }
+
+        StaircaseLooperTests<Looper>::SetUp();
+        ON_CALL(mMoving, getTimePassed()).WillByDefault(Return(kDefaultTime));
+        ON_CALL(this->mMovingFactory, create(_, _, _, _))
+            .WillByDefault(Invoke([this]() {
+                return staircase::MovingPtr{&mMoving,
+                                            [](staircase::IMoving *) {}};
+            }));
+        ON_CALL(this->mDownFilter, getCurrentMovingTime())
+            .WillByDefault(Return(kDefaultMovingTime));
+        this->mStaircaseLooper.setTrace(&mTrace);
+    }
+
+  protected:
+    void startDownMoving() {
+        EXPECT_CALL(this->mUpSensor, hasStateChanged())
+            .WillOnce(Return(true))
+            .WillRepeatedly(Return(false));
+        EXPECT_CALL(this->mUpSensor, isClose()).WillOnce(Return(true));
+        this->mStaircaseLooper.update(kDefaultTime);
     }
+
+    std::vector<staircase::TraceRecord> drain() {
+        std::vector<staircase::TraceRecord> records;
+        staircase::TraceRecord record;
+        while (mTrace.pop(record)) {
+            records.push_back(record);
+        }
+        return records;
+    }
+
+    NiceMock<mocks::MovingMock> mMoving;
+    staircase::TraceRing mTrace;
+};
+
+TYPED_TEST_SUITE(StaircaseLooperTraceTests, Loopers);
+
+TYPED_TEST(StaircaseLooperTraceTests,
+           GIVENSensorStartsMovingTHENAcceptAndCreateAreTraced) {
+    this->startDownMoving();
+
+    auto records = this->drain();
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(records[0].time, kDefaultTime);
+    EXPECT_EQ(records[0].event, staircase::TraceEvent::DEBOUNCE_ACCEPT);
+    EXPECT_EQ(records[0].subject, staircase::kTraceUp);
+    EXPECT_EQ(records[0].value, 1);
+    EXPECT_EQ(records[1].event, staircase::TraceEvent::MOVING_CREATE);
+    EXPECT_EQ(records[1].subject, staircase::kTraceDown);
+    EXPECT_EQ(records[1].value, kDefaultMovingTime);
+}
+
+TYPED_TEST(StaircaseLooperTraceTests,
+           GIVENMovingIsFinishedTHENFinishAndFilterUpdateAreTraced) {
+    this->startDownMoving();
+    this->drain();
+
+    EXPECT_CALL(this->mDownSensor, hasStateChanged()).WillOnce(Return(true));
+    EXPECT_CALL(this->mDownSensor, isClose()).WillOnce(Return(true));
+    EXPECT_CALL(this->mMoving, isNearEnd()).WillOnce(Return(true));
+    EXPECT_CALL(this->mDownFilter, getCurrentMovingTime())
+        .WillOnce(Return(9000));
+    this->mStaircaseLooper.update(kDefaultTime);
+
+    auto records = this->drain();
+    ASSERT_EQ(records.size(), 3);
+    EXPECT_EQ(records[1].event, staircase::TraceEvent::MOVING_FINISH);
+    EXPECT_EQ(records[1].value, kDefaultTime);
+    EXPECT_EQ(records[2].event, staircase::TraceEvent::FILTER_UPDATE);
+    EXPECT_EQ(records[2].subject, staircase::kTraceDown);
+    EXPECT_EQ(records[2].value, 9000);
+}
+
+TYPED_TEST(StaircaseLooperTraceTests, GIVENMovingIsStaleTHENExpireIsTraced) {
+    this->startDownMoving();
+    this->drain();
+
+    EXPECT_CALL(this->mMoving, isTooOld()).WillOnce(Return(true));
+    this->mStaircaseLooper.update(kDefaultTime);
+
+    auto records = this->drain();
+    ASSERT_EQ(records.size(), 1);
+    EXPECT_EQ(records[0].time, 2 * kDefaultTime);
+    EXPECT_EQ(records[0].event, staircase::TraceEvent::MOVING_EXPIRE);
+    EXPECT_EQ(records[0].value, kDefaultTime);
+}
+
+TYPED_TEST(StaircaseLooperTraceTests, GIVENLightsChangeTHENOnAndOffAreTraced) {
+    ON_CALL(this->mBasicLights[3], isOn()).WillByDefault(Return(true));
+    ON_CALL(this->mBasicLights[6], isOn()).WillByDefault(Return(true));
+    this->mStaircaseLooper.update(kDefaultTime);
+    ON_CALL(this->mBasicLights[3], isOn()).WillByDefault(Return(false));
+    this->mStaircaseLooper.update(kDefaultTime);
+
+    auto records = this->drain();
+    ASSERT_EQ(records.size(), 3);
+    EXPECT_EQ(records[0].event, staircase::TraceEvent::LIGHT_ON);
+    EXPECT_EQ(records[0].subject, 3);
+    EXPECT_EQ(records[1].event, staircase::TraceEvent::LIGHT_ON);
+    EXPECT_EQ(records[1].subject, 6);
+    EXPECT_EQ(records[2].event, staircase::TraceEvent::LIGHT_OFF);
+    EXPECT_EQ(records[2].subject, 3);
+    EXPECT_EQ(records[2].time, 2 * kDefaultTime);
+}
+
+TYPED_TEST(StaircaseLooperTraceTests, GIVENCommandIsAppliedTHENItIsTraced) {
+    this->mStaircaseLooper.post(staircase::LooperCommand::forceOn(5000));
+    this->mStaircaseLooper.update(kDefaultTime);
+
+    auto records = this->drain();
+    ASSERT_EQ(records.size(), 1);
+    EXPECT_EQ(records[0].event, staircase::TraceEvent::COMMAND);
+    EXPECT_EQ(records[0].subject,
+              static_cast<std::uint16_t>(
+                  staircase::LooperCommand::Type::FORCE_ON));
+    EXPECT_EQ(records[0].value, 5000);
+}
+
+template <class Looper>
+class StaircaseLooperMultiRateTests : public StaircaseLooperTests<Looper> {
+  public:
+    void SetUp() override {
+        StaircaseLooperTests<Looper>::SetUp();
+        this->mStaircaseLooper.setPeriods({0, 50, 50});
+    }
+
+  protected:
+    void startDownMoving() {
+        ON_CALL(this->mMovingFactory, create(_, _, _, _))
+            .WillByDefault(Invoke([this]() {
+                return staircase::MovingPtr{&mMoving,
+                                            [](staircase::IMoving *) {}};
+            }));
+        EXPECT_CALL(this->mUpSensor, hasStateChanged())
+            .WillOnce(Return(true))
+            .WillRepeatedly(Return(false));
+        EXPECT_CALL(this->mUpSensor, isClose()).WillOnce(Return(true));
+        this->mStaircaseLooper.update(kTick);
+    }
+
+
+    NiceMock<mocks::MovingMock> mMoving;
+};
+
+TYPED_TEST_SUITE(StaircaseLooperMultiRateTests, Loopers);
+
+TYPED_TEST(StaircaseLooperMultiRateTests,
+           GIVENPhasesAreNotDueTHENTheyGetTheAccumulatedDeltaLater) {
+    for (auto &light : this->mBasicLights) {
+        EXPECT_CALL(light, update(50)).Times(Exactly(2));
+    }
+    EXPECT_CALL(this->mDownSensor, update(kTick)).Times(Exactly(10));
+
+    for (int i = 0; i < 10; ++i) {
+        this->mStaircaseLooper.update(kTick);
+    }
+}
+
+TYPED_TEST(StaircaseLooperMultiRateTests,
+           GIVENSensorChangesTHENMovingsCatchUpBeforeTheDecision) {
+    this->startDownMoving();
+    this->mStaircaseLooper.update(kTick);
+    this->mStaircaseLooper.update(kTick);
+
+    InSequence s;
+    EXPECT_CALL(this->mDownSensor, hasStateChanged()).WillOnce(Return(true));
+    EXPECT_CALL(this->mMoving, update(3 * kTick)).Times(Exactly(1));
+    EXPECT_CALL(this->mDownSensor, isClose()).WillOnce(Return(true));
+    EXPECT_CALL(this->mMoving, isNearEnd()).WillOnce(Return(true));
+    EXPECT_CALL(this->mDownFilter, processNewMovingTime(_)).Times(Exactly(1));
+    this->mStaircaseLooper.update(kTick);
+
+    EXPECT_EQ(this->mStaircaseLooper.snapshot().downWalks, 1);
+}
+
+TYPED_TEST(StaircaseLooperMultiRateTests,
+           GIVENLightDeadlineIsCloseTHENNextDeadlineWaitsForTheLightsPeriod) {
+    ON_CALL(this->mBasicLights[2], nextDeadline()).WillByDefault(Return(5));
+    ON_CALL(this->mDownSensor, nextDeadline())
+        .WillByDefault(Return(hal::kForever));
+    ON_CALL(this->mUpSensor, nextDeadline())
+        .WillByDefault(Return(hal::kForever));
+    this->mStaircaseLooper.update(kTick);
+
+    EXPECT_EQ(this->mStaircaseLooper.nextDeadline(), 50 - kTick);
+}
+
+TYPED_TEST(StaircaseLooperMultiRateTests,
+           GIVENNoPhaseSwitchingLightsIsDueTHENSnapshotKeepsItsLightBitmap) {
+    ON_CALL(this->mBasicLights[3], isOn()).WillByDefault(Return(true));
+    for (auto &light : this->mBasicLights) {
+        EXPECT_CALL(light, isOn()).Times(Exactly(0));
+    }
+    for (int i = 0; i < 4; ++i) {
+        this->mStaircaseLooper.update(kTick);
+    }
+    EXPECT_FALSE(this->mStaircaseLooper.snapshot().isOn(3));
+
+    for (auto &light : this->mBasicLights) {
+        EXPECT_CALL(light, isOn()).Times(Exactly(1));
+    }
+    this->mStaircaseLooper.update(kTick);
+    EXPECT_TRUE(this->mStaircaseLooper.snapshot().isOn(3));
+}
+
+TYPED_TEST(StaircaseLooperMultiRateTests,
+           GIVENSingleRatePeriodsTHENEveryPhaseRunsInEveryUpdate) {
+    this->mStaircaseLooper.setPeriods({});
+    for (auto &light : this->mBasicLights) {
+        EXPECT_CALL(light, update(kTick)).Times(Exactly(3));
+    }
+
+    for (int i = 0; i < 3; ++i) {
+        this->mStaircaseLooper.update(kTick);
+    }
+}
+
+template <class Looper>
+class StaircaseLooperIdleTests : public StaircaseLooperTests<Looper> {
+  public:
+    void SetUp() override {
+        StaircaseLooperTests<Looper>::SetUp();
+        ON_CALL(this->mDownSensor, nextDeadline())
+            .WillByDefault(Return(hal::kForever));
+        ON_CALL(this->mUpSensor, nextDeadline())
+            .WillByDefault(Return(hal::kForever));
+    }
+};
+
+TYPED_TEST_SUITE(StaircaseLooperIdleTests, Loopers);
+
+TYPED_TEST(StaircaseLooperIdleTests, GIVENNothingIsGoingOnTHENLooperIsIdle) {
+    this->mStaircaseLooper.update(kDefaultTime);
+
+    EXPECT_TRUE(this->mStaircaseLooper.isIdle());
+}
+
+TYPED_TEST(StaircaseLooperIdleTests, GIVENLightIsOnTHENLooperIsNotIdle) {
+    ON_CALL(this->mBasicLights[5], isOn()).WillByDefault(Return(true));
+
+    EXPECT_FALSE(this->mStaircaseLooper.isIdle());
+}
+
+TYPED_TEST(StaircaseLooperIdleTests,
+           GIVENSensorIsDebouncingTHENLooperIsNotIdle) {
+    ON_CALL(this->mUpSensor, nextDeadline()).WillByDefault(Return(7));
+
+    EXPECT_FALSE(this->mStaircaseLooper.isIdle());
+}
+
+TYPED_TEST(StaircaseLooperIdleTests, GIVENMovingTHENLooperIsNotIdle) {
+    NiceMock<mocks::MovingMock> moving;
+    ON_CALL(this->mMovingFactory, create(_, _, _, _))
+        .WillByDefault(Invoke([&moving]() {
+            return staircase::MovingPtr{&moving, [](staircase::IMoving *) {}};
+        }));
+    EXPECT_CALL(this->mUpSensor, hasStateChanged()).WillOnce(Return(true));
+    EXPECT_CALL(this->mUpSensor, isClose()).WillOnce(Return(true));
+
+    this->mStaircaseLooper.update(kDefaultTime);
+
+    EXPECT_FALSE(this->mStaircaseLooper.isIdle());
+}
+
+// Cycle counter which only moves when a test advances it.
+class SteppedCycleCounter final : public hal::ICycleCounter {
+  public:
+    std::uint32_t cycles() const noexcept override {
+        ++reads;
+        return now;
+    }
+
+    std::uint32_t frequency() const noexcept override { return 1000000; }
+
+    std::uint32_t now = 0;
+    mutable std::uint32_t reads = 0;
+};
+
+template <class Looper>
+class StaircaseLooperProfileTests : public StaircaseLooperTests<Looper> {
+  public:
+    StaircaseLooperProfileTests() : mProfile{mCounter} {}
+
+  protected:
+    SteppedCycleCounter mCounter;
+    staircase::TickProfile mProfile;
+};
+
+TYPED_TEST_SUITE(StaircaseLooperProfileTests, Loopers);
+
+TYPED_TEST(StaircaseLooperProfileTests,
+           GIVENProfileIsNotSetTHENUpdateDoesNotReadTheCounter) {
+    this->mStaircaseLooper.update(kDefaultTime);
+
+    EXPECT_EQ(this->mCounter.reads, 0);
+}
+
+TYPED_TEST(StaircaseLooperProfileTests,
+           GIVENProfileIsSetTHENEachPhaseIsMeasuredSeparately) {
+    for (auto &light : this->mBasicLights) {
+        ON_CALL(light, update(_)).WillByDefault(Invoke([this]() {
+            this->mCounter.now += 100;
+        }));
+    }
+    ON_CALL(this->mDownSensor, update(_)).WillByDefault(Invoke([this]() {
+        this->mCounter.now += 30;
+    }));
+    this->mStaircaseLooper.setProfile(&this->mProfile);
+
+    this->mStaircaseLooper.update(kDefaultTime);
+    this->mStaircaseLooper.update(kDefaultTime);
+
+    auto lights = this->mProfile.summary(staircase::TickPhase::LIGHTS);
+    EXPECT_EQ(lights.count, 2);
+    EXPECT_EQ(lights.p50, 800);
+    EXPECT_EQ(lights.max, 800);
+    EXPECT_EQ(this->mProfile.summary(staircase::TickPhase::SENSORS).max, 30);
+    EXPECT_EQ(this->mProfile.summary(staircase::TickPhase::MOVINGS).max, 0);
+    EXPECT_EQ(this->mProfile.summary(staircase::TickPhase::STALE_REMOVAL).max,
+              0);
+    EXPECT_EQ(this->mProfile.summary(staircase::TickPhase::TICK).max, 830);
+    EXPECT_EQ(this->mProfile.toMicroseconds(830), 830);
+}
+
+TYPED_TEST(StaircaseLooperProfileTests,
+           GIVENProfileIsClearedTHENUpdateStopsMeasuring) {
+    this->mStaircaseLooper.setProfile(&this->mProfile);
+    this->mStaircaseLooper.update(kDefaultTime);
+    this->mStaircaseLooper.setProfile(nullptr);
+    this->mStaircaseLooper.update(kDefaultTime);
+
+    EXPECT_EQ(this->mProfile.summary(staircase::TickPhase::TICK).count, 1);
 }
 
 } // namespace tests
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <deque>
+#include <memory>
 
 namespace tests {
 
@@ -314,4 +315,36 @@ TEST(StaticDequeTests, IntIterators) {
     EXPECT_TRUE(std::equal(deque.begin(), deque.end(), std::begin(stdDeque)));
 }
 
+TEST(StaticDequeTests, IntIteratorsAfterWrapAround) {
+    util::StaticDequeue<int, 3> deque;
+
+    deque.pushBack(6);
+    deque.pushBack(7);
+    deque.pushBack(8);
+    deque.popFront();
+    deque.popFront();
+    deque.pushBack(9);
+
+    std::deque<int> stdDeque{8, 9};
+
+    EXPECT_TRUE(std::equal(deque.begin(), deque.end(), std::begin(stdDeque)));
+}
+
+TEST(StaticDequeTests, MoveOnlyPushBackAndPopFront) {
+    util::StaticDequeue<std::unique_ptr<int>, 2> deque;
+
+    deque.pushBack(std::make_unique<int>(6));
+    deque.pushBack(std::make_unique<int>(7));
+    ASSERT_TRUE(deque.full());
+    EXPECT_EQ(*deque.front(), 6);
+    EXPECT_EQ(*deque.back(), 7);
+
+    deque.popFront();
+    EXPECT_EQ(*deque.front(), 7);
+
+    deque.pushBack(std::make_unique<int>(8));
+    EXPECT_EQ(*deque.back(), 8);
+    EXPECT_EQ(deque.size(), 2);
+}
+
 } // namespace tests
\ No newline at end of file
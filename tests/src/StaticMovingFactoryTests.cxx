@@ -2,52 +2,56 @@
 #include <gtest/gtest.h>
 
 #include <mocks/BasicLightMock.hxx>
+#include <mocks/MovingDurationCalculatorMock.hxx>
 
 #include <staircase/IBasicLight.hxx>
 #include <staircase/IMoving.hxx>
-#include <staircase/Moving.hxx>
 #include <staircase/StaticMovingFactory.hxx>
 
 #include <algorithm>
 #include <array>
+#include <utility>
 
 namespace tests {
 
 using ::testing::_;
-using ::testing::InSequence;
 using ::testing::NiceMock;
+using ::testing::Return;
 
 class StaticMovingFactoryTests : public ::testing::Test {
   public:
+    StaticMovingFactoryTests()
+        : mBasicLightRefs{mBasicLights[0], mBasicLights[1], mBasicLights[2],
+                          mBasicLights[3], mBasicLights[4], mBasicLights[5],
+                          mBasicLights[6], mBasicLights[7]} {}
+
     void SetUp() {
-        std::transform(std::begin(mBasicLights), std::end(mBasicLights),
-                       std::begin(mBasicLightPointers),
-                       [](auto &basicLight) { return &basicLight; });
-        std::transform(std::rbegin(mBasicLights), std::rend(mBasicLights),
-                       std::begin(mBasicLightReversePointers),
-                       [](auto &basicLight) { return &basicLight; });
+        ON_CALL(mDurationCalculator, calculateDelta(_, _))
+            .WillByDefault(Return(1000));
     }
 
     void TearDown() {}
 
   protected:
-    std::array<NiceMock<mocks::BasicLightMock>, staircase::kLightNum>
+    staircase::MovingPtr create(staircase::IMoving::Direction direction,
+                                hal::Milliseconds duration) {
+        return mFactory.create(mBasicLightRefs, mDurationCalculator, direction,
+                               duration);
+    }
+
+    std::array<NiceMock<mocks::BasicLightMock>,
+               staircase::IBasicLight::kLightsNum>
         mBasicLights;
-    std::array<staircase::IBasicLight *, staircase::kLightNum>
-        mBasicLightPointers;
-    std::array<staircase::IBasicLight *, staircase::kLightNum>
-        mBasicLightReversePointers;
+    staircase::BasicLights mBasicLightRefs;
+    NiceMock<mocks::MovingDurationCalculatorMock> mDurationCalculator;
+    staircase::StaticMovingFactory<2> mFactory;
 };
 
 TEST_F(StaticMovingFactoryTests, CreateOne) {
-    staircase::StaticMovingFactory<2> factory;
-
-    staircase::IMoving *moving =
-        factory.create(staircase::BasicLights{std::begin(mBasicLightPointers),
-                                              std::end(mBasicLightPointers)},
-                       staircase::IMoving::Direction::UP, 12000);
+    auto moving = create(staircase::IMoving::Direction::UP, 12000);
 
     ASSERT_NE(moving, nullptr);
+    EXPECT_EQ(mFactory.size(), 1);
 
     EXPECT_TRUE(moving->isNearBegin());
     EXPECT_FALSE(moving->isNearEnd());
@@ -59,21 +63,12 @@ TEST_F(StaticMovingFactoryTests, CreateOne) {
 }
 
 TEST_F(StaticMovingFactoryTests, CreateTwo) {
-    staircase::StaticMovingFactory<2> factory;
-
-    staircase::IMoving *moving =
-        factory.create(staircase::BasicLights{std::begin(mBasicLightPointers),
-                                              std::end(mBasicLightPointers)},
-                       staircase::IMoving::Direction::UP, 12000);
-
+    auto moving = create(staircase::IMoving::Direction::UP, 12000);
     ASSERT_NE(moving, nullptr);
 
-    staircase::IMoving *moving2 =
-        factory.create(staircase::BasicLights{std::begin(mBasicLightPointers),
-                                              std::end(mBasicLightPointers)},
-                       staircase::IMoving::Direction::DOWN, 16000);
-
+    auto moving2 = create(staircase::IMoving::Direction::DOWN, 16000);
     ASSERT_NE(moving2, nullptr);
+    EXPECT_NE(moving.get(), moving2.get());
 
     EXPECT_TRUE(moving2->isNearBegin());
     EXPECT_FALSE(moving2->isNearEnd());
@@ -85,54 +80,27 @@ TEST_F(StaticMovingFactoryTests, CreateTwo) {
 }
 
 TEST_F(StaticMovingFactoryTests, CreateTwoFailThird) {
-    staircase::StaticMovingFactory<2> factory;
-
-    staircase::IMoving *moving =
-        factory.create(staircase::BasicLights{std::begin(mBasicLightPointers),
-                                              std::end(mBasicLightPointers)},
-                       staircase::IMoving::Direction::UP, 12000);
-
+    auto moving = create(staircase::IMoving::Direction::UP, 12000);
     ASSERT_NE(moving, nullptr);
 
-    staircase::IMoving *moving2 =
-        factory.create(staircase::BasicLights{std::begin(mBasicLightPointers),
-                                              std::end(mBasicLightPointers)},
-                       staircase::IMoving::Direction::DOWN, 16000);
-
+    auto moving2 = create(staircase::IMoving::Direction::DOWN, 16000);
     ASSERT_NE(moving2, nullptr);
 
-    staircase::IMoving *moving3 =
-        factory.create(staircase::BasicLights{std::begin(mBasicLightPointers),
-                                              std::end(mBasicLightPointers)},
-                       staircase::IMoving::Direction::DOWN, 1500);
-
+    auto moving3 = create(staircase::IMoving::Direction::DOWN, 1500);
     EXPECT_EQ(moving3, nullptr);
 }
 
 TEST_F(StaticMovingFactoryTests, CreateTwoDestroyOneCreateThirdFailFourth) {
-    staircase::StaticMovingFactory<2> factory;
-
-    staircase::IMoving *moving =
-        factory.create(staircase::BasicLights{std::begin(mBasicLightPointers),
-                                              std::end(mBasicLightPointers)},
-                       staircase::IMoving::Direction::UP, 12000);
-
+    auto moving = create(staircase::IMoving::Direction::UP, 12000);
     ASSERT_NE(moving, nullptr);
 
-    staircase::IMoving *moving2 =
-        factory.create(staircase::BasicLights{std::begin(mBasicLightPointers),
-                                              std::end(mBasicLightPointers)},
-                       staircase::IMoving::Direction::DOWN, 16000);
-
+    auto moving2 = create(staircase::IMoving::Direction::DOWN, 16000);
     ASSERT_NE(moving2, nullptr);
 
-    factory.destroy(moving2);
-
-    staircase::IMoving *moving3 =
-        factory.create(staircase::BasicLights{std::begin(mBasicLightPointers),
-                                              std::end(mBasicLightPointers)},
-                       staircase::IMoving::Direction::DOWN, 19000);
+    moving2.reset();
+    EXPECT_EQ(mFactory.size(), 1);
 
+    auto moving3 = create(staircase::IMoving::Direction::DOWN, 19000);
     ASSERT_NE(moving3, nullptr);
 
     EXPECT_TRUE(moving3->isNearBegin());
@@ -143,12 +111,38 @@ TEST_F(StaticMovingFactoryTests, CreateTwoDestroyOneCreateThirdFailFourth) {
     EXPECT_FALSE(moving3->isNearBegin());
     EXPECT_EQ(moving3->getTimePassed(), 19000);
 
-    staircase::IMoving *moving4 =
-        factory.create(staircase::BasicLights{std::begin(mBasicLightPointers),
-                                              std::end(mBasicLightPointers)},
-                       staircase::IMoving::Direction::DOWN, 1500);
-
+    auto moving4 = create(staircase::IMoving::Direction::DOWN, 1500);
     EXPECT_EQ(moving4, nullptr);
 }
 
-} // namespace tests
\ No newline at end of file
+TEST_F(StaticMovingFactoryTests, StaleDestroyIsIgnored) {
+    auto moving = create(staircase::IMoving::Direction::UP, 12000);
+    ASSERT_NE(moving, nullptr);
+
+    auto *raw = moving.get();
+    auto deleter = moving.get_deleter();
+    moving.reset();
+
+    auto moving2 = create(staircase::IMoving::Direction::DOWN, 16000);
+    ASSERT_EQ(moving2.get(), raw);
+
+    deleter(raw);
+    EXPECT_EQ(mFactory.size(), 1);
+    EXPECT_EQ(moving2->getTimePassed(), 0);
+}
+
+TEST_F(StaticMovingFactoryTests, DoubleDestroyIsIgnored) {
+    auto moving = create(staircase::IMoving::Direction::UP, 12000);
+    auto moving2 = create(staircase::IMoving::Direction::UP, 14000);
+    ASSERT_NE(moving, nullptr);
+    ASSERT_NE(moving2, nullptr);
+
+    auto *raw = moving.release();
+    auto deleter = moving.get_deleter();
+    deleter(raw);
+    deleter(raw);
+
+    EXPECT_EQ(mFactory.size(), 1);
+}
+
+} // namespace tests
@@ -0,0 +1,118 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <util/StaticPool.hxx>
+
+#include <cstdint>
+
+namespace tests {
+
+class Counted {
+  public:
+    Counted(int value, int &alive) : mValue{value}, mAlive{alive} { ++mAlive; }
+    ~Counted() { --mAlive; }
+
+    int value() const noexcept { return mValue; }
+
+  private:
+    int mValue;
+    int &mAlive;
+};
+
+TEST(StaticPoolTests, Initialization) {
+    util::StaticPool<int, 3> pool;
+
+    EXPECT_TRUE(pool.empty());
+    EXPECT_FALSE(pool.full());
+    EXPECT_EQ(pool.size(), 0);
+    EXPECT_EQ(pool.capacity(), 3);
+}
+
+TEST(StaticPoolTests, AcquireUntilFull) {
+    util::StaticPool<int, 3> pool;
+
+    auto first = pool.acquire(6);
+    auto second = pool.acquire(7);
+    auto third = pool.acquire(8);
+    auto fourth = pool.acquire(9);
+
+    EXPECT_TRUE(first.valid());
+    EXPECT_TRUE(second.valid());
+    EXPECT_TRUE(third.valid());
+    EXPECT_FALSE(fourth.valid());
+    EXPECT_TRUE(pool.full());
+
+    EXPECT_EQ(*pool.get(first), 6);
+    EXPECT_EQ(*pool.get(second), 7);
+    EXPECT_EQ(*pool.get(third), 8);
+    EXPECT_EQ(pool.get(fourth), nullptr);
+}
+
+TEST(StaticPoolTests, ReleasedSlotIsReused) {
+    util::StaticPool<int, 2> pool;
+
+    auto first = pool.acquire(6);
+    auto second = pool.acquire(7);
+    int *firstAddress = pool.get(first);
+
+    EXPECT_TRUE(pool.release(first));
+    auto third = pool.acquire(8);
+
+    ASSERT_TRUE(third.valid());
+    EXPECT_EQ(pool.get(third), firstAddress);
+    EXPECT_EQ(*pool.get(third), 8);
+    EXPECT_EQ(*pool.get(second), 7);
+}
+
+TEST(StaticPoolTests, StaleHandleIsRejected) {
+    util::StaticPool<int, 1> pool;
+
+    auto first = pool.acquire(6);
+    ASSERT_TRUE(pool.release(first));
+    auto second = pool.acquire(7);
+
+    EXPECT_NE(first, second);
+    EXPECT_EQ(pool.get(first), nullptr);
+    EXPECT_FALSE(pool.release(first));
+    EXPECT_EQ(*pool.get(second), 7);
+    EXPECT_EQ(pool.size(), 1);
+}
+
+TEST(StaticPoolTests, DoubleReleaseIsRejected) {
+    util::StaticPool<int, 2> pool;
+
+    auto first = pool.acquire(6);
+
+    EXPECT_TRUE(pool.release(first));
+    EXPECT_FALSE(pool.release(first));
+    EXPECT_EQ(pool.size(), 0);
+
+    pool.acquire(7);
+    pool.acquire(8);
+    EXPECT_TRUE(pool.full());
+}
+
+TEST(StaticPoolTests, InvalidHandleIsRejected) {
+    util::StaticPool<int, 2> pool;
+
+    EXPECT_FALSE(pool.release(util::StaticPool<int, 2>::Handle{}));
+    EXPECT_FALSE(pool.release(util::StaticPool<int, 2>::Handle{1}));
+}
+
+TEST(StaticPoolTests, DestructorsAreCalled) {
+    int alive = 0;
+
+    {
+        util::StaticPool<Counted, 3> pool;
+        auto first = pool.acquire(6, alive);
+        pool.acquire(7, alive);
+        EXPECT_EQ(alive, 2);
+
+        pool.release(first);
+        EXPECT_EQ(alive, 1);
+    }
+
+    EXPECT_EQ(alive, 0);
+}
+
+} // namespace tests
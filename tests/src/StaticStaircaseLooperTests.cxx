@@ -0,0 +1,215 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <mocks/BasicLightMock.hxx>
+#include <mocks/BinaryValueWriterMock.hxx>
+#include <mocks/MovingDurationCalculatorMock.hxx>
+#include <mocks/MovingTimeFilterMock.hxx>
+#include <mocks/ProximitySensorMock.hxx>
+
+#include <hal/BinaryValue.hxx>
+#include <hal/Timing.hxx>
+
+#include <staircase/BasicLight.hxx>
+#include <staircase/IBasicLight.hxx>
+#include <staircase/IMoving.hxx>
+#include <staircase/IMovingDurationCalculator.hxx>
+#include <staircase/IMovingTimeFilter.hxx>
+#include <staircase/IProximitySensor.hxx>
+#include <staircase/MTAMovingTimeFilter.hxx>
+#include <staircase/StaircaseConfig.hxx>
+#include <staircase/StaticClippedSquaredMovingDurationCalculator.hxx>
+#include <staircase/StaticStaircaseLooper.hxx>
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <utility>
+
+namespace tests {
+
+using ::testing::_;
+using ::testing::Exactly;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+using VirtualLooper =
+    staircase::StaticStaircaseLooper<staircase::kDefaultConfig,
+                                     staircase::IBasicLight,
+                                     staircase::IProximitySensor,
+                                     staircase::IMovingDurationCalculator,
+                                     staircase::IMovingTimeFilter>;
+
+class StaticStaircaseLooperTests : public ::testing::Test {
+  public:
+    StaticStaircaseLooperTests()
+        : mBasicLightRefs{mBasicLights[0], mBasicLights[1], mBasicLights[2],
+                          mBasicLights[3], mBasicLights[4], mBasicLights[5],
+                          mBasicLights[6], mBasicLights[7]},
+          mLooper{mBasicLightRefs, mDownSensor, mUpSensor,
+                  mDurationCalculator, mDownFilter, mUpFilter} {
+        ON_CALL(mDurationCalculator, calculateDelta(_, _))
+            .WillByDefault(Return(1000));
+        ON_CALL(mDownFilter, getCurrentMovingTime())
+            .WillByDefault(Return(12000));
+        ON_CALL(mUpFilter, getCurrentMovingTime())
+            .WillByDefault(Return(12000));
+    }
+
+  protected:
+    static constexpr hal::Milliseconds kTick = 10;
+
+    void triggerOnce(NiceMock<mocks::ProximitySensorMock> &sensor) {
+        EXPECT_CALL(sensor, hasStateChanged())
+            .WillOnce(Return(true))
+            .WillRepeatedly(Return(false));
+        ON_CALL(sensor, isClose()).WillByDefault(Return(true));
+    }
+
+    std::array<NiceMock<mocks::BasicLightMock>,
+               staircase::IBasicLight::kLightsNum>
+        mBasicLights;
+    staircase::BasicLights mBasicLightRefs;
+    NiceMock<mocks::ProximitySensorMock> mDownSensor;
+    NiceMock<mocks::ProximitySensorMock> mUpSensor;
+    NiceMock<mocks::MovingDurationCalculatorMock> mDurationCalculator;
+    NiceMock<mocks::MovingTimeFilterMock> mDownFilter;
+    NiceMock<mocks::MovingTimeFilterMock> mUpFilter;
+    VirtualLooper mLooper;
+};
+
+TEST_F(StaticStaircaseLooperTests,
+       GIVENUpdateIsCalledTHENItUpdatesAllLightsAndSensors) {
+    std::for_each(std::begin(mBasicLights), std::end(mBasicLights),
+                  [](auto &basicLight) {
+                      EXPECT_CALL(basicLight, update(kTick)).Times(Exactly(1));
+                  });
+    EXPECT_CALL(mDownSensor, update(kTick)).Times(Exactly(1));
+    EXPECT_CALL(mUpSensor, update(kTick)).Times(Exactly(1));
+
+    mLooper.update(kTick);
+}
+
+TEST_F(StaticStaircaseLooperTests,
+       GIVENUpSensorChangesToCloseTHENDownMovingStartsFromTheLastLight) {
+    triggerOnce(mUpSensor);
+
+    EXPECT_CALL(mBasicLights.back(),
+                turnOn(staircase::IBasicLight::kDefaultOnPeriod))
+        .Times(Exactly(1));
+    mLooper.update(kTick);
+
+    EXPECT_EQ(mLooper.getMovings(staircase::IMoving::Direction::DOWN).size(),
+              1);
+    EXPECT_TRUE(mLooper.getMovings(staircase::IMoving::Direction::UP).empty());
+}
+
+TEST_F(StaticStaircaseLooperTests,
+       GIVENMovingReachesTheOtherSensorNearItsEndTHENFilterLearnsItsTime) {
+    triggerOnce(mUpSensor);
+    mLooper.update(kTick);
+
+    mLooper.update(11000);
+
+    triggerOnce(mDownSensor);
+    EXPECT_CALL(mDownFilter, processNewMovingTime(11000 + kTick))
+        .Times(Exactly(1));
+    mLooper.update(kTick);
+
+    EXPECT_TRUE(
+        mLooper.getMovings(staircase::IMoving::Direction::DOWN).empty());
+}
+
+TEST_F(StaticStaircaseLooperTests,
+       GIVENMovingIsActiveTHENNextDeadlineIsItsNextStep) {
+    std::for_each(std::begin(mBasicLights), std::end(mBasicLights),
+                  [](auto &basicLight) {
+                      ON_CALL(basicLight, nextDeadline())
+                          .WillByDefault(Return(hal::kForever));
+                  });
+    ON_CALL(mDownSensor, nextDeadline()).WillByDefault(Return(hal::kForever));
+    ON_CALL(mUpSensor, nextDeadline()).WillByDefault(Return(hal::kForever));
+    EXPECT_EQ(mLooper.nextDeadline(), hal::kForever);
+
+    triggerOnce(mDownSensor);
+    mLooper.update(kTick);
+    mLooper.update(300);
+
+    EXPECT_EQ(mLooper.nextDeadline(), 700);
+}
+
+// Concrete lights for a staircase of any size, next to the default one.
+template <staircase::StaircaseConfig Config> class ConcreteStaircase {
+  public:
+    using Calculator =
+        staircase::StaticClippedSquaredMovingDurationCalculator<
+            Config.lightsNum>;
+    using Looper = staircase::StaticStaircaseLooper<
+        Config, staircase::BasicLight, staircase::IProximitySensor, Calculator,
+        staircase::MTAMovingTimeFilter>;
+
+    ConcreteStaircase(staircase::IProximitySensor &downSensor,
+                      staircase::IProximitySensor &upSensor)
+        : mLights{makeLights(std::make_index_sequence<Config.lightsNum>{})},
+          mLightRefs{
+              makeLightRefs(std::make_index_sequence<Config.lightsNum>{})},
+          mDownFilter{Config.initialMovingDuration},
+          mUpFilter{Config.initialMovingDuration},
+          mLooper{mLightRefs,  downSensor, upSensor,
+                  mCalculator, mDownFilter, mUpFilter} {}
+
+    Looper &getLooper() { return mLooper; }
+    bool isOn(std::size_t index) const { return mLights[index].isOn(); }
+
+  private:
+    template <std::size_t... I>
+    std::array<staircase::BasicLight, Config.lightsNum>
+    makeLights(std::index_sequence<I...>) {
+        return {staircase::BasicLight{((void)I, mWriter)}...};
+    }
+
+    template <std::size_t... I>
+    typename Looper::Lights makeLightRefs(std::index_sequence<I...>) {
+        return {mLights[I]...};
+    }
+
+    NiceMock<mocks::BinaryValueWriterMock> mWriter;
+    std::array<staircase::BasicLight, Config.lightsNum> mLights;
+    typename Looper::Lights mLightRefs;
+    Calculator mCalculator;
+    staircase::MTAMovingTimeFilter mDownFilter;
+    staircase::MTAMovingTimeFilter mUpFilter;
+    Looper mLooper;
+};
+
+TEST(StaticStaircaseLooperConfigTests,
+     GIVENTwoStaircasesOfDifferentSizeTHENEachMovesOverItsOwnLights) {
+    constexpr staircase::StaircaseConfig kShort{4, 3000, 300, 2, 2000, 6000};
+    constexpr staircase::StaircaseConfig kLong{16, 3000, 300, 4, 2000, 20000};
+
+    NiceMock<mocks::ProximitySensorMock> downSensor;
+    NiceMock<mocks::ProximitySensorMock> upSensor;
+    ON_CALL(downSensor, isClose()).WillByDefault(Return(true));
+    EXPECT_CALL(downSensor, hasStateChanged())
+        .WillOnce(Return(true))
+        .WillOnce(Return(true))
+        .WillRepeatedly(Return(false));
+
+    ConcreteStaircase<kShort> shortStaircase{downSensor, upSensor};
+    ConcreteStaircase<kLong> longStaircase{downSensor, upSensor};
+
+    shortStaircase.getLooper().update(10);
+    longStaircase.getLooper().update(10);
+    EXPECT_TRUE(shortStaircase.isOn(0));
+    EXPECT_TRUE(longStaircase.isOn(0));
+
+    // The fourth light follows after 500 + 750 + 1200 ms in both, it is the
+    // last one only on the short staircase.
+    shortStaircase.getLooper().update(2450);
+    longStaircase.getLooper().update(2450);
+    EXPECT_TRUE(shortStaircase.isOn(3));
+    EXPECT_TRUE(longStaircase.isOn(3));
+    EXPECT_FALSE(longStaircase.isOn(4));
+}
+
+} // namespace tests
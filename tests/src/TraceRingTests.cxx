@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <hal/IStreamWriter.hxx>
+
+#include <staircase/IRunnable.hxx>
+#include <staircase/TraceRing.hxx>
+#include <staircase/TraceRunnable.hxx>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace tests {
+
+class ByteSink final : public hal::IStreamWriter {
+  public:
+    std::size_t write(std::span<const std::byte> data) noexcept override {
+        bytes.insert(bytes.end(), data.begin(), data.end());
+        ++writes;
+        return data.size();
+    }
+
+    std::vector<staircase::TraceRecord> records() const {
+        std::vector<staircase::TraceRecord> decoded;
+        for (std::size_t offset = 0;
+             offset + staircase::kTraceRecordSize <= bytes.size();
+             offset += staircase::kTraceRecordSize) {
+            decoded.push_back(staircase::decodeTraceRecord(
+                std::span<const std::byte, staircase::kTraceRecordSize>{
+                    bytes.data() + offset, staircase::kTraceRecordSize}));
+        }
+        return decoded;
+    }
+
+    std::vector<std::byte> bytes;
+    std::size_t writes = 0;
+};
+
+TEST(TraceRingTests, GivenRecordIsEncodedItDecodesToTheSameRecord) {
+    staircase::TraceRecord record{0xDEADBEEF,
+                                  staircase::TraceEvent::MOVING_FINISH,
+                                  0x1234, -42};
+
+    auto encoded = staircase::encodeTraceRecord(record);
+    auto decoded = staircase::decodeTraceRecord(encoded);
+
+    EXPECT_EQ(encoded[0], std::byte{0xEF});
+    EXPECT_EQ(decoded.time, record.time);
+    EXPECT_EQ(decoded.event, record.event);
+    EXPECT_EQ(decoded.subject, record.subject);
+    EXPECT_EQ(decoded.value, record.value);
+}
+
+TEST(TraceRingTests, GivenRingIsAdvancedRecordsCarryItsTime) {
+    staircase::TraceRing trace;
+
+    trace.advance(10);
+    trace.record(staircase::TraceEvent::LIGHT_ON, 2, 0);
+    trace.advance(5);
+    trace.recordAt(12, staircase::TraceEvent::SENSOR_EDGE, 0, 1);
+
+    staircase::TraceRecord record;
+    ASSERT_TRUE(trace.pop(record));
+    EXPECT_EQ(record.time, 10);
+    EXPECT_EQ(record.subject, 2);
+    ASSERT_TRUE(trace.pop(record));
+    EXPECT_EQ(record.time, 12);
+    EXPECT_FALSE(trace.pop(record));
+}
+
+TEST(TraceRingTests, GivenRingIsFullNewRecordsAreDroppedAndCounted) {
+    staircase::TraceRing trace;
+
+    for (std::size_t index = 0; index < staircase::TraceRing::kSize + 3;
+         ++index) {
+        trace.record(staircase::TraceEvent::LIGHT_ON,
+                     static_cast<std::uint16_t>(index), 0);
+    }
+
+    EXPECT_EQ(trace.dropped(), 3);
+}
+
+TEST(TraceRunnableTests, GivenRecordsAreDrainedTheyAreWrittenInChunks) {
+    staircase::TraceRing trace;
+    ByteSink sink;
+    staircase::TraceRunnable drain{trace, sink};
+
+    constexpr std::size_t kRecords =
+        staircase::TraceRunnable::kChunkRecords + 1;
+    for (std::size_t index = 0; index < kRecords; ++index) {
+        trace.record(staircase::TraceEvent::LIGHT_OFF,
+                     static_cast<std::uint16_t>(index), 0);
+    }
+
+    EXPECT_EQ(drain.drain(), kRecords);
+    EXPECT_EQ(sink.writes, 2);
+    auto records = sink.records();
+    ASSERT_EQ(records.size(), kRecords);
+    EXPECT_EQ(records.back().subject, kRecords - 1);
+
+    EXPECT_EQ(drain.drain(), 0);
+    EXPECT_EQ(sink.writes, 2);
+}
+
+TEST(TraceRunnableTests, GivenRingOverflowedDrainReportsTheGap) {
+    staircase::TraceRing trace;
+    ByteSink sink;
+    staircase::TraceRunnable drain{trace, sink};
+
+    trace.advance(7);
+    for (std::size_t index = 0; index < staircase::TraceRing::kSize + 5;
+         ++index) {
+        trace.record(staircase::TraceEvent::LIGHT_ON, 0, 0);
+    }
+    static_cast<staircase::IRunnable &>(drain).run();
+    trace.record(staircase::TraceEvent::LIGHT_OFF, 0, 0);
+    drain.drain();
+
+    auto records = sink.records();
+    ASSERT_EQ(records.size(), staircase::TraceRing::kSize + 2);
+    EXPECT_EQ(records[0].event, staircase::TraceEvent::DROPPED);
+    EXPECT_EQ(records[0].value, 5);
+    EXPECT_EQ(records.back().event, staircase::TraceEvent::LIGHT_OFF);
+}
+
+} // namespace tests
\ No newline at end of file
@@ -0,0 +1,165 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <mocks/PersistenceMock.hxx>
+
+#include <hal/IPersistence.hxx>
+#include <hal/Timing.hxx>
+
+#include <staircase/WriteBehindStore.hxx>
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace tests {
+
+using ::testing::_;
+using ::testing::Exactly;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+
+class WriteBehindStoreTests : public ::testing::Test {
+  public:
+    using Store = staircase::WriteBehindStore<3>;
+    using Entry = hal::IPersistence::Entry;
+
+    WriteBehindStoreTests()
+        : mStore{mPersistence, {"a", "b", "c"}, kQuietPeriod, kThreshold} {
+        ON_CALL(mPersistence, setValues(_))
+            .WillByDefault(Invoke([this](std::span<const Entry> entries) {
+                std::vector<std::pair<std::string, std::int32_t>> batch;
+                for (const auto &entry : entries) {
+                    batch.emplace_back(entry.key, entry.value);
+                }
+                mBatches.push_back(std::move(batch));
+            }));
+    }
+
+  protected:
+    static constexpr hal::Milliseconds kQuietPeriod = 1000;
+    static constexpr std::int32_t kThreshold = 4;
+
+    NiceMock<mocks::PersistenceMock> mPersistence;
+    Store mStore;
+    std::vector<std::vector<std::pair<std::string, std::int32_t>>> mBatches;
+};
+
+TEST_F(WriteBehindStoreTests, GIVENRestoreIsCalledTHENAllKeysAreReadAtOnce) {
+    EXPECT_CALL(mPersistence, keyExists(_)).Times(Exactly(0));
+    EXPECT_CALL(mPersistence, getValue(_)).Times(Exactly(0));
+    EXPECT_CALL(mPersistence, getValues(_))
+        .WillOnce(Invoke([](std::span<Entry> entries) {
+            ASSERT_EQ(entries.size(), 3);
+            EXPECT_EQ(entries[0].key, "a");
+            EXPECT_EQ(entries[2].key, "c");
+            entries[0].value = 10;
+            entries[0].found = true;
+            entries[2].value = 30;
+            entries[2].found = true;
+        }));
+
+    EXPECT_EQ(mStore.restore(), 2);
+    EXPECT_TRUE(mStore.has(0));
+    EXPECT_FALSE(mStore.has(1));
+    EXPECT_EQ(mStore.get(0), 10);
+    EXPECT_EQ(mStore.get(2), 30);
+    EXPECT_FALSE(mStore.isDirty());
+}
+
+TEST_F(WriteBehindStoreTests,
+       GIVENValueIsSetTHENItIsWrittenOnlyAfterTheQuietPeriod) {
+    mStore.set(1, 7);
+    EXPECT_TRUE(mStore.isDirty());
+    EXPECT_EQ(mStore.nextDeadline(), kQuietPeriod);
+
+    mStore.update(kQuietPeriod - 1);
+    EXPECT_TRUE(mBatches.empty());
+    EXPECT_EQ(mStore.nextDeadline(), 1);
+
+    mStore.update(1);
+    ASSERT_EQ(mBatches.size(), 1);
+    ASSERT_EQ(mBatches[0].size(), 1);
+    EXPECT_EQ(mBatches[0][0].first, "b");
+    EXPECT_EQ(mBatches[0][0].second, 7);
+    EXPECT_FALSE(mStore.isDirty());
+    EXPECT_EQ(mStore.nextDeadline(), hal::kForever);
+}
+
+TEST_F(WriteBehindStoreTests, GIVENValuesKeepChangingTHENWritesAreCoalesced) {
+    mStore.set(0, 1);
+    mStore.update(kQuietPeriod / 2);
+    mStore.set(2, 2);
+    mStore.update(kQuietPeriod / 2);
+    mStore.set(0, 3);
+    mStore.update(kQuietPeriod - 1);
+    EXPECT_TRUE(mBatches.empty());
+
+    mStore.update(1);
+    ASSERT_EQ(mBatches.size(), 1);
+    ASSERT_EQ(mBatches[0].size(), 2);
+    EXPECT_EQ(mBatches[0][0], std::make_pair(std::string{"a"}, 3));
+    EXPECT_EQ(mBatches[0][1], std::make_pair(std::string{"c"}, 2));
+}
+
+TEST_F(WriteBehindStoreTests,
+       GIVENDirtyThresholdIsReachedTHENItIsWrittenWithoutWaiting) {
+    for (std::int32_t value = 1; value <= kThreshold; ++value) {
+        mStore.set(0, value);
+        mStore.update(1);
+    }
+
+    ASSERT_EQ(mBatches.size(), 1);
+    EXPECT_EQ(mBatches[0][0].second, kThreshold);
+}
+
+TEST_F(WriteBehindStoreTests, GIVENValueIsUnchangedTHENNothingIsWritten) {
+    mStore.set(0, 5);
+    mStore.flush();
+    mStore.set(0, 5);
+    mStore.update(kQuietPeriod);
+
+    EXPECT_EQ(mBatches.size(), 1);
+}
+
+TEST_F(WriteBehindStoreTests, GIVENFlushIsCalledTHENDirtyValuesAreWrittenNow) {
+    mStore.flush();
+    EXPECT_TRUE(mBatches.empty());
+
+    mStore.set(2, 9);
+    mStore.flush();
+    ASSERT_EQ(mBatches.size(), 1);
+    EXPECT_EQ(mBatches[0][0], std::make_pair(std::string{"c"}, 9));
+}
+
+TEST(WriteBehindStoreDefaultTests,
+     GIVENBackendHasNoBatchAccessTHENDefaultsGoKeyByKey) {
+    class MapPersistence final : public hal::IPersistence {
+      public:
+        bool keyExists(std::string_view key) const noexcept override {
+            return key == "x";
+        }
+        std::int32_t getValue(std::string_view) const noexcept override {
+            return 42;
+        }
+        void setValue(std::string_view key,
+                      std::int32_t value) noexcept override {
+            writes.emplace_back(key, value);
+        }
+
+        std::vector<std::pair<std::string, std::int32_t>> writes;
+    } persistence;
+
+    staircase::WriteBehindStore<2> store{persistence, {"x", "y"}};
+    EXPECT_EQ(store.restore(), 1);
+    EXPECT_EQ(store.get(0), 42);
+
+    store.set(1, 3);
+    store.flush();
+    ASSERT_EQ(persistence.writes.size(), 1);
+    EXPECT_EQ(persistence.writes[0], std::make_pair(std::string{"y"}, 3));
+}
+
+} // namespace tests
\ No newline at end of file